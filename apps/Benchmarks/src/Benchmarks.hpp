@@ -0,0 +1,25 @@
+#pragma once
+
+#include "Aurora/RHI/RHI.hpp"
+
+#include <chrono>
+#include <cstdint>
+
+namespace Aurora::Benchmarks {
+
+struct Options {
+    uint32_t iterations{2000};
+    uint32_t drawsPerIteration{1000};
+    // Ignorado com AURORA_RHI_STATIC_BACKEND (só o backend estático existe)
+    RHI::BackendType backend{RHI::BackendType::Null};
+};
+
+// Grava o mesmo frame via ICommandList (vtable) e via RHI::Backend::CommandList (tipo final com backend estático)
+int runRHIDispatch(const Options& options);
+
+// Tempo médio por chamada em nanossegundos
+inline double nanosPerCall(std::chrono::steady_clock::duration elapsed, uint64_t calls) {
+    return calls ? std::chrono::duration<double, std::nano>(elapsed).count() / static_cast<double>(calls) : 0.0;
+}
+
+}
@@ -0,0 +1,67 @@
+#include "Benchmarks.hpp"
+#include "Aurora/RHI/StaticBackend.hpp"
+#include "Aurora/Core/Log.hpp"
+
+#include <cstdio>
+#include <span>
+
+namespace Aurora::Benchmarks {
+
+namespace {
+
+// Sequência típica de um pass (estado + N draws com offset dinâmico), instanciada para a interface
+// virtual e para o tipo concreto do backend
+template <typename List>
+void recordFrame(List& cmd, uint32_t draws) {
+    cmd.begin();
+    cmd.setGraphicsPipeline(nullptr);
+    cmd.setVertexBuffer(nullptr);
+    cmd.setIndexBuffer(nullptr);
+    cmd.bindDescriptorSet(nullptr);
+    for (uint32_t i = 0; i < draws; ++i) {
+        const uint32_t offset = i * 256u;
+        cmd.bindDescriptorSet(nullptr, std::span<const uint32_t>(&offset, 1));
+        cmd.drawIndexed(36, 0, RHI::IndexType::Uint32);
+    }
+    cmd.end();
+}
+
+template <typename List>
+double measure(List& cmd, const Options& o) {
+    recordFrame(cmd, o.drawsPerIteration); // aquecimento: capacidade dos vetores de gravação
+    const auto start = std::chrono::steady_clock::now();
+    for (uint32_t it = 0; it < o.iterations; ++it) recordFrame(cmd, o.drawsPerIteration);
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    const uint64_t callsPerFrame = 6ull + 2ull * o.drawsPerIteration;
+    return nanosPerCall(elapsed, callsPerFrame * o.iterations);
+}
+
+}
+
+int runRHIDispatch(const Options& o) {
+    // Só gravação (sem submit): o GLCommandList não toca no contexto GL até o submit
+#ifdef AURORA_RHI_STATIC_BACKEND
+    const RHI::BackendType type = RHI::Backend::kType;
+#else
+    const RHI::BackendType type = o.backend;
+#endif
+    auto device = RHI::Backend::createDevice(type);
+    if (!device) { Core::log(Core::LogLevel::Error, "Benchmark: falha ao criar device"); return 1; }
+    auto list = device->createCommandList();
+    if (!list) { Core::log(Core::LogLevel::Error, "Benchmark: backend sem command list"); return 1; }
+
+    std::printf("RHI dispatch: backend %s, %u iteracoes x %u draws\n", device->getName(), o.iterations, o.drawsPerIteration);
+    RHI::ICommandList& virtualList = *list;
+    const double virtualNs = measure(virtualList, o);
+    std::printf("  %-32s %8.2f ns/chamada\n", "virtual (ICommandList):", virtualNs);
+
+    if constexpr (RHI::Backend::kStatic) {
+        const double staticNs = measure(RHI::Backend::cast(*list), o);
+        std::printf("  %-32s %8.2f ns/chamada (%.2fx)\n", "estatico (Backend::CommandList):", staticNs, staticNs > 0.0 ? virtualNs / staticNs : 0.0);
+    } else {
+        std::printf("  estatico: indisponivel (configure com -DAURORA_RHI_STATIC_BACKEND=<backend> para comparar)\n");
+    }
+    return 0;
+}
+
+}
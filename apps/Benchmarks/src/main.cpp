@@ -0,0 +1,32 @@
+#include "Benchmarks.hpp"
+#include "Aurora/Core/Log.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+using namespace Aurora;
+
+// Uso: AuroraBenchmarks [--iterations N] [--draws N] [--backend null|opengl]
+int main(int argc, char** argv) {
+    Benchmarks::Options o{};
+    for (int i = 1; i < argc; ++i) {
+        const char* a = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (std::strcmp(a, "--iterations") == 0 && hasValue) {
+            o.iterations = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (std::strcmp(a, "--draws") == 0 && hasValue) {
+            o.drawsPerIteration = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (std::strcmp(a, "--backend") == 0 && hasValue) {
+            const char* v = argv[++i];
+            if (std::strcmp(v, "opengl") == 0) o.backend = RHI::BackendType::OpenGL;
+            else if (std::strcmp(v, "null") == 0) o.backend = RHI::BackendType::Null;
+            else Core::log(Core::LogLevel::Warn, std::string("Backend desconhecido: ") + v);
+        } else {
+            Core::log(Core::LogLevel::Warn, std::string("Argumento ignorado: ") + a);
+        }
+    }
+    if (!o.iterations) o.iterations = 1;
+    if (!o.drawsPerIteration) o.drawsPerIteration = 1;
+    return Benchmarks::runRHIDispatch(o);
+}
@@ -1,9 +1,8 @@
-#version 330 core
-in vec2 vUV;
-out vec4 FragColor;
+#version 420 core
+layout(location=0) in vec2 vUV;
+layout(location=0) out vec4 FragColor;
 void main(){
     // Colorir o triângulo para depurar: degrade por UV
     FragColor = vec4(vUV.x, vUV.y, 0.2, 1.0);
 }
 
-
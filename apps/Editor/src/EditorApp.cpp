@@ -69,7 +69,7 @@ int EditorApp::run() {
             // Atualiza set do blit para apontar para nova textura
             RHI::SamplerDesc sdesc{}; auto* smp = assets_->getOrCreateSampler(sdesc);
             RHI::DescriptorSetDesc setB{};
-            RHI::DescriptorSetDesc::SampledTextureBinding stb{}; stb.binding = 0; stb.texture = viewport_.color.get(); stb.sampler = smp; stb.uniformName = "uTex";
+            RHI::DescriptorSetDesc::SampledTextureBinding stb{}; stb.binding = 1; stb.texture = viewport_.color; stb.sampler = smp; stb.uniformName = "uTex";
             setB.sampledTextures.push_back(stb);
             setBlit_ = device_->createDescriptorSet(setB);
         }
@@ -77,7 +77,7 @@ int EditorApp::run() {
         render();
 
         // Mostrar a textura do viewport
-        auto* gltex = static_cast<RHI::GLTexture*>(viewport_.color.get());
+        auto* gltex = static_cast<RHI::GLTexture*>(viewport_.color);
         ImGui::Image((ImTextureID)(intptr_t)gltex->id_, ImVec2((float)viewportWidth_, (float)viewportHeight_), ImVec2(0,1), ImVec2(1,0));
         viewportHovered = ImGui::IsWindowHovered(ImGuiHoveredFlags_AllowWhenBlockedByActiveItem);
         ImGui::End();
@@ -97,6 +97,7 @@ int EditorApp::run() {
         ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
         swapchain_->present();
         device_->endFrame();
+        renderSystem_->endFrame();
     }
 
     shutdown();
@@ -119,6 +120,10 @@ bool EditorApp::initialize() {
     if (!swapchain_) { Core::log(Core::LogLevel::Critical, "Falha ao criar swapchain"); return false; }
     rpBackbuffer_ = device_->createRenderPass(RHI::RenderPassDesc{});
     assets_ = std::make_unique<Assets::AssetManager>(*device_);
+#ifdef AURORA_SHADER_BINARY_DIR
+    assets_->addShaderBinaryDirectory(AURORA_SHADER_BINARY_DIR);
+#endif
+    renderSystem_ = std::make_unique<RenderSystem>(*device_);
 
     // Dear ImGui init
     IMGUI_CHECKVERSION();
@@ -153,7 +158,7 @@ bool EditorApp::initialize() {
     vboScene_ = device_->createBuffer(verts, sizeof(verts), RHI::BufferUsage::Vertex);
     iboScene_ = device_->createBuffer(idx, sizeof(idx), RHI::BufferUsage::Index);
 
-    uboScene_ = device_->createBuffer(nullptr, sizeof(UBOScene), RHI::BufferUsage::Uniform);
+    uboScene_ = device_->createBuffer(nullptr, sizeof(UBOScene), RHI::BufferUsage::Uniform, RHI::BufferUpdate::Dynamic);
     RHI::DescriptorSetDesc setS{}; setS.uniformBuffers.push_back({0, uboScene_.get(), 0, sizeof(UBOScene), "Globals"});
     setScene_ = device_->createDescriptorSet(setS);
 
@@ -166,6 +171,7 @@ bool EditorApp::initialize() {
     pScene.state.depthStencil.depthTestEnable = true;
     pScene.state.depthStencil.depthWriteEnable = true;
     pScene.state.raster.cullMode = RHI::CullMode::None; // evita culling indevido
+    pScene.uniformBlockLayouts.push_back({0, "Globals", kUBOSceneLayout});
     pipeScene_ = device_->createGraphicsPipeline(pScene);
 
     // Blit pipeline: reutiliza os shaders de textura da Runtime
@@ -190,7 +196,7 @@ bool EditorApp::initialize() {
     RHI::SamplerDesc sdesc{}; sdesc.mipmapMode = RHI::SamplerDesc::MipmapMode::None;
     auto* smp = assets_->getOrCreateSampler(sdesc);
     RHI::DescriptorSetDesc setB{};
-    RHI::DescriptorSetDesc::SampledTextureBinding stb{}; stb.binding = 0; stb.texture = viewport_.color.get(); stb.sampler = smp; stb.uniformName = "uTex";
+    RHI::DescriptorSetDesc::SampledTextureBinding stb{}; stb.binding = 1; stb.texture = viewport_.color; stb.sampler = smp; stb.uniformName = "uTex";
     setB.sampledTextures.push_back(stb);
     setBlit_ = device_->createDescriptorSet(setB);
 
@@ -215,9 +221,8 @@ void EditorApp::shutdown() {
     vboScene_.reset();
     pipeScene_.reset();
 
-    viewport_.renderPass.reset();
-    viewport_.depth.reset();
-    viewport_.color.reset();
+    if (renderSystem_) renderSystem_->releaseViewport(viewport_);
+    renderSystem_.reset();
 
     assets_.reset();
     rpBackbuffer_.reset();
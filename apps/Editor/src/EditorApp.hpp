@@ -48,8 +48,14 @@ private:
     std::unique_ptr<RHI::IBuffer> vboScene_{};
     std::unique_ptr<RHI::IBuffer> iboScene_{};
 
-    // UBO para VP matrix
-    struct UBOScene { alignas(16) float view[16]; alignas(16) float proj[16]; };
+    // UBO para VP matrix (bloco std140 "Globals" de viewport.vert.glsl)
+    struct UBOScene { float view[16]; float proj[16]; };
+    static constexpr RHI::BlockFieldDesc kUBOSceneFields[] = {
+        AURORA_BLOCK_FIELD(UBOScene, view, Mat4),
+        AURORA_BLOCK_FIELD(UBOScene, proj, Mat4),
+    };
+    static constexpr RHI::BlockLayoutDesc kUBOSceneLayout{RHI::BlockLayout::Std140, kUBOSceneFields, sizeof(UBOScene)};
+    static_assert(RHI::matchesBlockLayout(kUBOSceneLayout), "UBOScene não confere com o layout std140 do shader");
     std::unique_ptr<RHI::IBuffer> uboScene_{};
     std::unique_ptr<RHI::IDescriptorSet> setScene_{};
 
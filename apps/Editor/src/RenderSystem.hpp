@@ -6,9 +6,10 @@
 
 namespace Aurora::EditorAppNS {
 
+// Targets emprestados do RenderTargetPool do RenderSystem (não proprietários)
 struct ViewportResources {
-    std::unique_ptr<RHI::ITexture> color;
-    std::unique_ptr<RHI::ITexture> depth;
+    RHI::ITexture* color{nullptr};
+    RHI::ITexture* depth{nullptr};
     std::unique_ptr<RHI::IRenderPass> renderPass;
     uint32_t width{0};
     uint32_t height{0};
@@ -16,14 +17,19 @@ struct ViewportResources {
 
 class RenderSystem {
 public:
-    explicit RenderSystem(RHI::IDevice& device) : device_(device) {}
+    explicit RenderSystem(RHI::IDevice& device) : device_(device), targetPool_(device) {}
 
+    // Devolve os targets atuais ao pool e adquire targets do novo tamanho (reaproveita tamanhos recentes)
     void ensureViewport(ViewportResources& vp, uint32_t width, uint32_t height);
+    void releaseViewport(ViewportResources& vp);
+    // Chamado uma vez por frame: envelhece e descarta targets sem uso
+    void endFrame() { targetPool_.endFrame(); }
+
+    RHI::RenderTargetPool& getTargetPool() { return targetPool_; }
 
 private:
     RHI::IDevice& device_;
+    RHI::RenderTargetPool targetPool_;
 };
 
 }
-
-
@@ -0,0 +1,10 @@
+#version 420 core
+// DebugDraw: posição em mundo, view-projection no UBO
+layout(location=0) in vec3 aPos;
+layout(location=1) in vec4 aColor;
+layout(std140, binding=0) uniform DebugCamera { mat4 viewProjection; };
+layout(location=0) out vec4 vColor;
+void main(){
+    vColor = aColor;
+    gl_Position = viewProjection * vec4(aPos, 1.0);
+}
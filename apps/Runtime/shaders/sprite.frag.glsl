@@ -0,0 +1,8 @@
+#version 420 core
+layout(location=0) in vec2 vUV;
+layout(location=1) in vec4 vColor;
+layout(location=0) out vec4 FragColor;
+layout(binding=0) uniform sampler2D uTex;
+void main(){
+    FragColor = texture(uTex, vUV) * vColor;
+}
@@ -0,0 +1,12 @@
+#version 420 core
+// SpriteBatch: posição já em NDC
+layout(location=0) in vec2 aPos;
+layout(location=1) in vec2 aUV;
+layout(location=2) in vec4 aColor;
+layout(location=0) out vec2 vUV;
+layout(location=1) out vec4 vColor;
+void main(){
+    vUV = aUV;
+    vColor = aColor;
+    gl_Position = vec4(aPos, 0.0, 1.0);
+}
@@ -1,9 +1,8 @@
-#version 330 core
-in vec2 vUV;
-out vec4 FragColor;
-uniform sampler2D uTex;
+#version 420 core
+layout(location=0) in vec2 vUV;
+layout(location=0) out vec4 FragColor;
+layout(binding=1) uniform sampler2D uTex;
 void main(){
     FragColor = texture(uTex, vUV);
 }
 
-
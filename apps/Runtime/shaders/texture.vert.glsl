@@ -1,10 +1,9 @@
-#version 330 core
+#version 420 core
 layout(location=0) in vec2 aPos;
 layout(location=1) in vec2 aUV;
-out vec2 vUV;
+layout(location=0) out vec2 vUV;
 void main(){
     vUV = aUV;
     gl_Position = vec4(aPos, 0.0, 1.0);
 }
 
-
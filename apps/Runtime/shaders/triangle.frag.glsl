@@ -1,8 +1,7 @@
-#version 330 core
-layout(std140) uniform Globals { vec4 color; };
-out vec4 FragColor;
+#version 420 core
+layout(std140, binding=0) uniform Globals { vec4 color; };
+layout(location=0) out vec4 FragColor;
 void main(){
     FragColor = color;
 }
 
-
@@ -1,7 +1,6 @@
-#version 330 core
+#version 420 core
 layout(location=0) in vec2 aPos;
 void main(){
     gl_Position = vec4(aPos, 0.0, 1.0);
 }
 
-
@@ -0,0 +1,7 @@
+#version 420 core
+layout(location=0) in vec2 vUV;
+layout(location=0) out vec4 FragColor;
+layout(binding=0) uniform sampler2D uScene;
+void main(){
+    FragColor = texture(uScene, vUV);
+}
@@ -0,0 +1,12 @@
+#version 420 core
+// Triângulo de tela cheia sem vertex buffer (DynamicResolution::addUpscalePass)
+layout(location=0) out vec2 vUV;
+void main(){
+#ifdef VULKAN
+    int id = gl_VertexIndex;
+#else
+    int id = gl_VertexID;
+#endif
+    vUV = vec2((id << 1) & 2, id & 2);
+    gl_Position = vec4(vUV * 2.0 - 1.0, 0.0, 1.0);
+}
@@ -1,5 +1,8 @@
 #include "Application.hpp"
+#include "Aurora/RHI/StaticBackend.hpp"
+#include "Aurora/Core/LogSinks.hpp"
 
+#include <cstdio>
 #include <fstream>
 #include <sstream>
 #include <filesystem>
@@ -26,6 +29,9 @@ static std::string loadFirstExisting(const std::vector<std::string>& candidates,
 bool Application::initialize() {
     // Window
     Platform::WindowDesc wdesc; wdesc.title = "Aurora - Janela";
+    wdesc.width = options_.width; wdesc.height = options_.height;
+    wdesc.headless = options_.headless;
+    if (options_.headless) vsyncEnabled_ = false; // throughput máximo
     window_ = Platform::createWindow(wdesc);
     if (!window_) { Core::log(Core::LogLevel::Critical, "Falha ao criar janela"); return false; }
     window_->show();
@@ -36,8 +42,13 @@ bool Application::initialize() {
     RHI::SwapchainDesc sc{}; sc.windowHandle = window_->getNativeHandle(); sc.width = w; sc.height = h; sc.vsync = vsyncEnabled_;
     swapchain_ = device_->createSwapchain(sc);
     if (!swapchain_) { Core::log(Core::LogLevel::Critical, "Falha ao criar swapchain"); return false; }
-    renderPass_ = device_->createRenderPass(RHI::RenderPassDesc{});
+    jobs_ = std::make_unique<Core::JobSystem>();
+    renderGraph_ = std::make_unique<Renderer::RenderGraph>(*device_);
+    renderGraph_->setJobSystem(jobs_.get());
     assets_ = std::make_unique<Assets::AssetManager>(*device_);
+#ifdef AURORA_SHADER_BINARY_DIR
+    assets_->addShaderBinaryDirectory(AURORA_SHADER_BINARY_DIR);
+#endif
 
     // Shaders via arquivos (tenta múltiplos caminhos) — agora usando shaders de textura
     std::vector<std::string> vsCandidates = {
@@ -76,7 +87,7 @@ bool Application::initialize() {
     const uint32_t indices[] = { 0, 1, 2 };
     vbo_ = device_->createBuffer(verts, sizeof(verts), RHI::BufferUsage::Vertex);
     ibo_ = device_->createBuffer(indices, sizeof(indices), RHI::BufferUsage::Index);
-    ubo_ = device_->createBuffer(&globals_, sizeof(globals_), RHI::BufferUsage::Uniform);
+    ubo_ = device_->createBuffer(&globals_, sizeof(globals_), RHI::BufferUsage::Uniform, RHI::BufferUpdate::Dynamic);
     RHI::DescriptorSetDesc setDesc{};
     setDesc.uniformBuffers.push_back({0, ubo_.get(), 0, sizeof(globals_), "Globals"});
     // Textura e sampler
@@ -105,37 +116,176 @@ bool Application::initialize() {
     p.vertexLayout.attributes.push_back({1, 2, sizeof(float)*2}); // aUV
     pipeline_ = device_->createGraphicsPipeline(p);
 
+    // Resolução dinâmica: cena offscreen em escala variável, ampliada no swapchain
+    if (options_.dynamicResolutionMs > 0.0f) {
+        std::string usedUpVs, usedUpFs;
+        (void)loadFirstExisting({"apps/Runtime/shaders/upscale.vert.glsl", "shaders/upscale.vert.glsl"}, usedUpVs);
+        (void)loadFirstExisting({"apps/Runtime/shaders/upscale.frag.glsl", "shaders/upscale.frag.glsl"}, usedUpFs);
+        auto* upVs = usedUpVs.empty() ? nullptr : assets_->getOrLoadShaderFromFile(RHI::ShaderStage::Vertex, usedUpVs);
+        auto* upFs = usedUpFs.empty() ? nullptr : assets_->getOrLoadShaderFromFile(RHI::ShaderStage::Fragment, usedUpFs);
+        Renderer::DynamicResolutionDesc drDesc{};
+        drDesc.targetFrameMs = options_.dynamicResolutionMs;
+        dynamicResolution_ = std::make_unique<Renderer::DynamicResolution>(*device_, drDesc);
+        if (!dynamicResolution_->initialize(upVs, upFs)) {
+            Core::log(Core::LogLevel::Warn, "Resolução dinâmica desativada (shaders de upscale indisponíveis)");
+            dynamicResolution_.reset();
+        } else if (!device_->getCapabilities().supportsGpuTiming) {
+            Core::log(Core::LogLevel::Info, "Resolução dinâmica guiada pelo tempo de CPU (backend sem timer de GPU)");
+        }
+    }
+
+    // Overlay 2D de estatísticas
+    {
+        std::string usedSpriteVs, usedSpriteFs;
+        (void)loadFirstExisting({"apps/Runtime/shaders/sprite.vert.glsl", "shaders/sprite.vert.glsl"}, usedSpriteVs);
+        (void)loadFirstExisting({"apps/Runtime/shaders/sprite.frag.glsl", "shaders/sprite.frag.glsl"}, usedSpriteFs);
+        auto* spriteVs = usedSpriteVs.empty() ? nullptr : assets_->getOrLoadShaderFromFile(RHI::ShaderStage::Vertex, usedSpriteVs);
+        auto* spriteFs = usedSpriteFs.empty() ? nullptr : assets_->getOrLoadShaderFromFile(RHI::ShaderStage::Fragment, usedSpriteFs);
+        spriteBatch_ = std::make_unique<Renderer::SpriteBatch>(*device_);
+        if (!spriteBatch_->initialize(spriteVs, spriteFs)) {
+            Core::log(Core::LogLevel::Warn, "Overlay de estatísticas indisponível (shaders de sprite)");
+            spriteBatch_.reset();
+        }
+        showStats_ = options_.showStats;
+    }
+
+    // Desenho de depuração
+    if constexpr (Renderer::kDebugDrawEnabled) {
+        std::string usedDebugVs, usedDebugFs;
+        (void)loadFirstExisting({"apps/Runtime/shaders/debug.vert.glsl", "shaders/debug.vert.glsl"}, usedDebugVs);
+        (void)loadFirstExisting({"apps/Runtime/shaders/debug.frag.glsl", "shaders/debug.frag.glsl"}, usedDebugFs);
+        auto* debugVs = usedDebugVs.empty() ? nullptr : assets_->getOrLoadShaderFromFile(RHI::ShaderStage::Vertex, usedDebugVs);
+        auto* debugFs = usedDebugFs.empty() ? nullptr : assets_->getOrLoadShaderFromFile(RHI::ShaderStage::Fragment, usedDebugFs);
+        debugDraw_ = std::make_unique<Renderer::DebugDraw>(*device_);
+        if (!debugDraw_->initialize(debugVs, debugFs)) {
+            Core::log(Core::LogLevel::Warn, "Desenho de depuração indisponível (shaders de debug)");
+            debugDraw_.reset();
+        }
+    }
+
+    // Triângulo estático: gravado uma vez e reexecutado a cada frame
+    sceneBundle_ = device_->createCommandBundle();
+    if (sceneBundle_) {
+        sceneBundle_->begin();
+        sceneBundle_->setGraphicsPipeline(pipeline_.get());
+        sceneBundle_->bindDescriptorSet(descriptorSet_.get());
+        sceneBundle_->setVertexBuffer(vbo_.get());
+        sceneBundle_->setIndexBuffer(ibo_.get());
+        sceneBundle_->drawIndexed(3, 0, RHI::IndexType::Uint32);
+        sceneBundle_->end();
+        if (!sceneBundle_->isValid()) sceneBundle_.reset();
+    }
+
     return true;
 }
 
 void Application::shutdown() {
     // Destruir recursos GL antes da janela/contexto para evitar chamadas GL sem contexto
+    sceneBundle_.reset();
     pipeline_.reset();
     descriptorSet_.reset();
     ubo_.reset();
     ibo_.reset();
     vbo_.reset();
+    spriteBatch_.reset();
+    debugDraw_.reset();
+    dynamicResolution_.reset();
     if (assets_) assets_->clear();
-    renderPass_.reset();
+    renderGraph_.reset();
+    jobs_.reset();
     swapchain_.reset();
     device_.reset();
     if (window_) { Platform::destroyWindow(window_); window_ = nullptr; }
 }
 
-int Application::run() {
+void Application::addStatsOverlay(double frameMs, float cpuFrameMs) {
+    // Média móvel para o texto não tremer a cada frame
+    smoothedFrameMs_ = smoothedFrameMs_ > 0.0 ? smoothedFrameMs_ + 0.1 * (frameMs - smoothedFrameMs_) : frameMs;
+
+    char text[256];
+    int len = std::snprintf(text, sizeof(text), "FPS %.1f (%.2f ms)\nCPU %.2f ms",
+        smoothedFrameMs_ > 0.0 ? 1000.0 / smoothedFrameMs_ : 0.0, smoothedFrameMs_, cpuFrameMs);
+    const float gpuMs = device_->getGpuFrameTimeMs();
+    if (gpuMs > 0.0f && len > 0 && len < static_cast<int>(sizeof(text))) {
+        len += std::snprintf(text + len, sizeof(text) - len, "\nGPU %.2f ms", gpuMs);
+    }
+    if (Core::isMemoryNewHookEnabled() && len > 0 && len < static_cast<int>(sizeof(text))) {
+        uint64_t allocations = 0, bytes = 0;
+        for (uint32_t t = 0; t < static_cast<uint32_t>(Core::MemoryTag::Count); ++t) {
+            const Core::MemoryTagStats s = Core::getMemoryStats(static_cast<Core::MemoryTag>(t));
+            allocations += s.frameAllocations;
+            bytes += s.frameBytes;
+        }
+        len += std::snprintf(text + len, sizeof(text) - len, "\nHeap %llu alloc/frame (%.1f KB)",
+            static_cast<unsigned long long>(allocations), static_cast<double>(bytes) / 1024.0);
+    }
+    if (dynamicResolution_ && len > 0 && len < static_cast<int>(sizeof(text))) {
+        len += std::snprintf(text + len, sizeof(text) - len, "\nRes %ux%u (%.0f%%)",
+            dynamicResolution_->getRenderWidth(), dynamicResolution_->getRenderHeight(), dynamicResolution_->getScale() * 100.0f);
+    }
+
+    static const float kBackground[4] = {0.0f, 0.0f, 0.0f, 0.6f};
+    static const float kTextColor[4] = {0.9f, 1.0f, 0.6f, 1.0f};
+    const float scale = 2.0f;
+    const auto& font = spriteBatch_->getDebugFont();
+    spriteBatch_->begin(swapchain_->getWidth(), swapchain_->getHeight());
+    const float width = Renderer::SpriteBatch::measureText(font, text, scale);
+    float lines = 1.0f;
+    for (const char* c = text; *c; ++c) lines += *c == '\n' ? 1.0f : 0.0f;
+    spriteBatch_->drawRect(4.0f, 4.0f, width + 12.0f, lines * font.lineHeight * scale + 8.0f, kBackground);
+    spriteBatch_->drawText(font, 10.0f, 8.0f, text, kTextColor, scale, 1);
+    spriteBatch_->end();
+
+    renderGraph_->addPass("Stats",
+        [&](Renderer::RenderGraphBuilder& builder) { builder.writeSwapchain(swapchain_.get()); },
+        [this](Renderer::RenderGraphContext& ctx) { spriteBatch_->record(ctx.getCommandList()); });
+}
+
+void Application::addDebugDrawPass(float deltaSeconds) {
+    // A cena é 2D em NDC: view-projection identidade e sem depth, então tudo vai como overlay
+    static const float kIdentity[16] = {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1};
+    debugDraw_->box({-0.8f, -0.8f, 0.0f}, {0.8f, 0.8f, 0.0f}, {1.0f, 0.8f, 0.2f, 1.0f}, Renderer::DebugDepth::Overlay);
+    debugDraw_->axes(kIdentity, 0.25f, Renderer::DebugDepth::Overlay);
+    debugDraw_->flush(kIdentity, deltaSeconds);
+
+    renderGraph_->addPass("DebugDraw",
+        [&](Renderer::RenderGraphBuilder& builder) { builder.writeSwapchain(swapchain_.get()); },
+        [this](Renderer::RenderGraphContext& ctx) { debugDraw_->record(ctx.getCommandList()); });
+}
+
+int Application::run(const RunOptions& options) {
     Core::initializeLogging();
+    if (!options.logFilePath.empty()) Core::addLogSink(std::make_shared<Core::FileLogSink>(options.logFilePath));
     Core::log(Core::LogLevel::Info, "AuroraRuntime starting...");
+    options_ = options;
+    Core::MemoryTagScope memoryTag(Core::MemoryTag::Application);
+    Core::setAllocationSampling(options_.allocationSampling);
 
     if (!initialize()) { shutdown(); Core::shutdownLogging(); return -1; }
 
     Platform::TimePoint start = Platform::getTimeNow();
-    Platform::TimePoint last = start;
+    clock_ = options_.fixedDeltaSeconds > 0.0
+        ? Platform::FrameClock(Platform::FrameClock::Mode::Fixed, options_.fixedDeltaSeconds)
+        : Platform::FrameClock(Platform::FrameClock::Mode::RealTime);
+
+    const bool replaying = !options_.replayInputPath.empty();
+    if (replaying && !inputReplay_.load(options_.replayInputPath)) { shutdown(); Core::shutdownLogging(); return -1; }
+    if (!options_.recordInputPath.empty()) inputRecorder_.open(options_.recordInputPath);
+
+    float lastCpuFrameMs = 0.0f;
+    for (;;) {
+        if (options_.maxFrames && clock_.getFrameIndex() >= options_.maxFrames) break;
+        eventScript_.dispatch(clock_.getFrameIndex(), *window_);
+        double replayDt = 0.0;
+        if (replaying && !inputReplay_.playFrame(*window_, replayDt)) break; // fim da gravação
+        if (quit_ || !window_->pumpEvents()) break;
 
-    while (!quit_ && window_->pumpEvents()) {
         // Timing
-        Platform::TimePoint now = Platform::getTimeNow();
-        double dt = static_cast<double>(now.ticks - last.ticks) / static_cast<double>(Platform::getTicksPerSecond());
-        last = now;
+        double dt = clock_.tick();
+        Core::memoryBeginFrame();
+        const Platform::TimePoint frameStart = Platform::getTimeNow();
+        if (replaying && clock_.getMode() == Platform::FrameClock::Mode::RealTime) dt = replayDt;
+        inputRecorder_.recordFrame(dt, window_->getEventQueue());
 
         // Eventos
         for (const auto& e : window_->getEventQueue()) {
@@ -150,6 +300,15 @@ int Application::run() {
                 if (swapchain_) swapchain_->setVsync(vsyncEnabled_);
                 Core::log(Core::LogLevel::Info, std::string("VSync ") + (vsyncEnabled_ ? "ON" : "OFF"));
             }
+            if (e.type == Platform::EventType::KeyDown && e.key == Platform::Key::P) {
+                showStats_ = !showStats_;
+            }
+            if (e.type == Platform::EventType::KeyDown && e.key == Platform::Key::B) {
+                showDebugDraw_ = !showDebugDraw_;
+            }
+            if (e.type == Platform::EventType::KeyDown && e.key == Platform::Key::M) {
+                Core::writeMemorySnapshot(options_.memorySnapshotPath.empty() ? "memory_snapshot.json" : options_.memorySnapshotPath);
+            }
             if (e.type == Platform::EventType::KeyDown && e.key == Platform::Key::W) {
                 static bool wire = false; wire = !wire;
                 if (device_) device_->setDebugWireframe(wire);
@@ -167,26 +326,60 @@ int Application::run() {
         // Atualiza UBO com estado de aplicação (ex.: cor animada)
         device_->updateBuffer(ubo_.get(), &globals_, sizeof(globals_));
 
-        if (swapchain_ && renderPass_) {
-            auto cmd = device_->createCommandList();
-            cmd->begin();
-            cmd->beginRenderPass(renderPass_.get(), swapchain_.get());
-            cmd->setGraphicsPipeline(pipeline_.get());
-            cmd->bindDescriptorSet(descriptorSet_.get());
-            cmd->setVertexBuffer(vbo_.get());
-            cmd->setIndexBuffer(ibo_.get());
-            onRender();
-            cmd->drawIndexed(3, 0, RHI::IndexType::Uint32);
-            cmd->endRenderPass();
-            cmd->end();
-            device_->submit(cmd.get());
+        if (swapchain_ && renderGraph_) {
+            static const float kClearColor[4] = {0.1f, 0.1f, 0.1f, 1.0f};
+            renderGraph_->reset();
+            auto recordScene = [&](Renderer::RenderGraphContext& ctx) {
+                // Tipo concreto com AURORA_RHI_STATIC_BACKEND (gravação sem vtable); ICommandList caso contrário
+                auto& cmd = RHI::Backend::cast(ctx.getCommandList());
+                if (sceneBundle_) {
+                    onRender();
+                    cmd.executeBundle(sceneBundle_.get());
+                    return;
+                }
+                cmd.setGraphicsPipeline(pipeline_.get());
+                cmd.bindDescriptorSet(descriptorSet_.get());
+                cmd.setVertexBuffer(vbo_.get());
+                cmd.setIndexBuffer(ibo_.get());
+                onRender();
+                cmd.drawIndexed(3, 0, RHI::IndexType::Uint32);
+            };
+            if (dynamicResolution_) {
+                // Tempo de CPU do frame anterior; o de GPU vem do device com alguns frames de atraso
+                dynamicResolution_->setDisplaySize(swapchain_->getWidth(), swapchain_->getHeight());
+                dynamicResolution_->update(lastCpuFrameMs);
+                Renderer::RGTexture sceneColor = dynamicResolution_->createColorTarget(*renderGraph_);
+                renderGraph_->addPass("Scene",
+                    [&](Renderer::RenderGraphBuilder& builder) { sceneColor = builder.writeColor(sceneColor, kClearColor); },
+                    recordScene);
+                dynamicResolution_->addUpscalePass(*renderGraph_, sceneColor, swapchain_.get());
+            } else {
+                renderGraph_->addPass("Main",
+                    [&](Renderer::RenderGraphBuilder& builder) { builder.writeSwapchain(swapchain_.get(), kClearColor); },
+                    recordScene);
+            }
+            if (showDebugDraw_ && debugDraw_) addDebugDrawPass(static_cast<float>(dt));
+            if (showStats_ && spriteBatch_) addStatsOverlay(dt * 1000.0, lastCpuFrameMs);
+            if (renderGraph_->compile()) renderGraph_->execute();
+            lastCpuFrameMs = static_cast<float>(Platform::secondsSince(frameStart) * 1000.0);
             swapchain_->present();
         }
         device_->endFrame();
     }
 
     double elapsed = Platform::secondsSince(start);
-    Core::log(Core::LogLevel::Info, "Exiting. Elapsed seconds: " + std::to_string(elapsed));
+    Core::log(Core::LogLevel::Info, "Exiting. Elapsed seconds: " + std::to_string(elapsed)
+        + ", frames: " + std::to_string(clock_.getFrameIndex())
+        + (elapsed > 0.0 ? ", fps: " + std::to_string(static_cast<double>(clock_.getFrameIndex()) / elapsed) : std::string()));
+    if (dynamicResolution_) {
+        const auto& drStats = dynamicResolution_->getStats();
+        Core::log(Core::LogLevel::Info, "Resolução dinâmica: escala final " + std::to_string(drStats.scale)
+            + " (" + std::to_string(drStats.renderWidth) + "x" + std::to_string(drStats.renderHeight)
+            + "), redimensionamentos: " + std::to_string(drStats.resizeCount));
+    }
+    inputRecorder_.close();
+    // Antes do shutdown: o snapshot mostra o que está vivo em regime, não o que sobrou da destruição
+    if (!options_.memorySnapshotPath.empty()) Core::writeMemorySnapshot(options_.memorySnapshotPath);
     shutdown();
     Core::shutdownLogging();
     return 0;
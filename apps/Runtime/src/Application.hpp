@@ -1,22 +1,46 @@
 #pragma once
 
 #include "Aurora/Core/Log.hpp"
+#include "Aurora/Core/JobSystem.hpp"
+#include "Aurora/Core/MemoryTracking.hpp"
 #include "Aurora/Platform/Window.hpp"
 #include "Aurora/Platform/Time.hpp"
+#include "Aurora/Platform/EventScript.hpp"
+#include "Aurora/Platform/InputRecording.hpp"
 #include "Aurora/RHI/RHI.hpp"
 #include "Aurora/Assets/AssetManager.hpp"
+#include "Aurora/Renderer/RenderGraph.hpp"
+#include "Aurora/Renderer/DynamicResolution.hpp"
+#include "Aurora/Renderer/SpriteBatch.hpp"
+#include "Aurora/Renderer/DebugDraw.hpp"
 
 #include <memory>
 #include <string>
 
 namespace Aurora::RuntimeApp {
 
+// Opções de execução (linha de comando do Runtime)
+struct RunOptions {
+    bool headless{false};          // janela headless + swapchain offscreen, sem vsync
+    uint32_t width{1280};
+    uint32_t height{720};
+    uint64_t maxFrames{0};         // 0 = sem limite
+    double fixedDeltaSeconds{0.0}; // > 0 usa relógio fixo em vez de tempo real
+    std::string recordInputPath{}; // grava eventos + dt de cada frame
+    std::string replayInputPath{}; // reproduz uma gravação (dt gravado, ou fixedDeltaSeconds se > 0); encerra ao fim
+    float dynamicResolutionMs{0.0f}; // > 0 renderiza a cena em escala variável buscando este tempo de frame
+    bool showStats{false};         // overlay de desempenho (alternado com P)
+    std::string memorySnapshotPath{}; // snapshot JSON de memória ao sair (M grava na hora)
+    uint32_t allocationSampling{0};   // callstack de 1 a cada N alocações (requer AURORA_MEMORY_NEW_HOOK)
+    std::string logFilePath{};        // sink de arquivo além do stderr
+};
+
 class Application {
 public:
     virtual ~Application() = default;
 
     // Executa a aplicação (cria janela, device, recursos e entra no loop principal)
-    int run();
+    int run(const RunOptions& options = {});
 
 protected:
     // Callbacks do usuário
@@ -26,20 +50,37 @@ protected:
     // Acesso a objetos principais
     RHI::IDevice* getDevice() { return device_.get(); }
     Platform::IWindow* getWindow() { return window_; }
+    // Eventos agendados por frame, injetados na janela antes de cada pumpEvents
+    Platform::EventScript& getEventScript() { return eventScript_; }
+    const Platform::FrameClock& getClock() const { return clock_; }
 
     // Estruturas de dados compartilhadas com o render
+    // Globals espelha o bloco std140 "Globals" de triangle.frag.glsl
     struct Globals { float color[4]; };
+    static constexpr RHI::BlockFieldDesc kGlobalsFields[] = { AURORA_BLOCK_FIELD(Globals, color, Vec4) };
+    static constexpr RHI::BlockLayoutDesc kGlobalsLayout{RHI::BlockLayout::Std140, kGlobalsFields, sizeof(Globals)};
+    static_assert(RHI::matchesBlockLayout(kGlobalsLayout), "Globals não confere com o layout std140 do shader");
     Globals& getGlobals() { return globals_; }
 
 private:
     bool initialize();
     void shutdown();
+    void addStatsOverlay(double frameMs, float cpuFrameMs);
+    void addDebugDrawPass(float deltaSeconds);
 
     // Recursos
     std::unique_ptr<RHI::IDevice> device_{};
     Platform::IWindow* window_{};
     std::unique_ptr<RHI::ISwapchain> swapchain_{};
-    std::unique_ptr<RHI::IRenderPass> renderPass_{};
+    // Workers compartilhados (gravação de passes do RenderGraph); criado antes e destruído depois do grafo
+    std::unique_ptr<Core::JobSystem> jobs_{};
+    std::unique_ptr<Renderer::RenderGraph> renderGraph_{};
+    // nullptr sem RunOptions::dynamicResolutionMs (cena direto no swapchain)
+    std::unique_ptr<Renderer::DynamicResolution> dynamicResolution_{};
+    // Overlay 2D (estatísticas); nullptr se os shaders de sprite não carregarem
+    std::unique_ptr<Renderer::SpriteBatch> spriteBatch_{};
+    // Bounds e eixos da cena (alternado com B); nullptr se os shaders de debug não carregarem
+    std::unique_ptr<Renderer::DebugDraw> debugDraw_{};
     // Shaders são de propriedade do AssetManager
     RHI::IShaderModule* vs_{};
     RHI::IShaderModule* fs_{};
@@ -48,12 +89,22 @@ private:
     std::unique_ptr<RHI::IBuffer> ubo_{};
     std::unique_ptr<RHI::IGraphicsPipeline> pipeline_{};
     std::unique_ptr<RHI::IDescriptorSet> descriptorSet_{};
+    // Geometria estática pré-gravada (nullptr se o backend não suporta bundles)
+    std::unique_ptr<RHI::ICommandBundle> sceneBundle_{};
     std::unique_ptr<Assets::AssetManager> assets_{};
+    Platform::EventScript eventScript_{};
+    Platform::FrameClock clock_{};
+    Platform::InputRecorder inputRecorder_{};
+    Platform::InputReplay inputReplay_{};
+    RunOptions options_{};
 
     // Estado
     Globals globals_{{0.2f, 0.9f, 0.3f, 1.0f}};
     bool quit_ = false;
     bool vsyncEnabled_ = true;
+    bool showStats_ = false;
+    bool showDebugDraw_ = false;
+    double smoothedFrameMs_ = 0.0;
 };
 
 }
@@ -1,5 +1,9 @@
 #include "Application.hpp"
 
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+
 using namespace Aurora;
 
 class TriangleApp final : public RuntimeApp::Application {
@@ -13,9 +17,49 @@ protected:
     }
 };
 
-int main() {
-    TriangleApp app;
-    return app.run();
+// Uso: AuroraRuntime [--headless] [--size WxH] [--frames N] [--fixed-dt S] [--record-input F] [--replay-input F] [--dynamic-res MS] [--stats]
+//                    [--memory-snapshot F] [--alloc-sampling N] [--log-file F]
+static RuntimeApp::RunOptions parseOptions(int argc, char** argv) {
+    RuntimeApp::RunOptions o{};
+    for (int i = 1; i < argc; ++i) {
+        const char* a = argv[i];
+        const bool hasValue = i + 1 < argc;
+        if (std::strcmp(a, "--headless") == 0) {
+            o.headless = true;
+        } else if (std::strcmp(a, "--stats") == 0) {
+            o.showStats = true;
+        } else if (std::strcmp(a, "--frames") == 0 && hasValue) {
+            o.maxFrames = std::strtoull(argv[++i], nullptr, 10);
+        } else if (std::strcmp(a, "--fixed-dt") == 0 && hasValue) {
+            o.fixedDeltaSeconds = std::strtod(argv[++i], nullptr);
+        } else if (std::strcmp(a, "--record-input") == 0 && hasValue) {
+            o.recordInputPath = argv[++i];
+        } else if (std::strcmp(a, "--replay-input") == 0 && hasValue) {
+            o.replayInputPath = argv[++i];
+        } else if (std::strcmp(a, "--dynamic-res") == 0 && hasValue) {
+            o.dynamicResolutionMs = std::strtof(argv[++i], nullptr);
+        } else if (std::strcmp(a, "--memory-snapshot") == 0 && hasValue) {
+            o.memorySnapshotPath = argv[++i];
+        } else if (std::strcmp(a, "--alloc-sampling") == 0 && hasValue) {
+            o.allocationSampling = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (std::strcmp(a, "--log-file") == 0 && hasValue) {
+            o.logFilePath = argv[++i];
+        } else if (std::strcmp(a, "--size") == 0 && hasValue) {
+            char* end = nullptr;
+            const char* v = argv[++i];
+            uint32_t w = static_cast<uint32_t>(std::strtoul(v, &end, 10));
+            if (end && *end == 'x') {
+                uint32_t h = static_cast<uint32_t>(std::strtoul(end + 1, nullptr, 10));
+                if (w && h) { o.width = w; o.height = h; }
+            }
+        } else {
+            Core::log(Core::LogLevel::Warn, std::string("Argumento ignorado: ") + a);
+        }
+    }
+    return o;
 }
 
-
+int main(int argc, char** argv) {
+    TriangleApp app;
+    return app.run(parseOptions(argc, argv));
+}
@@ -0,0 +1,88 @@
+# Compilação offline de shaders GLSL -> SPIR-V.
+#
+# aurora_compile_shaders(<target> SOURCES <arquivos .vert.glsl/.frag.glsl/.comp.glsl>...)
+#
+# Para cada fonte gera, em ${AURORA_SPIRV_DIR}/<caminho relativo ao projeto>:
+#   <nome>.spv     alvo OpenGL (GL_ARB_gl_spirv), carregado pelo GLDevice com fallback para o GLSL
+#   <nome>.vk.spv  alvo Vulkan
+# Os módulos saem sem informação de debug (-g0) e, se o spirv-opt estiver disponível, passam por
+# --strip-debug --remove-duplicates. Um mesmo fonte usado por vários alvos é compilado uma única vez.
+# Os binários também são copiados para <dir do executável>/shaders e o diretório é exposto ao código
+# via AURORA_SHADER_BINARY_DIR (AssetManager::addShaderBinaryDirectory).
+# Sem glslangValidator o passo é ignorado e os apps usam apenas GLSL.
+
+find_program(AURORA_GLSLANG_VALIDATOR glslangValidator HINTS "$ENV{VULKAN_SDK}/bin" "$ENV{VULKAN_SDK}/Bin")
+find_program(AURORA_SPIRV_OPT spirv-opt HINTS "$ENV{VULKAN_SDK}/bin" "$ENV{VULKAN_SDK}/Bin")
+set(AURORA_SPIRV_DIR "${CMAKE_BINARY_DIR}/shaders/spirv" CACHE PATH "Saída dos shaders SPIR-V compilados offline")
+
+if(AURORA_COMPILE_SHADERS AND NOT AURORA_GLSLANG_VALIDATOR)
+  message(STATUS "glslangValidator não encontrado: shaders serão compilados apenas em runtime (GLSL)")
+endif()
+
+# Regra de compilação de um fonte para um alvo (-G OpenGL / -V Vulkan)
+function(_aurora_spirv_rule src stage client output)
+  get_filename_component(outDir "${output}" DIRECTORY)
+  if(AURORA_SPIRV_OPT)
+    add_custom_command(
+      OUTPUT "${output}"
+      COMMAND ${CMAKE_COMMAND} -E make_directory "${outDir}"
+      COMMAND "${AURORA_GLSLANG_VALIDATOR}" ${client} -g0 -S ${stage} -DAURORA_SPIRV=1 -o "${output}.raw" "${src}"
+      COMMAND "${AURORA_SPIRV_OPT}" --strip-debug --remove-duplicates "${output}.raw" -o "${output}"
+      COMMAND ${CMAKE_COMMAND} -E remove "${output}.raw"
+      DEPENDS "${src}"
+      COMMENT "SPIR-V ${output}"
+      VERBATIM
+    )
+  else()
+    add_custom_command(
+      OUTPUT "${output}"
+      COMMAND ${CMAKE_COMMAND} -E make_directory "${outDir}"
+      COMMAND "${AURORA_GLSLANG_VALIDATOR}" ${client} -g0 -S ${stage} -DAURORA_SPIRV=1 -o "${output}" "${src}"
+      DEPENDS "${src}"
+      COMMENT "SPIR-V ${output}"
+      VERBATIM
+    )
+  endif()
+endfunction()
+
+function(aurora_compile_shaders target)
+  cmake_parse_arguments(ARG "" "" "SOURCES" ${ARGN})
+  if(NOT AURORA_COMPILE_SHADERS OR NOT AURORA_GLSLANG_VALIDATOR)
+    return()
+  endif()
+
+  set(copies)
+  foreach(src IN LISTS ARG_SOURCES)
+    get_filename_component(src "${src}" ABSOLUTE)
+    file(RELATIVE_PATH rel "${CMAKE_SOURCE_DIR}" "${src}")
+    string(REGEX REPLACE "\\.glsl$" "" relBase "${rel}")
+    get_filename_component(stageExt "${relBase}" LAST_EXT)
+    string(SUBSTRING "${stageExt}" 1 -1 stage)
+    if(NOT stage MATCHES "^(vert|frag|comp)$")
+      message(FATAL_ERROR "aurora_compile_shaders: estágio desconhecido em ${rel} (esperado .vert/.frag/.comp.glsl)")
+    endif()
+
+    # Deduplicação entre alvos: o primeiro uso cria o alvo de compilação, os seguintes só dependem dele
+    string(MAKE_C_IDENTIFIER "aurora_spirv_${relBase}" spirvTarget)
+    set(glOut "${AURORA_SPIRV_DIR}/${relBase}.spv")
+    set(vkOut "${AURORA_SPIRV_DIR}/${relBase}.vk.spv")
+    if(NOT TARGET ${spirvTarget})
+      _aurora_spirv_rule("${src}" ${stage} -G "${glOut}")
+      _aurora_spirv_rule("${src}" ${stage} -V "${vkOut}")
+      add_custom_target(${spirvTarget} DEPENDS "${glOut}" "${vkOut}")
+    endif()
+    add_dependencies(${target} ${spirvTarget})
+
+    get_filename_component(glName "${glOut}" NAME)
+    get_filename_component(vkName "${vkOut}" NAME)
+    list(APPEND copies
+      COMMAND ${CMAKE_COMMAND} -E copy_if_different "${glOut}" "$<TARGET_FILE_DIR:${target}>/shaders/${glName}"
+      COMMAND ${CMAKE_COMMAND} -E copy_if_different "${vkOut}" "$<TARGET_FILE_DIR:${target}>/shaders/${vkName}")
+  endforeach()
+
+  add_custom_command(TARGET ${target} POST_BUILD
+    COMMAND ${CMAKE_COMMAND} -E make_directory "$<TARGET_FILE_DIR:${target}>/shaders"
+    ${copies}
+  )
+  target_compile_definitions(${target} PRIVATE AURORA_SHADER_BINARY_DIR="${AURORA_SPIRV_DIR}")
+endfunction()
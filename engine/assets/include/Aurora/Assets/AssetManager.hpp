@@ -4,6 +4,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace Aurora::Assets {
 
@@ -11,9 +12,14 @@ class AssetManager {
 public:
     explicit AssetManager(RHI::IDevice& device) : device_(device) {}
 
-    // Carrega um shader GLSL de um arquivo no disco com cache por caminho
+    // Carrega um shader GLSL de um arquivo no disco com cache por caminho (+ constantes de especialização)
     // Retorna um ponteiro não-proprietário. O AssetManager mantém a posse.
-    RHI::IShaderModule* getOrLoadShaderFromFile(RHI::ShaderStage stage, const std::string& path);
+    // Se o device aceita SPIR-V e existe o binário compilado offline (aurora_compile_shaders), ele é usado
+    // e o GLSL fica como fallback. Módulos de conteúdo idêntico são compartilhados entre caminhos.
+    RHI::IShaderModule* getOrLoadShaderFromFile(RHI::ShaderStage stage, const std::string& path,
+                                                const std::vector<RHI::SpecializationConstant>& specialization = {});
+    // Diretório extra de binários SPIR-V: procura <dir>/<path>.spv e <dir>/<nome>.spv (sem a extensão .glsl)
+    void addShaderBinaryDirectory(const std::string& dir) { shaderBinaryDirs_.push_back(dir); }
 
     // Carrega textura RGBA8 do disco (pixels fornecidos externamente neste estágio)
     // Forneceremos uma sobrecarga utilitária com leitura de arquivo em implementação
@@ -30,8 +36,9 @@ private:
     struct ShaderKey {
         RHI::ShaderStage stage;
         std::string path;
+        std::vector<RHI::SpecializationConstant> specialization;
         bool operator==(const ShaderKey& other) const {
-            return stage == other.stage && path == other.path;
+            return stage == other.stage && path == other.path && specialization == other.specialization;
         }
     };
 
@@ -39,12 +46,19 @@ private:
         size_t operator()(const ShaderKey& k) const {
             std::hash<std::string> hs;
             std::hash<int> hi;
-            return (hs(k.path) * 1315423911u) ^ hi(static_cast<int>(k.stage));
+            size_t h = (hs(k.path) * 1315423911u) ^ hi(static_cast<int>(k.stage));
+            for (const auto& c : k.specialization) h = (((h * 31u) ^ c.id) * 31u) ^ c.bits;
+            return h;
         }
     };
 
+    std::string findShaderBinary(const std::string& path) const;
+
     RHI::IDevice& device_;
-    std::unordered_map<ShaderKey, std::unique_ptr<RHI::IShaderModule>, ShaderKeyHash> shaderCache_;
+    // Caminho -> módulo; os módulos pertencem a shaderModules_, indexados pelo conteúdo (SPIR-V ou GLSL)
+    std::unordered_map<ShaderKey, RHI::IShaderModule*, ShaderKeyHash> shaderCache_;
+    std::unordered_map<std::string, std::unique_ptr<RHI::IShaderModule>> shaderModules_;
+    std::vector<std::string> shaderBinaryDirs_;
     std::unordered_map<std::string, std::unique_ptr<RHI::ITexture>> textureCache_;
     struct SamplerKeyHash {
         size_t operator()(const RHI::SamplerDesc& d) const {
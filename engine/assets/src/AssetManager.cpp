@@ -1,6 +1,9 @@
 #include "Aurora/Assets/AssetManager.hpp"
 #include "Aurora/Core/Log.hpp"
+#include "Aurora/Core/MemoryTracking.hpp"
 
+#include <cstring>
+#include <filesystem>
 #include <fstream>
 #include <sstream>
 #include <vector>
@@ -15,29 +18,96 @@ static std::string loadTextFile(const std::string& path) {
     return oss.str();
 }
 
-RHI::IShaderModule* AssetManager::getOrLoadShaderFromFile(RHI::ShaderStage stage, const std::string& path) {
-    ShaderKey key{stage, path};
+// Binário SPIR-V inteiro (múltiplo de 4 bytes e com o magic number); vazio se inválido
+static std::vector<uint32_t> loadSpirvFile(const std::string& path) {
+    std::ifstream ifs(path, std::ios::binary | std::ios::ate);
+    if (!ifs) return {};
+    const auto bytes = static_cast<size_t>(ifs.tellg());
+    if (bytes < 20 || bytes % 4 != 0) return {};
+    std::vector<uint32_t> words(bytes / 4);
+    ifs.seekg(0);
+    ifs.read(reinterpret_cast<char*>(words.data()), static_cast<std::streamsize>(bytes));
+    if (!ifs || words[0] != 0x07230203u) return {};
+    return words;
+}
+
+// foo.vert.glsl -> foo.vert.spv (alvo OpenGL) ou foo.vert.vk.spv (alvo Vulkan), ao lado do fonte ou
+// num diretório de binários (mesmo caminho relativo ou só o nome do arquivo)
+std::string AssetManager::findShaderBinary(const std::string& path) const {
+    namespace fs = std::filesystem;
+    const auto caps = device_.getCapabilities();
+    if (!caps.supportsSpirv) return {};
+    std::string base = path;
+    if (base.size() > 5 && base.compare(base.size() - 5, 5, ".glsl") == 0) base.resize(base.size() - 5);
+    const std::string binary = base + (caps.spirvVulkanTarget ? ".vk.spv" : ".spv");
+
+    std::error_code ec;
+    if (fs::is_regular_file(binary, ec)) return binary;
+    for (const auto& dir : shaderBinaryDirs_) {
+        const fs::path relative = fs::path(dir) / binary;
+        if (fs::path(binary).is_relative() && fs::is_regular_file(relative, ec)) return relative.string();
+        const fs::path byName = fs::path(dir) / fs::path(binary).filename();
+        if (fs::is_regular_file(byName, ec)) return byName.string();
+    }
+    return {};
+}
+
+RHI::IShaderModule* AssetManager::getOrLoadShaderFromFile(RHI::ShaderStage stage, const std::string& path,
+                                                          const std::vector<RHI::SpecializationConstant>& specialization) {
+    ShaderKey key{stage, path, specialization};
     auto it = shaderCache_.find(key);
-    if (it != shaderCache_.end()) return it->second.get();
+    if (it != shaderCache_.end()) return it->second;
+    Core::MemoryTagScope memoryTag(Core::MemoryTag::Assets);
 
+    // GLSL é opcional quando há binário (Vulkan); sem binário é obrigatório
     std::string src = loadTextFile(path);
-    if (src.empty()) {
+    std::vector<uint32_t> spirv;
+    const std::string binaryPath = findShaderBinary(path);
+    if (!binaryPath.empty()) {
+        spirv = loadSpirvFile(binaryPath);
+        if (spirv.empty()) Core::log(Core::LogLevel::Warn, std::string("AssetManager: SPIR-V inválido ") + binaryPath);
+    }
+    if (src.empty() && spirv.empty()) {
         Core::log(Core::LogLevel::Error, std::string("AssetManager: falha ao ler shader ") + path);
         return nullptr;
     }
-    RHI::ShaderModuleDesc desc{stage, src.c_str()};
+
+    // Deduplicação por conteúdo: estágio + constantes + SPIR-V (ou GLSL quando não há binário)
+    std::string contentKey(1, static_cast<char>(stage));
+    for (const auto& c : specialization) {
+        const uint32_t fields[3] = {c.id, static_cast<uint32_t>(c.type), c.bits};
+        contentKey.append(reinterpret_cast<const char*>(fields), sizeof(fields));
+    }
+    if (!spirv.empty()) contentKey.append(reinterpret_cast<const char*>(spirv.data()), spirv.size() * sizeof(uint32_t));
+    else contentKey += src;
+    auto shared = shaderModules_.find(contentKey);
+    if (shared != shaderModules_.end()) {
+        shaderCache_.emplace(std::move(key), shared->second.get());
+        return shared->second.get();
+    }
+
+    RHI::ShaderModuleDesc desc{};
+    desc.stage = stage;
+    desc.source = src.empty() ? nullptr : src.c_str();
+    if (!spirv.empty()) {
+        desc.spirv = spirv.data();
+        desc.spirvSize = spirv.size() * sizeof(uint32_t);
+    }
+    desc.specializationConstants = specialization;
     auto module = device_.createShaderModule(desc);
     if (!module) {
         Core::log(Core::LogLevel::Error, std::string("AssetManager: falha ao compilar shader ") + path);
         return nullptr;
     }
     RHI::IShaderModule* raw = module.get();
-    shaderCache_.emplace(std::move(key), std::move(module));
+    shaderModules_.emplace(std::move(contentKey), std::move(module));
+    shaderCache_.emplace(std::move(key), raw);
     return raw;
 }
 
 void AssetManager::clear() {
     shaderCache_.clear();
+    shaderModules_.clear();
     textureCache_.clear();
     samplerCache_.clear();
 }
@@ -79,6 +149,7 @@ static bool loadPPM(const std::string& path, uint32_t& outW, uint32_t& outH, std
 RHI::ITexture* AssetManager::getOrLoadTextureFromFile(const std::string& path) {
     auto it = textureCache_.find(path);
     if (it != textureCache_.end()) return it->second.get();
+    Core::MemoryTagScope memoryTag(Core::MemoryTag::Assets);
 
     uint32_t w=0,h=0; std::vector<unsigned char> pixels;
     if (!loadPPM(path, w, h, pixels)) {
@@ -99,6 +170,7 @@ RHI::ITexture* AssetManager::getOrLoadTextureFromFile(const std::string& path) {
 RHI::ISampler* AssetManager::getOrCreateSampler(const RHI::SamplerDesc& desc) {
     auto it = samplerCache_.find(desc);
     if (it != samplerCache_.end()) return it->second.get();
+    Core::MemoryTagScope memoryTag(Core::MemoryTag::Assets);
     auto smp = device_.createSampler(desc);
     RHI::ISampler* raw = smp.get();
     samplerCache_.emplace(desc, std::move(smp));
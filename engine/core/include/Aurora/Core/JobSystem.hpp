@@ -0,0 +1,130 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Aurora::Core {
+
+using JobFunction = void (*)(void* data);
+
+struct Job;  // interno do JobSystem (anel de jobs por thread)
+
+struct JobDecl {
+    JobFunction function{nullptr};
+    void* data{nullptr};
+};
+
+// Contador de conclusão: run() soma o número de jobs e cada job terminado subtrai um. Serve para esperar
+// (JobSystem::wait) e como dependência de outros jobs (liberados quando chega a zero). Precisa viver até
+// os jobs associados terminarem.
+class JobCounter {
+public:
+    JobCounter() = default;
+    JobCounter(const JobCounter&) = delete;
+    JobCounter& operator=(const JobCounter&) = delete;
+
+    uint32_t getValue() const { return value_.load(std::memory_order_acquire); }
+    // Zerado e sem signal() em andamento: a partir daí o contador pode ser destruído ou reutilizado
+    bool isDone() const { return getValue() == 0 && !lock_.test(std::memory_order_acquire); }
+
+private:
+    friend class JobSystem;
+
+    std::atomic<uint32_t> value_{0};
+    std::atomic_flag lock_ = ATOMIC_FLAG_INIT;  // protege waiting_ na transição para zero
+    Job* waiting_{nullptr};                     // jobs aguardando este contador zerar
+};
+
+enum class ThreadPriority : uint8_t { Low, Normal, High };
+
+struct JobSystemDesc {
+    uint32_t workerCount{0};            // 0 = núcleos lógicos - 1 (a thread dona participa nos wait())
+    bool pinWorkers{false};             // worker i (1..N) fixo na CPU i; a thread dona não é fixada
+    ThreadPriority workerPriority{ThreadPriority::Normal};
+};
+
+struct JobSystemStats {
+    uint64_t executedJobs{0};
+    uint64_t stolenJobs{0};
+    uint64_t inlineJobs{0};             // executados na submissão por falta de espaço no anel/deque
+};
+
+// Sistema de jobs com um worker por núcleo e deques Chase-Lev de roubo de trabalho: cada thread empilha e
+// desempilha na própria deque (LIFO, sem lock) e as ociosas roubam do topo das outras (FIFO). Threads
+// externas (fora do sistema) submetem numa fila com lock. Jobs são ponteiros de função + dado e ficam num
+// anel fixo por thread, sem alocação por job; com o anel cheio o job roda na hora (correto, só sem
+// paralelismo). wait() executa jobs pendentes enquanto o contador não zera, então a thread dona e os
+// próprios jobs podem esperar sem bloquear workers.
+// A thread que chama o construtor é a dona (índice 0). Destruir só sem jobs pendentes.
+class JobSystem {
+public:
+    static constexpr uint32_t kInvalidThreadIndex = 0xFFFFFFFFu;
+
+    explicit JobSystem(const JobSystemDesc& desc = {});
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    // Agenda os jobs; counter (opcional) recebe +count. Com dependency, os jobs só entram nas filas
+    // quando ela zerar.
+    void run(const JobDecl* jobs, uint32_t count, JobCounter* counter = nullptr, JobCounter* dependency = nullptr);
+    void run(const JobDecl& job, JobCounter* counter = nullptr, JobCounter* dependency = nullptr) {
+        run(&job, 1, counter, dependency);
+    }
+    // Executa outros jobs até o contador zerar
+    void wait(const JobCounter& counter);
+
+    // body(begin, end) em pedaços de grainSize itens (0 = automático: ~4 pedaços por thread) distribuídos
+    // dinamicamente entre os workers; a thread chamadora participa e retorna com tudo concluído
+    template <typename Body>
+    void parallelFor(uint32_t count, Body&& body, uint32_t grainSize = 0) {
+        if (!count) return;
+        auto* context = &body;
+        parallelFor(count, grainSize, [](void* ctx, uint32_t begin, uint32_t end) {
+            (*static_cast<decltype(context)>(ctx))(begin, end);
+        }, const_cast<void*>(static_cast<const void*>(context)));
+    }
+    void parallelFor(uint32_t count, uint32_t grainSize, void (*body)(void*, uint32_t, uint32_t), void* context);
+
+    uint32_t getWorkerCount() const { return static_cast<uint32_t>(workers_.size()); }
+    uint32_t getThreadCount() const { return threadCount_; }
+    // 0 = thread dona, 1..N = workers; kInvalidThreadIndex fora do sistema
+    uint32_t getCurrentThreadIndex() const;
+    JobSystemStats getStats() const;
+
+    // Afinidade/prioridade da thread chamadora (Linux e Windows; no-op nos demais). false se o SO recusar
+    static bool setCurrentThreadAffinity(uint32_t cpu);
+    static bool setCurrentThreadPriority(ThreadPriority priority);
+
+private:
+    struct ThreadState;
+
+    void workerMain(uint32_t index);
+    Job* allocateJob(ThreadState* thread, const JobDecl& decl, JobCounter* counter);
+    void schedule(Job* job);
+    void execute(Job* job);
+    void signal(JobCounter* counter);
+    bool tryRunOne(uint32_t index);
+    Job* stealFrom(uint32_t thief);
+    void wakeWorkers();
+
+    std::unique_ptr<ThreadState[]> threads_;   // 0 = dona, 1..N = workers
+    uint32_t threadCount_{0};
+    std::unique_ptr<ThreadState> external_;    // submissões de threads fora do sistema (com lock)
+    std::mutex externalMutex_;
+    std::vector<std::thread> workers_;
+
+    std::atomic<uint32_t> queuedJobs_{0};      // jobs nas filas ainda não iniciados
+    std::atomic<uint32_t> sleepingWorkers_{0};
+    std::atomic<bool> stop_{false};
+    std::mutex sleepMutex_;
+    std::condition_variable sleepCondition_;
+};
+
+}
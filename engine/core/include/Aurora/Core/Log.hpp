@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+#include <memory>
 #include <string>
 #include <string_view>
 #include <sstream>
@@ -16,10 +18,49 @@ enum class LogLevel {
     Critical
 };
 
-void initializeLogging();
+// Destino das linhas já formatadas ("[data hora] [NÍVEL] mensagem\n"). Chamado só pela thread do logger
+// (e pelo caminho de crash, com o logger parado), então a implementação não precisa de lock próprio.
+class ILogSink {
+public:
+    virtual ~ILogSink() = default;
+    virtual void write(LogLevel level, std::string_view line) = 0;
+    // Fim de cada lote drenado e em flushLogs()
+    virtual void flush() {}
+};
+
+struct LogDesc {
+    uint32_t ringCapacity{4096};        // registros de 256 bytes (arredondado para potência de dois)
+    LogLevel minLevel{LogLevel::Trace};
+    bool stderrSink{true};
+    bool installCrashHandler{true};     // SIGSEGV/SIGABRT/... (Windows: exceção não tratada) drenam o anel
+};
+
+struct LogStats {
+    uint64_t written{0};                // mensagens entregues aos sinks
+    uint64_t dropped{0};                // descartadas com o anel cheio
+    uint64_t truncated{0};              // maiores que o limite de um registro encadeado
+};
+
+// Logger assíncrono: log() copia a mensagem para registros de tamanho fixo num anel MPSC sem lock e
+// retorna; uma thread de fundo põe data/hora, formata e escreve nos sinks. Com o anel cheio, mensagens
+// abaixo de Error são descartadas na hora (contadas e avisadas depois) e Error/Critical esperam um tempo
+// limitado antes de descartar. Critical espera o flush antes de retornar.
+// Fora de initializeLogging()/shutdownLogging() log() escreve direto no stderr (síncrono).
+void initializeLogging(const LogDesc& desc = {});
+// Drena o que falta, para a thread e desinstala o handler de crash
 void shutdownLogging();
 
 void log(LogLevel level, std::string_view message);
+void setLogLevel(LogLevel minLevel);
+
+// Bloqueia até tudo que foi logado antes da chamada ter passado pelos sinks (e sink->flush())
+void flushLogs();
+
+// Sinks podem ser trocados a qualquer momento (valem a partir do próximo lote)
+void addLogSink(std::shared_ptr<ILogSink> sink);
+void removeLogSink(const ILogSink* sink);
+
+LogStats getLogStats();
 
 template <typename... Args>
 void logf(LogLevel level, std::string_view format, Args&&... args) {
@@ -30,5 +71,3 @@ void logf(LogLevel level, std::string_view format, Args&&... args) {
 }
 
 }
-
-
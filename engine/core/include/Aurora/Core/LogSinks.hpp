@@ -0,0 +1,52 @@
+#pragma once
+
+#include "Aurora/Core/Log.hpp"
+
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Aurora::Core {
+
+class StderrLogSink final : public ILogSink {
+public:
+    void write(LogLevel level, std::string_view line) override;
+    void flush() override;
+};
+
+// Arquivo truncado na abertura, com buffer grande (flush a cada lote do logger)
+class FileLogSink final : public ILogSink {
+public:
+    explicit FileLogSink(const std::string& path);
+    ~FileLogSink() override;
+
+    FileLogSink(const FileLogSink&) = delete;
+    FileLogSink& operator=(const FileLogSink&) = delete;
+
+    bool isOpen() const { return file_ != nullptr; }
+    void write(LogLevel level, std::string_view line) override;
+    void flush() override;
+
+private:
+    std::FILE* file_{nullptr};
+};
+
+// Últimas maxLines linhas em memória (console do editor, testes, relatório de crash). getLines() pode ser
+// chamado de qualquer thread.
+class MemoryLogSink final : public ILogSink {
+public:
+    explicit MemoryLogSink(size_t maxLines = 1024) : maxLines_(maxLines) {}
+
+    void write(LogLevel level, std::string_view line) override;
+    std::vector<std::string> getLines() const;
+    void clear();
+
+private:
+    mutable std::mutex mutex_;
+    std::deque<std::string> lines_;
+    size_t maxLines_;
+};
+
+}
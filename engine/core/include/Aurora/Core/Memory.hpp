@@ -0,0 +1,155 @@
+#pragma once
+
+#include "Aurora/Core/MemoryTracking.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace Aurora::Core {
+
+// Páginas do SO para blocos grandes (mmap/VirtualAlloc). hugePages tenta páginas grandes (Linux:
+// MAP_HUGETLB, com fallback para páginas normais + MADV_HUGEPAGE); o tamanho real vai em allocatedBytes
+// e é registrado na tag (a liberação precisa da mesma).
+void* allocatePages(size_t bytes, bool hugePages, size_t& allocatedBytes, MemoryTag tag = MemoryTag::Untagged);
+void releasePages(void* pages, size_t allocatedBytes, MemoryTag tag = MemoryTag::Untagged);
+
+// Arena linear (bump): alocar é avançar um offset e nada é liberado individualmente; reset() descarta
+// tudo. Quando o bloco atual enche, abre outro; no reset os blocos extras viram um só com a capacidade
+// total, então um uso estável por ciclo deixa de alocar após o primeiro. Os blocos entram na tag de memória
+// da thread no momento da construção. Não é thread-safe.
+class LinearArena {
+public:
+    explicit LinearArena(size_t initialBytes = 64 * 1024, bool hugePages = false);
+    ~LinearArena();
+
+    LinearArena(const LinearArena&) = delete;
+    LinearArena& operator=(const LinearArena&) = delete;
+
+    void* allocate(size_t bytes, size_t alignment = alignof(std::max_align_t));
+    template <typename T>
+    T* allocateArray(size_t count) { return static_cast<T*>(allocate(sizeof(T) * count, alignof(T))); }
+    void reset();
+
+    size_t getUsedBytes() const { return usedBefore_ + offset_; }
+    size_t getCapacity() const;
+    size_t getHighWaterBytes() const { return highWater_; }
+
+private:
+    struct Block {
+        std::byte* data;
+        size_t size;
+    };
+
+    bool addBlock(size_t minBytes);
+
+    std::vector<Block> blocks_;
+    size_t current_{0};
+    size_t offset_{0};
+    size_t usedBefore_{0};   // bytes dos blocos anteriores ao atual
+    size_t highWater_{0};
+    size_t initialBytes_;
+    bool hugePages_;
+    MemoryTag tag_;
+};
+
+struct FrameArenaStats {
+    size_t usedBytes{0};           // no frame atual
+    size_t capacityBytes{0};       // do bloco principal do frame atual
+    size_t highWaterBytes{0};
+    uint64_t overflowCount{0};     // alocações fora do bloco principal (desde a criação)
+};
+
+// Arena por frame em voo: beginFrame() passa para o próximo slot e o descarta inteiro, então o que foi
+// alocado vale até o frame ser reaproveitado (frames em voo depois). Alocação thread-safe e sem lock no
+// caminho comum (um fetch_add no bloco principal); estouros vão para uma arena extra com lock e, no
+// próximo uso do slot, o bloco principal cresce para caber o pico.
+// beginFrame() na thread dona, depois que o GPU liberou o slot (após IDevice::beginFrame) e sem alocações
+// concorrentes.
+class FrameArena {
+public:
+    FrameArena(uint32_t framesInFlight, size_t bytesPerFrame, bool hugePages = false);
+    ~FrameArena();
+
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    void beginFrame();
+    void* allocate(size_t bytes, size_t alignment = alignof(std::max_align_t));
+    template <typename T>
+    T* allocateArray(size_t count) { return static_cast<T*>(allocate(sizeof(T) * count, alignof(T))); }
+
+    FrameArenaStats getStats() const;
+
+private:
+    struct Slot {
+        std::byte* data{nullptr};
+        size_t size{0};
+        std::atomic<size_t> offset{0};
+        std::mutex overflowMutex;
+        std::unique_ptr<LinearArena> overflow;
+    };
+
+    bool resizeSlot(Slot& slot, size_t bytes);
+
+    std::unique_ptr<Slot[]> slots_;
+    uint32_t slotCount_;
+    uint32_t current_{0};
+    bool hugePages_;
+    MemoryTag tag_;
+    size_t highWater_{0};
+    std::atomic<uint64_t> overflowCount_{0};
+};
+
+// Pools de blocos de tamanho fixo por thread (classes de 16 a 512 bytes, potências de dois). Sem lock: cada
+// thread tem as suas listas livres; um bloco liberado em outra thread entra na lista dela (mesma classe).
+// A memória dos pools só volta ao SO no fim do processo. Acima de kMaxPoolBlockBytes usa operator new.
+// Os chunks entram na tag da thread que os criou.
+inline constexpr size_t kMaxPoolBlockBytes = 512;
+void* poolAllocate(size_t bytes);
+void poolDeallocate(void* block, size_t bytes);
+
+// Adaptadores std::pmr para containers da engine, ex.:
+//   std::pmr::vector<uint32_t> v(&frameResource);
+// A liberação na arena é no-op (a memória volta no reset/beginFrame).
+template <typename Arena>
+class ArenaResource final : public std::pmr::memory_resource {
+public:
+    explicit ArenaResource(Arena& arena) : arena_(arena) {}
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        void* p = arena_.allocate(bytes, alignment);
+        if (!p) throw std::bad_alloc();
+        return p;
+    }
+    void do_deallocate(void*, size_t, size_t) override {}
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+    Arena& arena_;
+};
+
+using LinearArenaResource = ArenaResource<LinearArena>;
+using FrameArenaResource = ArenaResource<FrameArena>;
+
+// Pools por thread; tamanhos/alinhamentos fora das classes vão para upstream
+class PoolResource final : public std::pmr::memory_resource {
+public:
+    explicit PoolResource(std::pmr::memory_resource* upstream = std::pmr::new_delete_resource()) : upstream_(upstream) {}
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return dynamic_cast<const PoolResource*>(&other) != nullptr;
+    }
+
+    std::pmr::memory_resource* upstream_;
+};
+
+}
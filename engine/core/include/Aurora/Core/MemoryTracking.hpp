@@ -0,0 +1,94 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Aurora::Core {
+
+// Subsistema dono de uma alocação. A tag da thread (MemoryTagScope) vale para o hook de operator new e
+// para as arenas criadas no escopo; os alocadores que registram por conta própria passam a tag explícita.
+enum class MemoryTag : uint8_t {
+    Untagged,
+    Core,
+    Jobs,
+    Log,
+    Platform,
+    RHI,
+    Assets,
+    Renderer,
+    Application,
+    Count
+};
+
+// Memória de GPU estimada pelos backends no createBuffer/createTexture (tamanho pedido, sem alinhamento
+// nem padding do driver)
+enum class GpuMemoryKind : uint8_t {
+    Buffer,
+    Texture,
+    RenderTarget,   // texturas RenderTarget/DepthStencil
+    Count
+};
+
+const char* getMemoryTagName(MemoryTag tag);
+const char* getGpuMemoryKindName(GpuMemoryKind kind);
+
+struct MemoryTagStats {
+    uint64_t liveBytes{0};
+    uint64_t liveAllocations{0};
+    uint64_t highWaterBytes{0};
+    uint64_t totalAllocations{0};       // desde o início do processo
+    uint64_t totalBytes{0};
+    uint64_t frameAllocations{0};       // no último frame fechado por memoryBeginFrame()
+    uint64_t frameBytes{0};
+    uint64_t peakFrameAllocations{0};
+};
+
+struct GpuMemoryStats {
+    uint64_t liveBytes{0};
+    uint64_t liveResources{0};
+    uint64_t highWaterBytes{0};
+};
+
+// Contadores atômicos por tag; thread-safe e sem alocação (podem ser chamados de dentro do operator new)
+void trackAllocation(MemoryTag tag, size_t bytes);
+void trackFree(MemoryTag tag, size_t bytes);
+void trackGpuAllocation(GpuMemoryKind kind, uint64_t bytes);
+void trackGpuFree(GpuMemoryKind kind, uint64_t bytes);
+
+MemoryTag getCurrentMemoryTag();
+
+// Troca a tag da thread até o fim do escopo
+class MemoryTagScope {
+public:
+    explicit MemoryTagScope(MemoryTag tag);
+    ~MemoryTagScope();
+
+    MemoryTagScope(const MemoryTagScope&) = delete;
+    MemoryTagScope& operator=(const MemoryTagScope&) = delete;
+
+private:
+    MemoryTag previous_;
+};
+
+// Fecha o frame: as contagens desde a chamada anterior viram frameAllocations/frameBytes. Uma vez por
+// frame, na thread principal.
+void memoryBeginFrame();
+uint64_t getMemoryFrameIndex();
+
+MemoryTagStats getMemoryStats(MemoryTag tag);
+GpuMemoryStats getGpuMemoryStats(GpuMemoryKind kind);
+
+// Hook global de operator new/delete (opção AURORA_MEMORY_NEW_HOOK do CMake): toda alocação do heap entra
+// na tag da thread. Sem o hook, só o que é registrado explicitamente (arenas, pools, GPU) aparece.
+bool isMemoryNewHookEnabled();
+
+// Amostragem de callstacks no hook: uma a cada everyNth alocações (0 desliga). As últimas amostras ficam
+// num anel fixo e saem no snapshot.
+void setAllocationSampling(uint32_t everyNth);
+
+// Snapshot JSON com chaves em ordem fixa (tags, GPU, amostras), para comparar entre builds com diff
+std::string getMemorySnapshotJson();
+bool writeMemorySnapshot(const std::string& path);
+
+}
@@ -0,0 +1,410 @@
+#include "Aurora/Core/JobSystem.hpp"
+#include "Aurora/Core/Log.hpp"
+#include "Aurora/Core/MemoryTracking.hpp"
+
+#include <algorithm>
+#include <string>
+
+#if defined(_WIN32)
+#  ifndef NOMINMAX
+#    define NOMINMAX
+#  endif
+#  ifndef WIN32_LEAN_AND_MEAN
+#    define WIN32_LEAN_AND_MEAN
+#  endif
+#  include <windows.h>
+#elif defined(__linux__)
+#  include <pthread.h>
+#  include <sched.h>
+#  include <sys/resource.h>
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#endif
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#  include <immintrin.h>
+#  define AURORA_CPU_RELAX() _mm_pause()
+#else
+#  define AURORA_CPU_RELAX() std::this_thread::yield()
+#endif
+
+namespace Aurora::Core {
+
+struct Job {
+    JobFunction function{nullptr};
+    void* data{nullptr};
+    JobCounter* counter{nullptr};
+    Job* next{nullptr};                    // lista de espera de uma dependência
+    std::atomic<bool> busy{false};         // slot do anel em uso até o job terminar
+};
+
+namespace {
+    // Potências de dois; o anel e a deque têm o mesmo tamanho, então os jobs da própria thread nunca
+    // estouram a deque
+    constexpr uint32_t kRingSize = 4096;
+    constexpr uint32_t kDequeSize = 4096;
+    constexpr uint32_t kSpinRounds = 64;   // tentativas sem trabalho antes de dormir/ceder a CPU
+    constexpr uint32_t kMaxParallelForJobs = 64;
+    constexpr uint32_t kChunksPerThread = 4;
+
+    thread_local const JobSystem* tlsSystem = nullptr;
+    thread_local uint32_t tlsIndex = JobSystem::kInvalidThreadIndex;
+
+    void lockCounter(std::atomic_flag& flag) {
+        while (flag.test_and_set(std::memory_order_acquire)) AURORA_CPU_RELAX();
+    }
+}
+
+struct alignas(64) JobSystem::ThreadState {
+    // Deque Chase-Lev de capacidade fixa (Lê et al., "Correct and Efficient Work-Stealing for Weak Memory
+    // Models"): push/pop só pela dona no fundo, steal por qualquer thread no topo
+    std::atomic<int64_t> top{0};
+    alignas(64) std::atomic<int64_t> bottom{0};
+    std::unique_ptr<std::atomic<Job*>[]> buffer{new std::atomic<Job*>[kDequeSize]};
+
+    std::unique_ptr<Job[]> ring{new Job[kRingSize]};
+    uint32_t nextJob{0};
+    uint32_t random{0};
+
+    std::atomic<uint64_t> executed{0};
+    std::atomic<uint64_t> stolen{0};
+    std::atomic<uint64_t> inlined{0};
+
+    bool push(Job* job) {
+        const int64_t b = bottom.load(std::memory_order_relaxed);
+        const int64_t t = top.load(std::memory_order_acquire);
+        if (b - t >= static_cast<int64_t>(kDequeSize)) return false;
+        buffer[b & (kDequeSize - 1)].store(job, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom.store(b + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    Job* pop() {
+        const int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+        bottom.store(b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t t = top.load(std::memory_order_relaxed);
+        if (t > b) {
+            bottom.store(b + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        Job* job = buffer[b & (kDequeSize - 1)].load(std::memory_order_relaxed);
+        if (t == b) {
+            // Último elemento: disputa com os ladrões pelo topo
+            if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) job = nullptr;
+            bottom.store(b + 1, std::memory_order_relaxed);
+        }
+        return job;
+    }
+
+    Job* steal() {
+        int64_t t = top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const int64_t b = bottom.load(std::memory_order_acquire);
+        if (t >= b) return nullptr;
+        Job* job = buffer[t & (kDequeSize - 1)].load(std::memory_order_relaxed);
+        if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) return nullptr;
+        return job;
+    }
+};
+
+JobSystem::JobSystem(const JobSystemDesc& desc) {
+    const uint32_t hw = std::max(1u, std::thread::hardware_concurrency());
+    const uint32_t workerCount = desc.workerCount ? desc.workerCount : hw - 1;
+    threadCount_ = workerCount + 1;
+    threads_.reset(new ThreadState[threadCount_]);
+    external_ = std::make_unique<ThreadState>();
+    for (uint32_t i = 0; i < threadCount_; ++i) threads_[i].random = 0x9E3779B9u * (i + 1);
+
+    tlsSystem = this;
+    tlsIndex = 0;
+    workers_.reserve(workerCount);
+    for (uint32_t i = 1; i <= workerCount; ++i) {
+        workers_.emplace_back([this, i, desc, hw]() {
+            if (desc.pinWorkers && !setCurrentThreadAffinity(i % hw)) {
+                Core::log(Core::LogLevel::Warn, "JobSystem: não foi possível fixar o worker " + std::to_string(i) + " na CPU");
+            }
+            if (desc.workerPriority != ThreadPriority::Normal && !setCurrentThreadPriority(desc.workerPriority)) {
+                Core::log(Core::LogLevel::Warn, "JobSystem: prioridade do worker " + std::to_string(i) + " recusada pelo SO");
+            }
+            workerMain(i);
+        });
+    }
+    Core::log(Core::LogLevel::Info, "JobSystem: " + std::to_string(workerCount) + " worker(s)");
+}
+
+JobSystem::~JobSystem() {
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex_);
+        stop_.store(true, std::memory_order_seq_cst);
+    }
+    sleepCondition_.notify_all();
+    for (auto& t : workers_) t.join();
+    if (tlsSystem == this) {
+        tlsSystem = nullptr;
+        tlsIndex = kInvalidThreadIndex;
+    }
+}
+
+uint32_t JobSystem::getCurrentThreadIndex() const {
+    return tlsSystem == this ? tlsIndex : kInvalidThreadIndex;
+}
+
+JobSystemStats JobSystem::getStats() const {
+    JobSystemStats stats{};
+    auto add = [&stats](const ThreadState& t) {
+        stats.executedJobs += t.executed.load(std::memory_order_relaxed);
+        stats.stolenJobs += t.stolen.load(std::memory_order_relaxed);
+        stats.inlineJobs += t.inlined.load(std::memory_order_relaxed);
+    };
+    for (uint32_t i = 0; i < threadCount_; ++i) add(threads_[i]);
+    add(*external_);
+    return stats;
+}
+
+void JobSystem::workerMain(uint32_t index) {
+    tlsSystem = this;
+    tlsIndex = index;
+    MemoryTagScope memoryTag(MemoryTag::Jobs);
+#if defined(__linux__)
+    const std::string name = "AuroraJob" + std::to_string(index);
+    pthread_setname_np(pthread_self(), name.substr(0, 15).c_str());
+#endif
+    uint32_t idle = 0;
+    while (!stop_.load(std::memory_order_acquire)) {
+        if (tryRunOne(index)) {
+            idle = 0;
+            continue;
+        }
+        if (++idle < kSpinRounds) {
+            AURORA_CPU_RELAX();
+            continue;
+        }
+        // Dorme até haver job nas filas; o contador seq_cst de dorminhocos fecha a corrida com wakeWorkers()
+        sleepingWorkers_.fetch_add(1, std::memory_order_seq_cst);
+        {
+            std::unique_lock<std::mutex> lock(sleepMutex_);
+            sleepCondition_.wait(lock, [this] {
+                return queuedJobs_.load(std::memory_order_seq_cst) > 0 || stop_.load(std::memory_order_seq_cst);
+            });
+        }
+        sleepingWorkers_.fetch_sub(1, std::memory_order_relaxed);
+        idle = 0;
+    }
+}
+
+void JobSystem::wakeWorkers() {
+    if (sleepingWorkers_.load(std::memory_order_seq_cst) == 0) return;
+    { std::lock_guard<std::mutex> lock(sleepMutex_); }
+    sleepCondition_.notify_all();
+}
+
+Job* JobSystem::allocateJob(ThreadState* thread, const JobDecl& decl, JobCounter* counter) {
+    Job& job = thread->ring[thread->nextJob & (kRingSize - 1)];
+    // Slot ainda em uso: o anel deu a volta sobre um job não terminado
+    if (job.busy.load(std::memory_order_acquire)) return nullptr;
+    ++thread->nextJob;
+    job.function = decl.function;
+    job.data = decl.data;
+    job.counter = counter;
+    job.next = nullptr;
+    job.busy.store(true, std::memory_order_relaxed);
+    return &job;
+}
+
+void JobSystem::schedule(Job* job) {
+    queuedJobs_.fetch_add(1, std::memory_order_seq_cst);
+    bool pushed;
+    ThreadState* inlineState;
+    if (tlsSystem == this) {
+        inlineState = &threads_[tlsIndex];
+        pushed = inlineState->push(job);
+    } else {
+        std::lock_guard<std::mutex> lock(externalMutex_);
+        inlineState = external_.get();
+        pushed = inlineState->push(job);
+    }
+    if (!pushed) {
+        queuedJobs_.fetch_sub(1, std::memory_order_relaxed);
+        inlineState->inlined.fetch_add(1, std::memory_order_relaxed);
+        execute(job);
+    }
+}
+
+void JobSystem::run(const JobDecl* jobs, uint32_t count, JobCounter* counter, JobCounter* dependency) {
+    if (!count) return;
+    if (counter) counter->value_.fetch_add(count, std::memory_order_acq_rel);
+    const bool internal = tlsSystem == this;
+    ThreadState* self = internal ? &threads_[tlsIndex] : external_.get();
+    for (uint32_t i = 0; i < count; ++i) {
+        Job* job;
+        if (internal) {
+            job = allocateJob(self, jobs[i], counter);
+        } else {
+            std::lock_guard<std::mutex> lock(externalMutex_);
+            job = allocateJob(self, jobs[i], counter);
+        }
+        if (!job) {
+            // Anel cheio: roda agora (depois da dependência, se houver)
+            if (dependency) wait(*dependency);
+            self->inlined.fetch_add(1, std::memory_order_relaxed);
+            jobs[i].function(jobs[i].data);
+            if (counter) signal(counter);
+            continue;
+        }
+        if (dependency) {
+            lockCounter(dependency->lock_);
+            if (dependency->value_.load(std::memory_order_acquire) > 0) {
+                job->next = dependency->waiting_;
+                dependency->waiting_ = job;
+                job = nullptr;
+            }
+            dependency->lock_.clear(std::memory_order_release);
+            if (!job) continue;
+        }
+        schedule(job);
+    }
+    wakeWorkers();
+}
+
+void JobSystem::execute(Job* job) {
+    job->function(job->data);
+    JobCounter* counter = job->counter;
+    job->busy.store(false, std::memory_order_release);
+    ThreadState& self = tlsSystem == this ? threads_[tlsIndex] : *external_;
+    self.executed.fetch_add(1, std::memory_order_relaxed);
+    if (counter) signal(counter);
+}
+
+void JobSystem::signal(JobCounter* counter) {
+    // O lock cobre o decremento: quem espera só considera o contador livre (e pode destruí-lo) depois
+    // que o último job solta o lock
+    lockCounter(counter->lock_);
+    Job* released = nullptr;
+    if (counter->value_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        released = counter->waiting_;
+        counter->waiting_ = nullptr;
+    }
+    counter->lock_.clear(std::memory_order_release);
+    if (!released) return;
+    while (released) {
+        Job* next = released->next;
+        schedule(released);
+        released = next;
+    }
+    wakeWorkers();
+}
+
+Job* JobSystem::stealFrom(uint32_t thief) {
+    // Vítimas em ordem a partir de uma posição pseudoaleatória; a fila externa é a última posição
+    const uint32_t victims = threadCount_ + 1;
+    uint32_t start = 0;
+    if (thief != kInvalidThreadIndex) {
+        uint32_t& r = threads_[thief].random;
+        r ^= r << 13; r ^= r >> 17; r ^= r << 5;
+        start = r % victims;
+    }
+    for (uint32_t k = 0; k < victims; ++k) {
+        const uint32_t v = (start + k) % victims;
+        if (v == thief) continue;
+        ThreadState& victim = v < threadCount_ ? threads_[v] : *external_;
+        if (Job* job = victim.steal()) return job;
+    }
+    return nullptr;
+}
+
+bool JobSystem::tryRunOne(uint32_t index) {
+    Job* job = index != kInvalidThreadIndex ? threads_[index].pop() : nullptr;
+    if (!job) {
+        job = stealFrom(index);
+        if (!job) return false;
+        ThreadState& self = index != kInvalidThreadIndex ? threads_[index] : *external_;
+        self.stolen.fetch_add(1, std::memory_order_relaxed);
+    }
+    queuedJobs_.fetch_sub(1, std::memory_order_relaxed);
+    execute(job);
+    return true;
+}
+
+void JobSystem::wait(const JobCounter& counter) {
+    const uint32_t index = getCurrentThreadIndex();
+    uint32_t idle = 0;
+    while (!counter.isDone()) {
+        if (tryRunOne(index)) {
+            idle = 0;
+            continue;
+        }
+        if (++idle < kSpinRounds) AURORA_CPU_RELAX();
+        else std::this_thread::yield();
+    }
+}
+
+void JobSystem::parallelFor(uint32_t count, uint32_t grainSize, void (*body)(void*, uint32_t, uint32_t), void* context) {
+    if (!count) return;
+    const uint32_t grain = grainSize ? grainSize
+        : std::max(1u, (count + threadCount_ * kChunksPerThread - 1) / (threadCount_ * kChunksPerThread));
+    const uint32_t chunks = (count + grain - 1) / grain;
+    const uint32_t helpers = std::min({chunks - 1, getWorkerCount(), kMaxParallelForJobs});
+    if (!helpers) {
+        body(context, 0, count);
+        return;
+    }
+
+    // Os pedaços são distribuídos por um índice atômico: cada job (e a thread chamadora) pega o próximo
+    // até acabar, então pedaços lentos não prendem os demais a uma divisão estática
+    struct Shared {
+        void (*body)(void*, uint32_t, uint32_t);
+        void* context;
+        uint32_t count;
+        uint32_t grain;
+        uint32_t chunks;
+        std::atomic<uint32_t> next{0};
+    } shared{body, context, count, grain, chunks};
+    auto drain = [](void* data) {
+        auto& s = *static_cast<Shared*>(data);
+        for (uint32_t c = s.next.fetch_add(1, std::memory_order_relaxed); c < s.chunks;
+             c = s.next.fetch_add(1, std::memory_order_relaxed)) {
+            s.body(s.context, c * s.grain, std::min(s.count, (c + 1) * s.grain));
+        }
+    };
+    JobDecl decls[kMaxParallelForJobs];
+    for (uint32_t i = 0; i < helpers; ++i) decls[i] = {drain, &shared};
+    JobCounter counter;
+    run(decls, helpers, &counter);
+    drain(&shared);
+    wait(counter);
+}
+
+bool JobSystem::setCurrentThreadAffinity(uint32_t cpu) {
+#if defined(_WIN32)
+    if (cpu >= sizeof(DWORD_PTR) * 8) return false;
+    return SetThreadAffinityMask(GetCurrentThread(), static_cast<DWORD_PTR>(1) << cpu) != 0;
+#elif defined(__linux__)
+    if (cpu >= CPU_SETSIZE) return false;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    (void)cpu;
+    return true;
+#endif
+}
+
+bool JobSystem::setCurrentThreadPriority(ThreadPriority priority) {
+#if defined(_WIN32)
+    const int value = priority == ThreadPriority::Low ? THREAD_PRIORITY_BELOW_NORMAL
+                    : priority == ThreadPriority::High ? THREAD_PRIORITY_ABOVE_NORMAL : THREAD_PRIORITY_NORMAL;
+    return SetThreadPriority(GetCurrentThread(), value) != 0;
+#elif defined(__linux__)
+    // No Linux o nice vale por thread (tid); subir a prioridade (nice < 0) exige CAP_SYS_NICE
+    const int nice = priority == ThreadPriority::Low ? 10 : priority == ThreadPriority::High ? -5 : 0;
+    return setpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)), nice) == 0;
+#else
+    (void)priority;
+    return true;
+#endif
+}
+
+}
@@ -1,15 +1,95 @@
 #include "Aurora/Core/Log.hpp"
+#include "Aurora/Core/LogSinks.hpp"
+#include "Aurora/Core/MemoryTracking.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <bit>
 #include <chrono>
+#include <csignal>
 #include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <iterator>
 #include <mutex>
-#include <sstream>
-#include <iomanip>
+#include <thread>
+#include <vector>
+
+#if defined(_WIN32)
+#  ifndef NOMINMAX
+#    define NOMINMAX
+#  endif
+#  ifndef WIN32_LEAN_AND_MEAN
+#    define WIN32_LEAN_AND_MEAN
+#  endif
+#  include <windows.h>
+#else
+#  include <unistd.h>
+#  if defined(__linux__)
+#    include <pthread.h>
+#  endif
+#endif
 
 namespace Aurora::Core {
 
 namespace {
-    std::mutex g_logMutex;
+    constexpr size_t kSlotBytes = 256;
+    constexpr uint32_t kMaxChunks = 16;                   // mensagem máxima ~3.7 KB; acima disso é truncada
+    constexpr auto kBlockingWait = std::chrono::milliseconds(2);
+    constexpr auto kCrashDrainWait = std::chrono::milliseconds(100);
+
+    // Registro do anel (Vyukov): sequence == posição quando livre, posição + 1 quando publicado. Uma
+    // mensagem longa ocupa chunkCount slots consecutivos, reservados juntos; só o primeiro leva o cabeçalho.
+    struct alignas(64) LogSlot {
+        std::atomic<uint64_t> sequence{0};
+        int64_t timestampNs{0};
+        uint8_t level{0};
+        uint8_t chunkCount{1};
+        uint16_t length{0};       // bytes de texto neste slot
+        uint32_t reserved{0};
+        char text[kSlotBytes - 24];
+    };
+    static_assert(sizeof(LogSlot) == kSlotBytes);
+    constexpr size_t kSlotTextBytes = sizeof(LogSlot::text);
+    constexpr size_t kMaxLineBytes = 48 + kMaxChunks * kSlotTextBytes;
+
+    struct LoggerState {
+        // Anel: alocado no primeiro initializeLogging e nunca liberado (produtores atrasados no shutdown
+        // continuam escrevendo em memória válida)
+        std::unique_ptr<LogSlot[]> slots;
+        uint64_t mask{0};
+        alignas(64) std::atomic<uint64_t> enqueuePos{0};
+        alignas(64) uint64_t dequeuePos{0};                 // só o consumidor (thread ou crash)
+        std::atomic<uint64_t> consumedPos{0};               // publicado após os sinks: base do flushLogs
+        std::atomic<uint32_t> wakeups{0};
+
+        std::atomic<bool> running{false};
+        std::atomic<bool> stop{false};
+        std::atomic<bool> draining{false};                  // dono do consumo (thread de fundo ou crash)
+        std::atomic<int> minLevel{static_cast<int>(LogLevel::Trace)};
+        std::thread thread;
+
+        std::mutex sinksMutex;
+        std::vector<std::shared_ptr<ILogSink>> sinks;
+
+        std::atomic<uint64_t> written{0};
+        std::atomic<uint64_t> dropped{0};
+        std::atomic<uint64_t> truncated{0};
+        uint64_t reportedDrops{0};
+
+        // Fuso local em segundos, recalculado pela thread a cada minuto (o caminho de crash só lê)
+        std::atomic<int64_t> utcOffsetSeconds{0};
+        int64_t offsetMinute{INT64_MIN};
+
+        char message[kMaxChunks * kSlotTextBytes];
+        char line[kMaxLineBytes];
+    };
+
+    // Nunca destruído: logs em destrutores estáticos e threads ainda vivas no exit continuam válidos
+    LoggerState& state() {
+        static LoggerState* s = new LoggerState();
+        return *s;
+    }
 
     const char* toString(LogLevel level) {
         switch (level) {
@@ -22,29 +102,390 @@ namespace {
             default: return "?";
         }
     }
-}
 
-void initializeLogging() {}
-void shutdownLogging() {}
+    int64_t nowNs() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    }
 
-void log(LogLevel level, std::string_view message) {
-    std::scoped_lock lock(g_logMutex);
+    // Calendário civil sem localtime (H. Hinnant): usado na formatação e no caminho de crash
+    int64_t daysFromCivil(int64_t y, unsigned m, unsigned d) {
+        y -= m <= 2;
+        const int64_t era = (y >= 0 ? y : y - 399) / 400;
+        const unsigned yoe = static_cast<unsigned>(y - era * 400);
+        const unsigned doy = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + d - 1;
+        const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+        return era * 146097 + static_cast<int64_t>(doe) - 719468;
+    }
 
-    auto now = std::chrono::system_clock::now();
-    auto t_c = std::chrono::system_clock::to_time_t(now);
-    std::tm tm_buf{};
+    void civilFromDays(int64_t z, int64_t& y, unsigned& m, unsigned& d) {
+        z += 719468;
+        const int64_t era = (z >= 0 ? z : z - 146096) / 146097;
+        const unsigned doe = static_cast<unsigned>(z - era * 146097);
+        const unsigned yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+        const unsigned doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+        const unsigned mp = (5 * doy + 2) / 153;
+        d = doy - (153 * mp + 2) / 5 + 1;
+        m = mp < 10 ? mp + 3 : mp - 9;
+        y = static_cast<int64_t>(yoe) + era * 400 + (m <= 2);
+    }
+
+    void refreshUtcOffset(LoggerState& s, int64_t seconds) {
+        const int64_t minute = seconds / 60;
+        if (minute == s.offsetMinute) return;
+        s.offsetMinute = minute;
+        const std::time_t t = static_cast<std::time_t>(seconds);
+        std::tm tm{};
 #if defined(_WIN32)
-    localtime_s(&tm_buf, &t_c);
+        localtime_s(&tm, &t);
 #else
-    localtime_r(&t_c, &tm_buf);
+        localtime_r(&t, &tm);
 #endif
+        const int64_t local = daysFromCivil(tm.tm_year + 1900, static_cast<unsigned>(tm.tm_mon + 1), static_cast<unsigned>(tm.tm_mday)) * 86400
+                            + tm.tm_hour * 3600 + tm.tm_min * 60 + tm.tm_sec;
+        s.utcOffsetSeconds.store(local - seconds, std::memory_order_relaxed);
+    }
+
+    void putDigits(char*& out, int64_t value, int width) {
+        for (int i = width - 1; i >= 0; --i) {
+            out[i] = static_cast<char>('0' + value % 10);
+            value /= 10;
+        }
+        out += width;
+    }
+
+    // "[AAAA-MM-DD HH:MM:SS] [NÍVEL] mensagem\n" sem alocação; devolve o tamanho
+    size_t formatLine(char* out, int64_t timestampNs, int64_t utcOffset, LogLevel level, const char* message, size_t length) {
+        char* p = out;
+        int64_t local = timestampNs / 1000000000 + utcOffset;
+        int64_t days = local / 86400;
+        int64_t secs = local % 86400;
+        if (secs < 0) { secs += 86400; --days; }
+        int64_t y = 0; unsigned m = 0, d = 0;
+        civilFromDays(days, y, m, d);
+        *p++ = '[';
+        putDigits(p, y, 4); *p++ = '-'; putDigits(p, m, 2); *p++ = '-'; putDigits(p, d, 2); *p++ = ' ';
+        putDigits(p, secs / 3600, 2); *p++ = ':'; putDigits(p, (secs / 60) % 60, 2); *p++ = ':'; putDigits(p, secs % 60, 2);
+        *p++ = ']'; *p++ = ' '; *p++ = '[';
+        const char* name = toString(level);
+        const size_t nameLength = std::strlen(name);
+        std::memcpy(p, name, nameLength);
+        p += nameLength;
+        *p++ = ']'; *p++ = ' ';
+        std::memcpy(p, message, length);
+        p += length;
+        *p++ = '\n';
+        return static_cast<size_t>(p - out);
+    }
+
+    void writeToSinks(LoggerState& s, LogLevel level, std::string_view line) {
+        for (const auto& sink : s.sinks) sink->write(level, line);
+    }
+
+    // Consome o que já foi publicado; exige draining. Retorna quantas mensagens entregou.
+    // crashPath: sem localtime e sem esperar mensagens incompletas (para no primeiro registro parcial).
+    uint32_t drainPublished(LoggerState& s, bool crashPath) {
+        uint32_t delivered = 0;
+        for (;;) {
+            LogSlot& head = s.slots[s.dequeuePos & s.mask];
+            if (head.sequence.load(std::memory_order_acquire) != s.dequeuePos + 1) break;
+            const uint32_t chunks = head.chunkCount;
+            // Os demais slots da mesma mensagem podem estar sendo escritos neste instante. No crash o
+            // produtor pode ter morrido no meio da cópia (ou ser a própria thread do handler): não espera.
+            bool complete = true;
+            for (uint32_t c = 1; c < chunks && complete; ++c) {
+                const LogSlot& slot = s.slots[(s.dequeuePos + c) & s.mask];
+                while (slot.sequence.load(std::memory_order_acquire) != s.dequeuePos + c + 1) {
+                    if (crashPath) { complete = false; break; }
+                    std::this_thread::yield();
+                }
+            }
+            if (!complete) break;
+            size_t length = 0;
+            for (uint32_t c = 0; c < chunks; ++c) {
+                const LogSlot& slot = s.slots[(s.dequeuePos + c) & s.mask];
+                std::memcpy(s.message + length, slot.text, slot.length);
+                length += slot.length;
+            }
+            const int64_t timestamp = head.timestampNs;
+            const auto level = static_cast<LogLevel>(head.level);
+            for (uint32_t c = 0; c < chunks; ++c) {
+                s.slots[(s.dequeuePos + c) & s.mask].sequence.store(s.dequeuePos + c + s.mask + 1, std::memory_order_release);
+            }
+            s.dequeuePos += chunks;
+
+            if (!crashPath) refreshUtcOffset(s, timestamp / 1000000000);
+            const size_t lineLength = formatLine(s.line, timestamp, s.utcOffsetSeconds.load(std::memory_order_relaxed), level, s.message, length);
+            writeToSinks(s, level, std::string_view(s.line, lineLength));
+            ++delivered;
+        }
+        const uint64_t drops = s.dropped.load(std::memory_order_relaxed);
+        if (drops != s.reportedDrops) {
+            char notice[96];
+            const int n = std::snprintf(notice, sizeof(notice), "Log: %llu mensagens descartadas (anel cheio)",
+                                        static_cast<unsigned long long>(drops - s.reportedDrops));
+            s.reportedDrops = drops;
+            const size_t lineLength = formatLine(s.line, nowNs(), s.utcOffsetSeconds.load(std::memory_order_relaxed), LogLevel::Warn, notice, static_cast<size_t>(std::max(n, 0)));
+            writeToSinks(s, LogLevel::Warn, std::string_view(s.line, lineLength));
+        }
+        if (delivered) s.written.fetch_add(delivered, std::memory_order_relaxed);
+        return delivered;
+    }
+
+    void publishConsumed(LoggerState& s) {
+        s.consumedPos.store(s.dequeuePos, std::memory_order_release);
+        s.consumedPos.notify_all();
+    }
+
+    void loggerThread() {
+        LoggerState& s = state();
+        MemoryTagScope memoryTag(MemoryTag::Log);
+#if defined(__linux__)
+        pthread_setname_np(pthread_self(), "AuroraLog");
+#endif
+        for (;;) {
+            const uint32_t seen = s.wakeups.load(std::memory_order_acquire);
+            bool idle = false;
+            {
+                bool expected = false;
+                if (s.draining.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+                    std::lock_guard<std::mutex> lock(s.sinksMutex);
+                    if (drainPublished(s, false)) {
+                        for (const auto& sink : s.sinks) sink->flush();
+                    }
+                    idle = s.slots[s.dequeuePos & s.mask].sequence.load(std::memory_order_acquire) != s.dequeuePos + 1;
+                    publishConsumed(s);
+                    s.draining.store(false, std::memory_order_release);
+                }
+            }
+            if (s.stop.load(std::memory_order_acquire) && idle) break;
+            if (idle) s.wakeups.wait(seen, std::memory_order_acquire);
+        }
+    }
+
+    void wake(LoggerState& s) {
+        s.wakeups.fetch_add(1, std::memory_order_release);
+        s.wakeups.notify_one();
+    }
+
+    // Reserva count slots consecutivos; false com o anel cheio
+    bool reserve(LoggerState& s, uint32_t count, uint64_t& position) {
+        uint64_t pos = s.enqueuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            // O consumo é em ordem: se o último slot está livre, os anteriores também estão
+            const uint64_t last = pos + count - 1;
+            const uint64_t seq = s.slots[last & s.mask].sequence.load(std::memory_order_acquire);
+            const int64_t diff = static_cast<int64_t>(seq) - static_cast<int64_t>(last);
+            if (diff == 0) {
+                if (s.enqueuePos.compare_exchange_weak(pos, pos + count, std::memory_order_relaxed)) {
+                    position = pos;
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = s.enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    void logSynchronous(LogLevel level, std::string_view message) {
+        static std::mutex fallbackMutex;
+        LoggerState& s = state();
+        char line[kMaxLineBytes];
+        const size_t length = std::min(message.size(), kMaxChunks * kSlotTextBytes);
+        const int64_t timestamp = nowNs();
+        std::lock_guard<std::mutex> lock(fallbackMutex);
+        refreshUtcOffset(s, timestamp / 1000000000);
+        const size_t lineLength = formatLine(line, timestamp, s.utcOffsetSeconds.load(std::memory_order_relaxed), level, message.data(), length);
+        std::fwrite(line, 1, lineLength, stderr);
+    }
 
-    std::ostringstream oss;
-    oss << std::put_time(&tm_buf, "%Y-%m-%d %H:%M:%S");
+    // ---- Caminho de crash ----
 
-    std::fprintf(stderr, "[%s] [%s] %.*s\n", oss.str().c_str(), toString(level), (int)message.size(), message.data());
+    void emergencyDrain() {
+        LoggerState& s = state();
+        if (!s.slots) return;
+        // A thread de fundo pode estar no meio de um lote: espera um tempo limitado pelo consumo
+        const auto deadline = std::chrono::steady_clock::now() + kCrashDrainWait;
+        bool expected = false;
+        while (!s.draining.compare_exchange_weak(expected, true, std::memory_order_acquire)) {
+            expected = false;
+            if (std::chrono::steady_clock::now() > deadline) return;
+            std::this_thread::yield();
+        }
+        if (s.sinksMutex.try_lock()) {
+            drainPublished(s, true);
+            for (const auto& sink : s.sinks) sink->flush();
+            s.sinksMutex.unlock();
+        }
+        std::fflush(stderr);
+        // Mantém draining: a thread de fundo não volta a consumir durante o encerramento
+    }
+
+#if defined(_WIN32)
+    LPTOP_LEVEL_EXCEPTION_FILTER gPreviousFilter = nullptr;
+
+    LONG WINAPI crashFilter(EXCEPTION_POINTERS* info) {
+        emergencyDrain();
+        return gPreviousFilter ? gPreviousFilter(info) : EXCEPTION_CONTINUE_SEARCH;
+    }
+
+    void installCrashHandler() { gPreviousFilter = SetUnhandledExceptionFilter(crashFilter); }
+    void removeCrashHandler() { SetUnhandledExceptionFilter(gPreviousFilter); gPreviousFilter = nullptr; }
+#else
+    constexpr int kCrashSignals[] = {SIGSEGV, SIGBUS, SIGFPE, SIGILL, SIGABRT};
+    struct sigaction gPreviousActions[std::size(kCrashSignals)];
+    bool gCrashHandlerInstalled = false;
+
+    void crashSignal(int sig) {
+        emergencyDrain();
+        // Restaura o tratamento anterior e re-emite: core dump / handler do sistema seguem normais
+        for (size_t i = 0; i < std::size(kCrashSignals); ++i) {
+            if (kCrashSignals[i] == sig) sigaction(sig, &gPreviousActions[i], nullptr);
+        }
+        raise(sig);
+    }
+
+    void installCrashHandler() {
+        struct sigaction action{};
+        action.sa_handler = crashSignal;
+        sigemptyset(&action.sa_mask);
+        action.sa_flags = SA_RESETHAND;
+        for (size_t i = 0; i < std::size(kCrashSignals); ++i) sigaction(kCrashSignals[i], &action, &gPreviousActions[i]);
+        gCrashHandlerInstalled = true;
+    }
+
+    void removeCrashHandler() {
+        if (!gCrashHandlerInstalled) return;
+        for (size_t i = 0; i < std::size(kCrashSignals); ++i) sigaction(kCrashSignals[i], &gPreviousActions[i], nullptr);
+        gCrashHandlerInstalled = false;
+    }
+#endif
+}
+
+void initializeLogging(const LogDesc& desc) {
+    LoggerState& s = state();
+    if (s.running.load(std::memory_order_acquire)) return;
+    if (!s.slots) {
+        const uint64_t capacity = std::bit_ceil(std::max<uint64_t>(desc.ringCapacity, 2 * kMaxChunks));
+        MemoryTagScope memoryTag(MemoryTag::Log);
+        s.slots.reset(new LogSlot[capacity]);
+        s.mask = capacity - 1;
+        for (uint64_t i = 0; i < capacity; ++i) s.slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    s.minLevel.store(static_cast<int>(desc.minLevel), std::memory_order_relaxed);
+    if (desc.stderrSink) addLogSink(std::make_shared<StderrLogSink>());
+    s.stop.store(false, std::memory_order_relaxed);
+    s.draining.store(false, std::memory_order_relaxed);
+    s.thread = std::thread(loggerThread);
+    if (desc.installCrashHandler) installCrashHandler();
+    s.running.store(true, std::memory_order_release);
+}
+
+void shutdownLogging() {
+    LoggerState& s = state();
+    if (!s.running.exchange(false, std::memory_order_acq_rel)) return;
+    removeCrashHandler();
+    s.stop.store(true, std::memory_order_release);
+    wake(s);
+    if (s.thread.joinable()) s.thread.join();
+    std::lock_guard<std::mutex> lock(s.sinksMutex);
+    for (const auto& sink : s.sinks) sink->flush();
+    s.sinks.clear();
 }
 
+void log(LogLevel level, std::string_view message) {
+    LoggerState& s = state();
+    if (static_cast<int>(level) < s.minLevel.load(std::memory_order_relaxed)) return;
+    if (!s.running.load(std::memory_order_acquire)) {
+        MemoryTagScope memoryTag(MemoryTag::Log);
+        logSynchronous(level, message);
+        return;
+    }
+
+    size_t length = message.size();
+    if (length > kMaxChunks * kSlotTextBytes) {
+        length = kMaxChunks * kSlotTextBytes;
+        s.truncated.fetch_add(1, std::memory_order_relaxed);
+    }
+    const uint32_t chunks = std::max<uint32_t>(1, static_cast<uint32_t>((length + kSlotTextBytes - 1) / kSlotTextBytes));
+
+    uint64_t position = 0;
+    if (!reserve(s, chunks, position)) {
+        // Descarte limitado: abaixo de Error na hora; Error/Critical esperam o consumidor por um tempo curto
+        bool reserved = false;
+        if (level >= LogLevel::Error) {
+            const auto deadline = std::chrono::steady_clock::now() + kBlockingWait;
+            while (!reserved && std::chrono::steady_clock::now() < deadline) {
+                wake(s);
+                std::this_thread::yield();
+                reserved = reserve(s, chunks, position);
+            }
+        }
+        if (!reserved) {
+            s.dropped.fetch_add(1, std::memory_order_relaxed);
+            wake(s);
+            return;
+        }
+    }
+
+    const int64_t timestamp = nowNs();
+    for (uint32_t c = 0; c < chunks; ++c) {
+        LogSlot& slot = s.slots[(position + c) & s.mask];
+        const size_t offset = static_cast<size_t>(c) * kSlotTextBytes;
+        const size_t bytes = std::min(kSlotTextBytes, length - offset);
+        std::memcpy(slot.text, message.data() + offset, bytes);
+        slot.length = static_cast<uint16_t>(bytes);
+        slot.timestampNs = timestamp;
+        slot.level = static_cast<uint8_t>(level);
+        slot.chunkCount = static_cast<uint8_t>(chunks);
+        slot.sequence.store(position + c + 1, std::memory_order_release);
+    }
+    wake(s);
+    if (level == LogLevel::Critical) flushLogs();
+}
+
+void setLogLevel(LogLevel minLevel) {
+    state().minLevel.store(static_cast<int>(minLevel), std::memory_order_relaxed);
+}
+
+void flushLogs() {
+    LoggerState& s = state();
+    if (!s.running.load(std::memory_order_acquire)) {
+        std::fflush(stderr);
+        return;
+    }
+    // Posição reservada até aqui: as mensagens desta thread já publicadas estão antes dela
+    const uint64_t target = s.enqueuePos.load(std::memory_order_acquire);
+    wake(s);
+    uint64_t consumed = s.consumedPos.load(std::memory_order_acquire);
+    while (consumed < target) {
+        if (!s.running.load(std::memory_order_acquire)) return;
+        s.consumedPos.wait(consumed, std::memory_order_acquire);
+        consumed = s.consumedPos.load(std::memory_order_acquire);
+    }
 }
 
+void addLogSink(std::shared_ptr<ILogSink> sink) {
+    if (!sink) return;
+    LoggerState& s = state();
+    std::lock_guard<std::mutex> lock(s.sinksMutex);
+    s.sinks.push_back(std::move(sink));
+}
 
+void removeLogSink(const ILogSink* sink) {
+    LoggerState& s = state();
+    std::lock_guard<std::mutex> lock(s.sinksMutex);
+    s.sinks.erase(std::remove_if(s.sinks.begin(), s.sinks.end(), [sink](const auto& p) { return p.get() == sink; }), s.sinks.end());
+}
+
+LogStats getLogStats() {
+    const LoggerState& s = state();
+    LogStats stats{};
+    stats.written = s.written.load(std::memory_order_relaxed);
+    stats.dropped = s.dropped.load(std::memory_order_relaxed);
+    stats.truncated = s.truncated.load(std::memory_order_relaxed);
+    return stats;
+}
+
+}
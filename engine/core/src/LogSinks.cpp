@@ -0,0 +1,52 @@
+#include "Aurora/Core/LogSinks.hpp"
+
+namespace Aurora::Core {
+
+void StderrLogSink::write(LogLevel, std::string_view line) {
+    std::fwrite(line.data(), 1, line.size(), stderr);
+}
+
+void StderrLogSink::flush() {
+    std::fflush(stderr);
+}
+
+FileLogSink::FileLogSink(const std::string& path) {
+    file_ = std::fopen(path.c_str(), "wb");
+    if (!file_) {
+        // Ainda sem este sink: o aviso vai para os demais
+        log(LogLevel::Error, "Log: falha ao abrir " + path);
+        return;
+    }
+    std::setvbuf(file_, nullptr, _IOFBF, 64 * 1024);
+}
+
+FileLogSink::~FileLogSink() {
+    if (file_) std::fclose(file_);
+}
+
+void FileLogSink::write(LogLevel, std::string_view line) {
+    if (file_) std::fwrite(line.data(), 1, line.size(), file_);
+}
+
+void FileLogSink::flush() {
+    if (file_) std::fflush(file_);
+}
+
+void MemoryLogSink::write(LogLevel, std::string_view line) {
+    if (!line.empty() && line.back() == '\n') line.remove_suffix(1);
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (lines_.size() >= maxLines_ && !lines_.empty()) lines_.pop_front();
+    lines_.emplace_back(line);
+}
+
+std::vector<std::string> MemoryLogSink::getLines() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return {lines_.begin(), lines_.end()};
+}
+
+void MemoryLogSink::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    lines_.clear();
+}
+
+}
@@ -0,0 +1,317 @@
+#include "Aurora/Core/Memory.hpp"
+#include "Aurora/Core/Log.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstdlib>
+
+#if defined(_WIN32)
+#  ifndef NOMINMAX
+#    define NOMINMAX
+#  endif
+#  ifndef WIN32_LEAN_AND_MEAN
+#    define WIN32_LEAN_AND_MEAN
+#  endif
+#  include <windows.h>
+#elif defined(__linux__)
+#  include <sys/mman.h>
+#  include <unistd.h>
+#endif
+
+namespace Aurora::Core {
+
+namespace {
+    constexpr size_t kHugePageBytes = 2 * 1024 * 1024;
+    constexpr size_t kPoolChunkBytes = 64 * 1024;
+    constexpr size_t kPoolChunkAlignment = 64;
+    constexpr uint32_t kPoolClassCount = 6;        // 16, 32, ..., 512
+
+    size_t alignUp(size_t value, size_t alignment) { return (value + alignment - 1) & ~(alignment - 1); }
+
+    void logHugePagesUnavailable() {
+        static std::atomic<bool> logged{false};
+        if (!logged.exchange(true)) {
+            Core::log(Core::LogLevel::Info, "Memória: páginas grandes indisponíveis, usando páginas normais");
+        }
+    }
+
+    // Chunks dos pools por thread: um bloco pode ser liberado em outra thread (e reaproveitado por ela),
+    // então nenhum chunk pertence a uma thread e todos vivem até o fim do processo
+    struct PoolChunkRegistry {
+        std::mutex mutex;
+        std::vector<void*> chunks;
+        ~PoolChunkRegistry() {
+            for (void* c : chunks) ::operator delete(c, std::align_val_t(kPoolChunkAlignment));
+        }
+    };
+
+    PoolChunkRegistry& chunkRegistry() {
+        static PoolChunkRegistry registry;
+        return registry;
+    }
+
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    struct ThreadPools {
+        FreeBlock* free[kPoolClassCount]{};
+    };
+
+    thread_local ThreadPools tlsPools;
+
+    uint32_t poolClass(size_t bytes) {
+        return static_cast<uint32_t>(std::bit_width((bytes - 1) | 15u)) - 4;
+    }
+
+    size_t poolClassBytes(uint32_t cls) { return size_t{16} << cls; }
+}
+
+static void* allocateOsPages(size_t bytes, bool hugePages, size_t& allocatedBytes) {
+#if defined(_WIN32)
+    if (hugePages) {
+        // Exige o privilégio SeLockMemoryPrivilege; sem ele cai para páginas normais
+        const size_t large = GetLargePageMinimum();
+        if (large) {
+            const size_t size = alignUp(bytes, large);
+            if (void* p = VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE)) {
+                allocatedBytes = size;
+                return p;
+            }
+        }
+        logHugePagesUnavailable();
+    }
+    void* p = VirtualAlloc(nullptr, bytes, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+    if (p) allocatedBytes = bytes;
+    return p;
+#elif defined(__linux__)
+    if (hugePages) {
+        // Páginas reservadas (vm.nr_hugepages); sem elas, páginas normais com THP sugerido
+        const size_t size = alignUp(bytes, kHugePageBytes);
+        void* p = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (p != MAP_FAILED) {
+            allocatedBytes = size;
+            return p;
+        }
+    }
+    const size_t size = alignUp(bytes, hugePages ? kHugePageBytes : static_cast<size_t>(sysconf(_SC_PAGESIZE)));
+    void* p = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (p == MAP_FAILED) return nullptr;
+    if (hugePages && madvise(p, size, MADV_HUGEPAGE) != 0) logHugePagesUnavailable();
+    allocatedBytes = size;
+    return p;
+#else
+    if (hugePages) logHugePagesUnavailable();
+    const size_t size = alignUp(bytes, 4096);
+    void* p = std::aligned_alloc(4096, size);
+    if (p) allocatedBytes = size;
+    return p;
+#endif
+}
+
+static void releaseOsPages(void* pages, size_t allocatedBytes) {
+#if defined(_WIN32)
+    (void)allocatedBytes;
+    VirtualFree(pages, 0, MEM_RELEASE);
+#elif defined(__linux__)
+    munmap(pages, allocatedBytes);
+#else
+    (void)allocatedBytes;
+    std::free(pages);
+#endif
+}
+
+void* allocatePages(size_t bytes, bool hugePages, size_t& allocatedBytes, MemoryTag tag) {
+    allocatedBytes = 0;
+    if (!bytes) return nullptr;
+    void* p = allocateOsPages(bytes, hugePages, allocatedBytes);
+    if (p) trackAllocation(tag, allocatedBytes);
+    return p;
+}
+
+void releasePages(void* pages, size_t allocatedBytes, MemoryTag tag) {
+    if (!pages) return;
+    trackFree(tag, allocatedBytes);
+    releaseOsPages(pages, allocatedBytes);
+}
+
+// ---- LinearArena ----
+
+LinearArena::LinearArena(size_t initialBytes, bool hugePages)
+    : initialBytes_(std::max<size_t>(initialBytes, 4096)), hugePages_(hugePages), tag_(getCurrentMemoryTag()) {}
+
+LinearArena::~LinearArena() {
+    for (const Block& b : blocks_) releasePages(b.data, b.size, tag_);
+}
+
+size_t LinearArena::getCapacity() const {
+    size_t total = 0;
+    for (const Block& b : blocks_) total += b.size;
+    return total;
+}
+
+bool LinearArena::addBlock(size_t minBytes) {
+    const size_t previous = blocks_.empty() ? 0 : blocks_.back().size * 2;
+    const size_t wanted = std::max({initialBytes_, previous, minBytes});
+    size_t size = 0;
+    auto* data = static_cast<std::byte*>(allocatePages(wanted, hugePages_, size, tag_));
+    if (!data) {
+        Core::log(Core::LogLevel::Error, "LinearArena: falha ao alocar " + std::to_string(wanted) + " bytes");
+        return false;
+    }
+    blocks_.push_back({data, size});
+    return true;
+}
+
+void* LinearArena::allocate(size_t bytes, size_t alignment) {
+    if (!blocks_.empty()) {
+        Block& b = blocks_[current_];
+        const size_t start = alignUp(reinterpret_cast<uintptr_t>(b.data) + offset_, alignment) - reinterpret_cast<uintptr_t>(b.data);
+        if (start + bytes <= b.size) {
+            offset_ = start + bytes;
+            highWater_ = std::max(highWater_, getUsedBytes());
+            return b.data + start;
+        }
+    }
+    // Os blocos só crescem no fim durante um ciclo: o atual é sempre o último
+    if (!addBlock(bytes + alignment)) return nullptr;
+    usedBefore_ += offset_;
+    current_ = blocks_.size() - 1;
+    offset_ = 0;
+    return allocate(bytes, alignment);
+}
+
+void LinearArena::reset() {
+    if (blocks_.size() > 1) {
+        // Consolida: o próximo ciclo com o mesmo pico cabe num bloco só
+        const size_t total = getCapacity();
+        for (const Block& b : blocks_) releasePages(b.data, b.size, tag_);
+        blocks_.clear();
+        addBlock(total);
+    }
+    current_ = 0;
+    offset_ = 0;
+    usedBefore_ = 0;
+}
+
+// ---- FrameArena ----
+
+FrameArena::FrameArena(uint32_t framesInFlight, size_t bytesPerFrame, bool hugePages)
+    : slotCount_(std::max(1u, framesInFlight)), hugePages_(hugePages), tag_(getCurrentMemoryTag()) {
+    slots_.reset(new Slot[slotCount_]);
+    for (uint32_t i = 0; i < slotCount_; ++i) resizeSlot(slots_[i], bytesPerFrame);
+}
+
+FrameArena::~FrameArena() {
+    for (uint32_t i = 0; i < slotCount_; ++i) releasePages(slots_[i].data, slots_[i].size, tag_);
+}
+
+bool FrameArena::resizeSlot(Slot& slot, size_t bytes) {
+    releasePages(slot.data, slot.size, tag_);
+    slot.data = static_cast<std::byte*>(allocatePages(std::max<size_t>(bytes, 4096), hugePages_, slot.size, tag_));
+    if (!slot.data) {
+        slot.size = 0;
+        Core::log(Core::LogLevel::Error, "FrameArena: falha ao alocar " + std::to_string(bytes) + " bytes");
+        return false;
+    }
+    return true;
+}
+
+void FrameArena::beginFrame() {
+    highWater_ = std::max(highWater_, getStats().usedBytes);
+    current_ = (current_ + 1) % slotCount_;
+    Slot& slot = slots_[current_];
+    if (slot.overflow) {
+        // Da última vez o slot estourou: o bloco principal passa a caber o pico com folga
+        const size_t needed = slot.size + slot.overflow->getHighWaterBytes();
+        slot.overflow.reset();
+        resizeSlot(slot, needed + needed / 4);
+    }
+    slot.offset.store(0, std::memory_order_relaxed);
+}
+
+void* FrameArena::allocate(size_t bytes, size_t alignment) {
+    Slot& slot = slots_[current_];
+    // Reserva o pior caso de alinhamento: um fetch_add sem retry mesmo com várias threads
+    const size_t reserved = bytes + alignment - 1;
+    const size_t offset = slot.offset.fetch_add(reserved, std::memory_order_relaxed);
+    if (offset + reserved <= slot.size) {
+        return reinterpret_cast<void*>(alignUp(reinterpret_cast<uintptr_t>(slot.data) + offset, alignment));
+    }
+    overflowCount_.fetch_add(1, std::memory_order_relaxed);
+    std::lock_guard<std::mutex> lock(slot.overflowMutex);
+    if (!slot.overflow) slot.overflow = std::make_unique<LinearArena>(std::max(slot.size / 2, reserved), hugePages_);
+    return slot.overflow->allocate(bytes, alignment);
+}
+
+FrameArenaStats FrameArena::getStats() const {
+    const Slot& slot = slots_[current_];
+    FrameArenaStats stats{};
+    stats.usedBytes = std::min(slot.offset.load(std::memory_order_relaxed), slot.size)
+                    + (slot.overflow ? slot.overflow->getUsedBytes() : 0);
+    stats.capacityBytes = slot.size;
+    stats.highWaterBytes = std::max(highWater_, stats.usedBytes);
+    stats.overflowCount = overflowCount_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+// ---- Pools por thread ----
+
+void* poolAllocate(size_t bytes) {
+    if (bytes > kMaxPoolBlockBytes) return ::operator new(bytes, std::nothrow);
+    const uint32_t cls = poolClass(bytes ? bytes : 1);
+    FreeBlock*& head = tlsPools.free[cls];
+    if (!head) {
+        void* chunk = ::operator new(kPoolChunkBytes, std::align_val_t(kPoolChunkAlignment), std::nothrow);
+        if (!chunk) return nullptr;
+        {
+            PoolChunkRegistry& registry = chunkRegistry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            registry.chunks.push_back(chunk);
+        }
+        // Com o hook de operator new o chunk já foi contado
+        if (!isMemoryNewHookEnabled()) trackAllocation(getCurrentMemoryTag(), kPoolChunkBytes);
+        const size_t blockBytes = poolClassBytes(cls);
+        auto* base = static_cast<std::byte*>(chunk);
+        for (size_t off = kPoolChunkBytes; off >= blockBytes; off -= blockBytes) {
+            auto* block = reinterpret_cast<FreeBlock*>(base + off - blockBytes);
+            block->next = head;
+            head = block;
+        }
+    }
+    FreeBlock* block = head;
+    head = block->next;
+    return block;
+}
+
+void poolDeallocate(void* block, size_t bytes) {
+    if (!block) return;
+    if (bytes > kMaxPoolBlockBytes) {
+        ::operator delete(block);
+        return;
+    }
+    FreeBlock*& head = tlsPools.free[poolClass(bytes ? bytes : 1)];
+    auto* freed = static_cast<FreeBlock*>(block);
+    freed->next = head;
+    head = freed;
+}
+
+void* PoolResource::do_allocate(size_t bytes, size_t alignment) {
+    // Blocos de uma classe estão alinhados ao próprio tamanho até o alinhamento do chunk
+    if (bytes > kMaxPoolBlockBytes || alignment > std::min(poolClassBytes(poolClass(bytes ? bytes : 1)), kPoolChunkAlignment)) {
+        return upstream_->allocate(bytes, alignment);
+    }
+    void* p = poolAllocate(bytes);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+void PoolResource::do_deallocate(void* p, size_t bytes, size_t alignment) {
+    if (bytes > kMaxPoolBlockBytes || alignment > std::min(poolClassBytes(poolClass(bytes ? bytes : 1)), kPoolChunkAlignment)) {
+        upstream_->deallocate(p, bytes, alignment);
+        return;
+    }
+    poolDeallocate(p, bytes);
+}
+
+}
@@ -0,0 +1,449 @@
+#include "Aurora/Core/MemoryTracking.hpp"
+#include "Aurora/Core/Log.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <new>
+
+#if defined(_WIN32)
+#  ifndef NOMINMAX
+#    define NOMINMAX
+#  endif
+#  ifndef WIN32_LEAN_AND_MEAN
+#    define WIN32_LEAN_AND_MEAN
+#  endif
+#  include <windows.h>
+#  include <malloc.h>
+#elif defined(__linux__) || defined(__APPLE__)
+#  include <execinfo.h>
+#  define AURORA_HAS_EXECINFO 1
+#endif
+
+namespace Aurora::Core {
+
+namespace {
+    constexpr size_t kTagCount = static_cast<size_t>(MemoryTag::Count);
+    constexpr size_t kGpuKindCount = static_cast<size_t>(GpuMemoryKind::Count);
+    constexpr uint32_t kSampleCapacity = 256;
+    constexpr uint32_t kSampleFrames = 16;
+
+    // Tudo com inicialização constante: o hook pode rodar antes de qualquer construtor estático
+    struct TagCounters {
+        std::atomic<uint64_t> liveBytes{0};
+        std::atomic<uint64_t> liveAllocations{0};
+        std::atomic<uint64_t> highWaterBytes{0};
+        std::atomic<uint64_t> totalAllocations{0};
+        std::atomic<uint64_t> totalBytes{0};
+        // Fechamento de frame (escrito só em memoryBeginFrame)
+        std::atomic<uint64_t> frameStartAllocations{0};
+        std::atomic<uint64_t> frameStartBytes{0};
+        std::atomic<uint64_t> frameAllocations{0};
+        std::atomic<uint64_t> frameBytes{0};
+        std::atomic<uint64_t> peakFrameAllocations{0};
+    };
+
+    struct GpuCounters {
+        std::atomic<uint64_t> liveBytes{0};
+        std::atomic<uint64_t> liveResources{0};
+        std::atomic<uint64_t> highWaterBytes{0};
+    };
+
+    // Amostra de callstack: sequence ímpar durante a escrita (o leitor descarta amostras em escrita ou
+    // sobrescritas no meio da leitura)
+    struct AllocationSample {
+        std::atomic<uint32_t> sequence{0};
+        uint64_t frame{0};
+        uint64_t bytes{0};
+        MemoryTag tag{MemoryTag::Untagged};
+        uint32_t depth{0};
+        void* frames[kSampleFrames]{};
+    };
+
+    TagCounters gTags[kTagCount];
+    GpuCounters gGpu[kGpuKindCount];
+    AllocationSample gSamples[kSampleCapacity];
+    std::atomic<uint64_t> gSampleCursor{0};
+    std::atomic<uint64_t> gSampleTick{0};
+    std::atomic<uint32_t> gSampleEvery{0};
+    std::atomic<uint64_t> gFrameIndex{0};
+
+    thread_local MemoryTag tlsTag = MemoryTag::Untagged;
+
+    void raiseHighWater(std::atomic<uint64_t>& highWater, uint64_t value) {
+        uint64_t current = highWater.load(std::memory_order_relaxed);
+        while (value > current && !highWater.compare_exchange_weak(current, value, std::memory_order_relaxed)) {}
+    }
+
+    TagCounters& counters(MemoryTag tag) {
+        const size_t index = static_cast<size_t>(tag);
+        return gTags[index < kTagCount ? index : 0];
+    }
+
+#if defined(AURORA_MEMORY_NEW_HOOK)
+    thread_local bool tlsInHook = false;
+
+    void sampleAllocation(MemoryTag tag, size_t bytes) {
+        const uint32_t every = gSampleEvery.load(std::memory_order_relaxed);
+        if (!every || gSampleTick.fetch_add(1, std::memory_order_relaxed) % every != 0) return;
+        AllocationSample& s = gSamples[gSampleCursor.fetch_add(1, std::memory_order_relaxed) % kSampleCapacity];
+        const uint32_t seq = s.sequence.load(std::memory_order_relaxed);
+        s.sequence.store(seq | 1u, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        s.frame = gFrameIndex.load(std::memory_order_relaxed);
+        s.bytes = bytes;
+        s.tag = tag;
+#if defined(_WIN32)
+        s.depth = CaptureStackBackTrace(2, kSampleFrames, s.frames, nullptr);
+#elif defined(AURORA_HAS_EXECINFO)
+        s.depth = static_cast<uint32_t>(std::max(0, backtrace(s.frames, static_cast<int>(kSampleFrames))));
+#else
+        s.depth = 0;
+#endif
+        s.sequence.store((seq | 1u) + 1, std::memory_order_release);
+    }
+#endif
+
+    void appendJsonString(std::string& out, const char* text) {
+        out += '"';
+        for (const char* c = text; *c; ++c) {
+            if (*c == '"' || *c == '\\') out += '\\';
+            if (static_cast<unsigned char>(*c) < 0x20) { out += ' '; continue; }
+            out += *c;
+        }
+        out += '"';
+    }
+
+    void appendField(std::string& out, const char* name, uint64_t value, bool last = false) {
+        out += '"';
+        out += name;
+        out += "\": ";
+        out += std::to_string(value);
+        if (!last) out += ", ";
+    }
+
+    void appendCallstack(std::string& out, void* const* frames, uint32_t depth) {
+        out += '[';
+#if defined(AURORA_HAS_EXECINFO)
+        char** symbols = depth ? backtrace_symbols(frames, static_cast<int>(depth)) : nullptr;
+#endif
+        for (uint32_t i = 0; i < depth; ++i) {
+            if (i) out += ", ";
+#if defined(AURORA_HAS_EXECINFO)
+            if (symbols) { appendJsonString(out, symbols[i]); continue; }
+#endif
+            char address[32];
+            std::snprintf(address, sizeof(address), "%p", frames[i]);
+            appendJsonString(out, address);
+        }
+#if defined(AURORA_HAS_EXECINFO)
+        std::free(symbols);
+#endif
+        out += ']';
+    }
+}
+
+const char* getMemoryTagName(MemoryTag tag) {
+    switch (tag) {
+        case MemoryTag::Untagged: return "Untagged";
+        case MemoryTag::Core: return "Core";
+        case MemoryTag::Jobs: return "Jobs";
+        case MemoryTag::Log: return "Log";
+        case MemoryTag::Platform: return "Platform";
+        case MemoryTag::RHI: return "RHI";
+        case MemoryTag::Assets: return "Assets";
+        case MemoryTag::Renderer: return "Renderer";
+        case MemoryTag::Application: return "Application";
+        case MemoryTag::Count: break;
+    }
+    return "Unknown";
+}
+
+const char* getGpuMemoryKindName(GpuMemoryKind kind) {
+    switch (kind) {
+        case GpuMemoryKind::Buffer: return "Buffer";
+        case GpuMemoryKind::Texture: return "Texture";
+        case GpuMemoryKind::RenderTarget: return "RenderTarget";
+        case GpuMemoryKind::Count: break;
+    }
+    return "Unknown";
+}
+
+void trackAllocation(MemoryTag tag, size_t bytes) {
+    TagCounters& c = counters(tag);
+    const uint64_t live = c.liveBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    c.liveAllocations.fetch_add(1, std::memory_order_relaxed);
+    c.totalAllocations.fetch_add(1, std::memory_order_relaxed);
+    c.totalBytes.fetch_add(bytes, std::memory_order_relaxed);
+    raiseHighWater(c.highWaterBytes, live);
+}
+
+void trackFree(MemoryTag tag, size_t bytes) {
+    TagCounters& c = counters(tag);
+    c.liveBytes.fetch_sub(bytes, std::memory_order_relaxed);
+    c.liveAllocations.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void trackGpuAllocation(GpuMemoryKind kind, uint64_t bytes) {
+    if (kind >= GpuMemoryKind::Count) return;
+    GpuCounters& c = gGpu[static_cast<size_t>(kind)];
+    const uint64_t live = c.liveBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    c.liveResources.fetch_add(1, std::memory_order_relaxed);
+    raiseHighWater(c.highWaterBytes, live);
+}
+
+void trackGpuFree(GpuMemoryKind kind, uint64_t bytes) {
+    if (kind >= GpuMemoryKind::Count) return;
+    GpuCounters& c = gGpu[static_cast<size_t>(kind)];
+    c.liveBytes.fetch_sub(bytes, std::memory_order_relaxed);
+    c.liveResources.fetch_sub(1, std::memory_order_relaxed);
+}
+
+MemoryTag getCurrentMemoryTag() { return tlsTag; }
+
+MemoryTagScope::MemoryTagScope(MemoryTag tag) : previous_(tlsTag) { tlsTag = tag; }
+MemoryTagScope::~MemoryTagScope() { tlsTag = previous_; }
+
+void memoryBeginFrame() {
+    for (TagCounters& c : gTags) {
+        const uint64_t allocations = c.totalAllocations.load(std::memory_order_relaxed);
+        const uint64_t bytes = c.totalBytes.load(std::memory_order_relaxed);
+        const uint64_t frameAllocations = allocations - c.frameStartAllocations.load(std::memory_order_relaxed);
+        c.frameAllocations.store(frameAllocations, std::memory_order_relaxed);
+        c.frameBytes.store(bytes - c.frameStartBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        raiseHighWater(c.peakFrameAllocations, frameAllocations);
+        c.frameStartAllocations.store(allocations, std::memory_order_relaxed);
+        c.frameStartBytes.store(bytes, std::memory_order_relaxed);
+    }
+    gFrameIndex.fetch_add(1, std::memory_order_relaxed);
+}
+
+uint64_t getMemoryFrameIndex() { return gFrameIndex.load(std::memory_order_relaxed); }
+
+MemoryTagStats getMemoryStats(MemoryTag tag) {
+    const TagCounters& c = counters(tag);
+    MemoryTagStats s{};
+    s.liveBytes = c.liveBytes.load(std::memory_order_relaxed);
+    s.liveAllocations = c.liveAllocations.load(std::memory_order_relaxed);
+    s.highWaterBytes = c.highWaterBytes.load(std::memory_order_relaxed);
+    s.totalAllocations = c.totalAllocations.load(std::memory_order_relaxed);
+    s.totalBytes = c.totalBytes.load(std::memory_order_relaxed);
+    s.frameAllocations = c.frameAllocations.load(std::memory_order_relaxed);
+    s.frameBytes = c.frameBytes.load(std::memory_order_relaxed);
+    s.peakFrameAllocations = c.peakFrameAllocations.load(std::memory_order_relaxed);
+    return s;
+}
+
+GpuMemoryStats getGpuMemoryStats(GpuMemoryKind kind) {
+    if (kind >= GpuMemoryKind::Count) return {};
+    const GpuCounters& c = gGpu[static_cast<size_t>(kind)];
+    GpuMemoryStats s{};
+    s.liveBytes = c.liveBytes.load(std::memory_order_relaxed);
+    s.liveResources = c.liveResources.load(std::memory_order_relaxed);
+    s.highWaterBytes = c.highWaterBytes.load(std::memory_order_relaxed);
+    return s;
+}
+
+bool isMemoryNewHookEnabled() {
+#if defined(AURORA_MEMORY_NEW_HOOK)
+    return true;
+#else
+    return false;
+#endif
+}
+
+void setAllocationSampling(uint32_t everyNth) {
+    if (everyNth && !isMemoryNewHookEnabled()) {
+        Core::log(Core::LogLevel::Warn, "Memória: amostragem de callstacks exige AURORA_MEMORY_NEW_HOOK");
+    }
+    gSampleEvery.store(everyNth, std::memory_order_relaxed);
+}
+
+std::string getMemorySnapshotJson() {
+    MemoryTagScope scope(MemoryTag::Core);
+    std::string out;
+    out.reserve(16 * 1024);
+    out += "{\n  ";
+    appendField(out, "frame", getMemoryFrameIndex());
+    out += "\"newHook\": ";
+    out += isMemoryNewHookEnabled() ? "true" : "false";
+    out += ",\n  \"tags\": {";
+
+    MemoryTagStats total{};
+    for (size_t i = 0; i < kTagCount; ++i) {
+        const MemoryTagStats s = getMemoryStats(static_cast<MemoryTag>(i));
+        total.liveBytes += s.liveBytes;
+        total.liveAllocations += s.liveAllocations;
+        total.highWaterBytes += s.highWaterBytes;
+        total.totalAllocations += s.totalAllocations;
+        total.totalBytes += s.totalBytes;
+        total.frameAllocations += s.frameAllocations;
+        total.frameBytes += s.frameBytes;
+        out += i ? ",\n    " : "\n    ";
+        appendJsonString(out, getMemoryTagName(static_cast<MemoryTag>(i)));
+        out += ": {";
+        appendField(out, "liveBytes", s.liveBytes);
+        appendField(out, "liveAllocations", s.liveAllocations);
+        appendField(out, "highWaterBytes", s.highWaterBytes);
+        appendField(out, "totalAllocations", s.totalAllocations);
+        appendField(out, "totalBytes", s.totalBytes);
+        appendField(out, "frameAllocations", s.frameAllocations);
+        appendField(out, "frameBytes", s.frameBytes);
+        appendField(out, "peakFrameAllocations", s.peakFrameAllocations, true);
+        out += '}';
+    }
+    // Soma dos picos por tag (os picos não são simultâneos): limite superior do pico global
+    out += "\n  },\n  \"total\": {";
+    appendField(out, "liveBytes", total.liveBytes);
+    appendField(out, "liveAllocations", total.liveAllocations);
+    appendField(out, "highWaterBytesUpperBound", total.highWaterBytes);
+    appendField(out, "totalAllocations", total.totalAllocations);
+    appendField(out, "totalBytes", total.totalBytes);
+    appendField(out, "frameAllocations", total.frameAllocations);
+    appendField(out, "frameBytes", total.frameBytes, true);
+    out += "},\n  \"gpu\": {";
+
+    for (size_t i = 0; i < kGpuKindCount; ++i) {
+        const GpuMemoryStats s = getGpuMemoryStats(static_cast<GpuMemoryKind>(i));
+        out += i ? ",\n    " : "\n    ";
+        appendJsonString(out, getGpuMemoryKindName(static_cast<GpuMemoryKind>(i)));
+        out += ": {";
+        appendField(out, "liveBytes", s.liveBytes);
+        appendField(out, "liveResources", s.liveResources);
+        appendField(out, "highWaterBytes", s.highWaterBytes, true);
+        out += '}';
+    }
+    out += "\n  },\n  \"samples\": [";
+
+    // Do mais antigo ao mais recente
+    const uint64_t cursor = gSampleCursor.load(std::memory_order_acquire);
+    const uint64_t first = cursor > kSampleCapacity ? cursor - kSampleCapacity : 0;
+    bool any = false;
+    for (uint64_t n = first; n < cursor; ++n) {
+        const AllocationSample& s = gSamples[n % kSampleCapacity];
+        const uint32_t seq = s.sequence.load(std::memory_order_acquire);
+        if (seq & 1u) continue;
+        const uint64_t frame = s.frame;
+        const uint64_t bytes = s.bytes;
+        const MemoryTag tag = s.tag;
+        const uint32_t depth = std::min(s.depth, kSampleFrames);
+        std::array<void*, kSampleFrames> frames{};
+        std::copy(s.frames, s.frames + depth, frames.begin());
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (s.sequence.load(std::memory_order_relaxed) != seq) continue;
+
+        out += any ? ",\n    {" : "\n    {";
+        any = true;
+        appendField(out, "frame", frame);
+        appendField(out, "bytes", bytes);
+        out += "\"tag\": ";
+        appendJsonString(out, getMemoryTagName(tag));
+        out += ", \"callstack\": ";
+        appendCallstack(out, frames.data(), depth);
+        out += '}';
+    }
+    out += any ? "\n  ]\n}\n" : "]\n}\n";
+    return out;
+}
+
+bool writeMemorySnapshot(const std::string& path) {
+    const std::string json = getMemorySnapshotJson();
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file || !file.write(json.data(), static_cast<std::streamsize>(json.size()))) {
+        Core::log(Core::LogLevel::Error, "Memória: falha ao gravar o snapshot em " + path);
+        return false;
+    }
+    Core::log(Core::LogLevel::Info, "Memória: snapshot gravado em " + path);
+    return true;
+}
+
+}
+
+#if defined(AURORA_MEMORY_NEW_HOOK)
+
+// ---- Hook global de operator new/delete ----
+// Cada bloco leva um cabeçalho logo antes do ponteiro devolvido com tamanho, tag e distância até a base,
+// para o delete (com ou sem tamanho/alinhamento) descontar da tag certa.
+
+namespace {
+    struct alignas(16) AllocationHeader {
+        uint64_t bytes;
+        uint32_t offset;
+        Aurora::Core::MemoryTag tag;
+    };
+    static_assert(sizeof(AllocationHeader) == 16);
+
+    void* hookedAllocate(size_t bytes, size_t alignment) {
+        using namespace Aurora::Core;
+        alignment = std::max(alignment, sizeof(AllocationHeader));
+        const size_t offset = alignment;
+#if defined(_WIN32)
+        void* base = _aligned_malloc(bytes + offset, alignment);
+#else
+        void* base = alignment <= alignof(std::max_align_t)
+            ? std::malloc(bytes + offset)
+            : std::aligned_alloc(alignment, (bytes + offset + alignment - 1) & ~(alignment - 1));
+#endif
+        if (!base) return nullptr;
+        auto* user = static_cast<std::byte*>(base) + offset;
+        auto* header = reinterpret_cast<AllocationHeader*>(user) - 1;
+        header->bytes = bytes;
+        header->offset = static_cast<uint32_t>(offset);
+        header->tag = tlsTag;
+        if (!tlsInHook) {
+            tlsInHook = true;
+            trackAllocation(header->tag, bytes);
+            sampleAllocation(header->tag, bytes);
+            tlsInHook = false;
+        }
+        return user;
+    }
+
+    void hookedFree(void* p) {
+        if (!p) return;
+        const auto* header = static_cast<const AllocationHeader*>(p) - 1;
+        Aurora::Core::trackFree(header->tag, header->bytes);
+        void* base = static_cast<std::byte*>(p) - header->offset;
+#if defined(_WIN32)
+        _aligned_free(base);
+#else
+        std::free(base);
+#endif
+    }
+
+    void* hookedAllocateOrThrow(size_t bytes, size_t alignment) {
+        for (;;) {
+            if (void* p = hookedAllocate(bytes, alignment)) return p;
+            std::new_handler handler = std::get_new_handler();
+            if (!handler) throw std::bad_alloc();
+            handler();
+        }
+    }
+}
+
+void* operator new(size_t bytes) { return hookedAllocateOrThrow(bytes, alignof(std::max_align_t)); }
+void* operator new[](size_t bytes) { return hookedAllocateOrThrow(bytes, alignof(std::max_align_t)); }
+void* operator new(size_t bytes, std::align_val_t al) { return hookedAllocateOrThrow(bytes, static_cast<size_t>(al)); }
+void* operator new[](size_t bytes, std::align_val_t al) { return hookedAllocateOrThrow(bytes, static_cast<size_t>(al)); }
+void* operator new(size_t bytes, const std::nothrow_t&) noexcept { return hookedAllocate(bytes, alignof(std::max_align_t)); }
+void* operator new[](size_t bytes, const std::nothrow_t&) noexcept { return hookedAllocate(bytes, alignof(std::max_align_t)); }
+void* operator new(size_t bytes, std::align_val_t al, const std::nothrow_t&) noexcept { return hookedAllocate(bytes, static_cast<size_t>(al)); }
+void* operator new[](size_t bytes, std::align_val_t al, const std::nothrow_t&) noexcept { return hookedAllocate(bytes, static_cast<size_t>(al)); }
+
+void operator delete(void* p) noexcept { hookedFree(p); }
+void operator delete[](void* p) noexcept { hookedFree(p); }
+void operator delete(void* p, size_t) noexcept { hookedFree(p); }
+void operator delete[](void* p, size_t) noexcept { hookedFree(p); }
+void operator delete(void* p, std::align_val_t) noexcept { hookedFree(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { hookedFree(p); }
+void operator delete(void* p, size_t, std::align_val_t) noexcept { hookedFree(p); }
+void operator delete[](void* p, size_t, std::align_val_t) noexcept { hookedFree(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { hookedFree(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { hookedFree(p); }
+void operator delete(void* p, std::align_val_t, const std::nothrow_t&) noexcept { hookedFree(p); }
+void operator delete[](void* p, std::align_val_t, const std::nothrow_t&) noexcept { hookedFree(p); }
+
+#endif
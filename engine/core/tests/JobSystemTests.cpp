@@ -0,0 +1,143 @@
+#include "Aurora/Core/JobSystem.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+using namespace Aurora;
+
+static int g_failures = 0;
+
+#define EXPECT(cond) \
+    do { if (!(cond)) { std::fprintf(stderr, "%s:%d: falhou: %s\n", __FILE__, __LINE__, #cond); ++g_failures; } } while (0)
+
+static Core::JobSystemDesc workers(uint32_t count) {
+    Core::JobSystemDesc desc{};
+    desc.workerCount = count;
+    return desc;
+}
+
+static void testDependencyRunsAfterPredecessors() {
+    Core::JobSystem jobs(workers(3));
+    struct Data {
+        std::atomic<uint32_t> finished{0};
+        uint32_t seenByDependent{0};
+    } data;
+
+    constexpr uint32_t kPredecessors = 8;
+    Core::JobDecl slow{[](void* p) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        static_cast<Data*>(p)->finished.fetch_add(1, std::memory_order_release);
+    }, &data};
+    std::vector<Core::JobDecl> decls(kPredecessors, slow);
+    Core::JobCounter predecessors;
+    jobs.run(decls.data(), kPredecessors, &predecessors);
+
+    Core::JobCounter dependent;
+    jobs.run({[](void* p) {
+        auto& d = *static_cast<Data*>(p);
+        d.seenByDependent = d.finished.load(std::memory_order_acquire);
+    }, &data}, &dependent, &predecessors);
+    jobs.wait(dependent);
+
+    EXPECT(predecessors.isDone());
+    EXPECT(data.seenByDependent == kPredecessors);
+}
+
+static void testParallelForCoversEveryIndexOnce() {
+    Core::JobSystem jobs(workers(3));
+    const uint32_t counts[] = {1, 7, 97, 1000, 4097};
+    const uint32_t grains[] = {0, 1, 3, 64};
+    for (uint32_t count : counts) {
+        for (uint32_t grain : grains) {
+            std::vector<std::atomic<uint32_t>> hits(count);
+            jobs.parallelFor(count, [&hits, count](uint32_t begin, uint32_t end) {
+                EXPECT(begin < end && end <= count);
+                for (uint32_t i = begin; i < end; ++i) hits[i].fetch_add(1, std::memory_order_relaxed);
+            }, grain);
+            uint32_t wrong = 0;
+            for (const auto& h : hits) wrong += h.load() != 1;
+            if (wrong) std::fprintf(stderr, "parallelFor(%u, grain %u): %u índices fora de 1 execução\n", count, grain, wrong);
+            EXPECT(wrong == 0);
+        }
+    }
+}
+
+static void testExternalThreadSubmission() {
+    Core::JobSystem jobs(workers(2));
+    constexpr uint32_t kJobs = 100;
+    std::atomic<uint32_t> ran{0};
+    Core::JobDecl increment{[](void* p) { static_cast<std::atomic<uint32_t>*>(p)->fetch_add(1); }, &ran};
+    std::vector<Core::JobDecl> decls(kJobs, increment);
+
+    // Submete e espera na própria thread externa
+    Core::JobCounter waitedOutside;
+    std::thread external([&] {
+        EXPECT(jobs.getCurrentThreadIndex() == Core::JobSystem::kInvalidThreadIndex);
+        jobs.run(decls.data(), kJobs, &waitedOutside);
+        jobs.wait(waitedOutside);
+    });
+    external.join();
+    EXPECT(ran.load() == kJobs);
+
+    // Submete de fora e espera na thread dona
+    Core::JobCounter waitedByOwner;
+    std::thread submitter([&] { jobs.run(decls.data(), kJobs, &waitedByOwner); });
+    submitter.join();
+    jobs.wait(waitedByOwner);
+    EXPECT(ran.load() == 2 * kJobs);
+}
+
+static void testDequeOverflowRunsInline() {
+    // Um worker só, preso num job: ninguém rouba da deque da thread dona enquanto ela transborda
+    Core::JobSystem jobs(workers(1));
+    std::atomic<bool> blockerStarted{false};
+    std::atomic<bool> release{false};
+    struct Blocker {
+        std::atomic<bool>* started;
+        std::atomic<bool>* release;
+    } blocker{&blockerStarted, &release};
+    Core::JobCounter blockerDone;
+    jobs.run({[](void* p) {
+        auto& b = *static_cast<Blocker*>(p);
+        b.started->store(true);
+        while (!b.release->load()) std::this_thread::yield();
+    }, &blocker}, &blockerDone);
+    while (!blockerStarted.load()) std::this_thread::yield();
+
+    // A deque tem 4096 posições: jobs liberados por uma dependência vêm dos anéis da dona e da fila
+    // externa e caem todos de uma vez na deque de quem sinalizou
+    constexpr uint32_t kPerSource = 4000;
+    std::atomic<uint32_t> ran{0};
+    Core::JobDecl increment{[](void* p) { static_cast<std::atomic<uint32_t>*>(p)->fetch_add(1); }, &ran};
+    std::vector<Core::JobDecl> decls(kPerSource, increment);
+
+    Core::JobCounter gate;
+    jobs.run({[](void*) {}, nullptr}, &gate);  // fica na deque da dona até o wait abaixo
+    Core::JobCounter released;
+    jobs.run(decls.data(), kPerSource, &released, &gate);
+    std::thread external([&] { jobs.run(decls.data(), kPerSource, &released, &gate); });
+    external.join();
+    EXPECT(ran.load() == 0);
+
+    const uint64_t inlineBefore = jobs.getStats().inlineJobs;
+    jobs.wait(gate);
+    const uint64_t inlined = jobs.getStats().inlineJobs - inlineBefore;
+    release.store(true);
+    jobs.wait(released);
+    jobs.wait(blockerDone);
+
+    EXPECT(ran.load() == 2 * kPerSource);
+    EXPECT(inlined >= 2 * kPerSource - 4096);
+}
+
+int main() {
+    testDependencyRunsAfterPredecessors();
+    testParallelForCoversEveryIndexOnce();
+    testExternalThreadSubmission();
+    testDequeOverflowRunsInline();
+    if (g_failures) std::fprintf(stderr, "%d falha(s)\n", g_failures);
+    return g_failures ? 1 : 0;
+}
@@ -0,0 +1,235 @@
+#include "Aurora/Core/Log.hpp"
+#include "Aurora/Core/LogSinks.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if !defined(_WIN32)
+#  include <csignal>
+#  include <sys/mman.h>
+#  include <sys/wait.h>
+#  include <unistd.h>
+#endif
+
+using namespace Aurora;
+
+static int g_failures = 0;
+
+#define EXPECT(cond) \
+    do { if (!(cond)) { std::fprintf(stderr, "%s:%d: falhou: %s\n", __FILE__, __LINE__, #cond); ++g_failures; } } while (0)
+
+// O anel é alocado uma vez por processo: cada caso roda num processo próprio (um add_test por caso)
+static void startLogging(uint32_t ringCapacity) {
+    Core::LogDesc desc{};
+    desc.ringCapacity = ringCapacity;
+    desc.stderrSink = false;
+    desc.installCrashHandler = false;
+    Core::initializeLogging(desc);
+}
+
+// Texto da mensagem sem o prefixo "[data hora] [NÍVEL] "
+static std::string messageOf(const std::string& line) {
+    const size_t level = line.find("] [");
+    const size_t start = level == std::string::npos ? std::string::npos : line.find("] ", level + 3);
+    return start == std::string::npos ? std::string() : line.substr(start + 2);
+}
+
+// Conteúdo determinístico por (produtor, sequência), com 200 a 1200 bytes (1 a 6 registros do anel)
+static std::string producerMessage(uint32_t producer, uint32_t sequence) {
+    std::string text = "P" + std::to_string(producer) + " #" + std::to_string(sequence) + " ";
+    const size_t length = 200 + (sequence * 131 + producer * 17) % 1000;
+    while (text.size() < length) text.push_back(static_cast<char>('a' + (text.size() + producer + sequence) % 26));
+    return text;
+}
+
+static void testMultiChunkMessagesFromSeveralProducers() {
+    startLogging(16384);
+    auto sink = std::make_shared<Core::MemoryLogSink>(100000);
+    Core::addLogSink(sink);
+
+    constexpr uint32_t kProducers = 4;
+    constexpr uint32_t kMessages = 300;
+    std::vector<std::thread> producers;
+    for (uint32_t p = 0; p < kProducers; ++p) {
+        producers.emplace_back([p] {
+            for (uint32_t i = 0; i < kMessages; ++i) Core::log(Core::LogLevel::Info, producerMessage(p, i));
+        });
+    }
+    for (auto& t : producers) t.join();
+    Core::flushLogs();
+
+    // Cada linha precisa ser exatamente uma mensagem inteira, e cada produtor em ordem crescente
+    int64_t last[kProducers];
+    std::fill(std::begin(last), std::end(last), -1);
+    uint32_t received = 0;
+    for (const std::string& line : sink->getLines()) {
+        const std::string message = messageOf(line);
+        uint32_t producer = 0, sequence = 0;
+        if (std::sscanf(message.c_str(), "P%u #%u ", &producer, &sequence) != 2 || producer >= kProducers) {
+            std::fprintf(stderr, "linha inesperada: %.80s\n", line.c_str());
+            ++g_failures;
+            continue;
+        }
+        EXPECT(message == producerMessage(producer, sequence));
+        EXPECT(static_cast<int64_t>(sequence) > last[producer]);
+        last[producer] = sequence;
+        ++received;
+    }
+    const Core::LogStats stats = Core::getLogStats();
+    EXPECT(received > 0);
+    EXPECT(received + stats.dropped == kProducers * kMessages);
+    Core::shutdownLogging();
+}
+
+// Segura a thread do logger dentro de write() até release: o anel enche sem ninguém consumir
+class BlockingSink final : public Core::ILogSink {
+public:
+    void write(Core::LogLevel, std::string_view) override {
+        entered.store(true);
+        while (!release.load()) std::this_thread::yield();
+        ++lines;
+    }
+
+    std::atomic<bool> entered{false};
+    std::atomic<bool> release{false};
+    std::atomic<uint32_t> lines{0};
+};
+
+static void testFullRingDropsBelowError() {
+    constexpr uint32_t kRing = 64;
+    startLogging(kRing);
+    auto sink = std::make_shared<BlockingSink>();
+    Core::addLogSink(sink);
+
+    Core::log(Core::LogLevel::Info, "bloqueia o consumidor");
+    while (!sink->entered.load()) std::this_thread::yield();
+
+    constexpr uint32_t kFlood = 500;
+    for (uint32_t i = 0; i < kFlood; ++i) Core::log(Core::LogLevel::Info, "inundação " + std::to_string(i));
+    const uint64_t dropped = Core::getLogStats().dropped;
+    EXPECT(dropped >= kFlood - kRing);
+
+    sink->release.store(true);
+    Core::flushLogs();
+    const Core::LogStats stats = Core::getLogStats();
+    EXPECT(stats.dropped == dropped);
+    // Primeira mensagem + as que couberam + o aviso de descarte
+    EXPECT(stats.written == 1 + kFlood - dropped);
+    EXPECT(sink->lines.load() == stats.written + 1);
+    Core::shutdownLogging();
+}
+
+static void testOversizeMessagesAreTruncated() {
+    startLogging(256);
+    auto sink = std::make_shared<Core::MemoryLogSink>();
+    Core::addLogSink(sink);
+
+    Core::log(Core::LogLevel::Info, std::string(100, 'c'));
+    Core::log(Core::LogLevel::Info, std::string(20000, 'x'));
+    Core::flushLogs();
+    EXPECT(Core::getLogStats().truncated == 1);
+
+    const auto lines = sink->getLines();
+    EXPECT(lines.size() == 2);
+    if (lines.size() == 2) {
+        const std::string kept = messageOf(lines[1]);
+        EXPECT(!kept.empty() && kept.size() < 20000);
+        EXPECT(kept.find_first_not_of('x') == std::string::npos);
+
+        // Exatamente no limite não conta como truncada
+        Core::log(Core::LogLevel::Info, std::string(kept.size(), 'y'));
+        Core::flushLogs();
+        EXPECT(Core::getLogStats().truncated == 1);
+        const auto after = sink->getLines();
+        EXPECT(after.size() == 3 && messageOf(after.back()).size() == kept.size());
+    }
+    Core::shutdownLogging();
+}
+
+// Sink lento: sem a espera do flushLogs o teste leria a contagem antes de o logger terminar o lote
+class SlowCountingSink final : public Core::ILogSink {
+public:
+    void write(Core::LogLevel, std::string_view) override {
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+        lines.fetch_add(1);
+    }
+    void flush() override { flushes.fetch_add(1); }
+
+    std::atomic<uint32_t> lines{0};
+    std::atomic<uint32_t> flushes{0};
+};
+
+static void testFlushWaitsForEarlierMessages() {
+    startLogging(4096);
+    auto sink = std::make_shared<SlowCountingSink>();
+    Core::addLogSink(sink);
+
+    constexpr uint32_t kThreads = 3;
+    constexpr uint32_t kRounds = 5;
+    constexpr uint32_t kPerRound = 20;
+    std::atomic<uint32_t> logged{0};
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&] {
+            for (uint32_t r = 0; r < kRounds; ++r) {
+                for (uint32_t i = 0; i < kPerRound; ++i) Core::log(Core::LogLevel::Info, "antes do flush");
+                const uint32_t before = logged.fetch_add(kPerRound) + kPerRound;
+                Core::flushLogs();
+                // Tudo que esta thread (e as outras, até o fetch_add) logou já passou pelos sinks
+                EXPECT(sink->lines.load() >= before);
+            }
+        });
+    }
+    for (auto& t : threads) t.join();
+    EXPECT(sink->lines.load() == kThreads * kRounds * kPerRound);
+    EXPECT(sink->flushes.load() > 0);
+    Core::shutdownLogging();
+}
+
+#if !defined(_WIN32)
+// Produtor que falha no meio da cópia de uma mensagem longa: o handler de crash precisa re-emitir o sinal
+// em vez de esperar para sempre pelos registros que nunca serão publicados
+static void testCrashWithPartialMessageReraises() {
+    const pid_t child = fork();
+    if (child == 0) {
+        alarm(10);  // travou: morre por SIGALRM em vez de SIGSEGV
+        Core::LogDesc desc{};
+        desc.stderrSink = false;
+        Core::initializeLogging(desc);
+        const long page = sysconf(_SC_PAGESIZE);
+        auto* memory = static_cast<char*>(mmap(nullptr, 2 * static_cast<size_t>(page), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+        std::memset(memory, 'z', 2 * static_cast<size_t>(page));
+        mprotect(memory + page, static_cast<size_t>(page), PROT_NONE);
+        // O primeiro registro é copiado e publicado; o segundo cai na página protegida
+        Core::log(Core::LogLevel::Info, std::string_view(memory + page - 300, 600));
+        _exit(0);
+    }
+    int status = 0;
+    EXPECT(child > 0 && waitpid(child, &status, 0) == child);
+    EXPECT(WIFSIGNALED(status) && WTERMSIG(status) == SIGSEGV);
+}
+#endif
+
+int main(int argc, char** argv) {
+    const std::string name = argc > 1 ? argv[1] : "";
+    if (name == "multichunk") testMultiChunkMessagesFromSeveralProducers();
+    else if (name == "drop") testFullRingDropsBelowError();
+    else if (name == "truncated") testOversizeMessagesAreTruncated();
+    else if (name == "flush") testFlushWaitsForEarlierMessages();
+#if !defined(_WIN32)
+    else if (name == "crash") testCrashWithPartialMessageReraises();
+#endif
+    else if (name != "crash") {
+        std::fprintf(stderr, "uso: %s multichunk|drop|truncated|flush|crash\n", argv[0]);
+        return 2;
+    }
+    if (g_failures) std::fprintf(stderr, "%d falha(s)\n", g_failures);
+    return g_failures ? 1 : 0;
+}
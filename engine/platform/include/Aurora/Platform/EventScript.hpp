@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "Input.hpp"
+
+namespace Aurora::Platform {
+
+class IWindow;
+
+// Roteiro de eventos por frame: dispatch injeta na janela os eventos agendados para o frame dado
+class EventScript {
+public:
+    void add(uint64_t frame, const Event& e);
+    void dispatch(uint64_t frame, IWindow& window);
+    void clear() { entries_.clear(); next_ = 0; }
+    bool empty() const { return entries_.empty(); }
+    // true quando todos os eventos já foram despachados
+    bool finished() const { return next_ >= entries_.size(); }
+
+private:
+    struct Entry {
+        uint64_t frame{0};
+        Event event{};
+    };
+    std::vector<Entry> entries_{}; // ordenado por frame (estável)
+    size_t next_{0};
+};
+
+}
@@ -58,6 +58,14 @@ struct InputState {
     bool focused{true};
 };
 
+// Índice do bitset de teclas (código virtual estilo Win32) para uma Key; 0 para Unknown
+uint8_t toVirtualKeyIndex(Key key);
+
+// Aplica um evento ao estado de input (mesma semântica do loop Win32); usado por eventos injetados
+void applyEvent(InputState& state, const Event& e);
+// Zera os estados de borda (pressed/released) e deltas do frame
+void resetFrameInput(InputState& state);
+
 }
 
 
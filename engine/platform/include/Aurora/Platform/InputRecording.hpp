@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "Input.hpp"
+
+namespace Aurora::Platform {
+
+class IWindow;
+
+// Formato binário (.ainput): cabeçalho "AINP" + versão + nº de frames, seguido por um registro por frame:
+// dt (double) + nº de eventos (varint) + eventos, cada um com o tipo (1 byte) e apenas os campos relevantes
+// ao tipo em varint/zigzag. Little-endian independente da plataforma.
+
+// Grava o stream de eventos e o dt de cada frame
+class InputRecorder {
+public:
+    ~InputRecorder() { close(); }
+
+    bool open(const std::string& path);
+    // Chamar uma vez por frame com os eventos entregues pela janela (após pumpEvents)
+    void recordFrame(double deltaSeconds, const std::vector<Event>& events);
+    // Finaliza o cabeçalho (nº de frames); chamado também pelo destrutor
+    void close();
+
+    bool isOpen() const { return file_.is_open(); }
+    uint64_t getFrameCount() const { return frameCount_; }
+
+private:
+    std::ofstream file_{};
+    std::vector<uint8_t> buffer_{};
+    uint64_t frameCount_{0};
+};
+
+// Reproduz uma gravação: injeta os eventos de cada frame na janela e devolve o dt gravado
+class InputReplay {
+public:
+    bool load(const std::string& path);
+    // Injeta os eventos do próximo frame (entregues no próximo pumpEvents); false quando a gravação acabou
+    bool playFrame(IWindow& window, double& outDeltaSeconds);
+    void rewind() { next_ = 0; }
+
+    bool finished() const { return next_ >= frames_.size(); }
+    uint64_t getFrameCount() const { return frames_.size(); }
+    uint64_t getCurrentFrame() const { return next_; }
+
+private:
+    struct Frame {
+        double deltaSeconds{0.0};
+        uint32_t firstEvent{0};
+        uint32_t eventCount{0};
+    };
+    std::vector<Frame> frames_{};
+    std::vector<Event> events_{};
+    size_t next_{0};
+};
+
+}
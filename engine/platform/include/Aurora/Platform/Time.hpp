@@ -12,6 +12,32 @@ uint64_t getTicksPerSecond();
 TimePoint getTimeNow();
 double secondsSince(const TimePoint& start);
 
+// Relógio de frame: RealTime mede o delta entre ticks; Fixed avança um delta constante por tick
+// (determinístico, usado em benchmarks, soak tests e replays)
+class FrameClock {
+public:
+    enum class Mode : uint8_t { RealTime, Fixed };
+
+    explicit FrameClock(Mode mode = Mode::RealTime, double fixedDeltaSeconds = 1.0 / 60.0);
+
+    // Avança um frame e retorna o delta em segundos
+    double tick();
+    void reset();
+
+    Mode getMode() const { return mode_; }
+    double getFixedDelta() const { return fixedDelta_; }
+    uint64_t getFrameIndex() const { return frameIndex_; }
+    // Tempo acumulado do relógio (simulado no modo Fixed)
+    double getElapsedSeconds() const { return elapsed_; }
+
+private:
+    Mode mode_{Mode::RealTime};
+    double fixedDelta_{1.0 / 60.0};
+    TimePoint last_{};
+    uint64_t frameIndex_{0};
+    double elapsed_{0.0};
+};
+
 }
 
 
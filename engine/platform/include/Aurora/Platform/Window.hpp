@@ -12,6 +12,8 @@ struct WindowDesc {
     uint32_t width{1280};
     uint32_t height{720};
     std::string_view title{"Aurora"};
+    // Sem janela nativa: eventos apenas injetados (também usado em plataformas sem backend de janela)
+    bool headless{false};
 };
 
 class IWindow {
@@ -24,6 +26,8 @@ public:
     virtual const std::vector<Event>& getEventQueue() const = 0;
     virtual void clearEventQueue() = 0;
     virtual const InputState& getInputState() const = 0;
+    // Enfileira um evento sintético; entregue (e aplicado ao InputState) no próximo pumpEvents
+    virtual void injectEvent(const Event& e) = 0;
 };
 
 IWindow* createWindow(const WindowDesc& desc);
@@ -0,0 +1,22 @@
+#include "Aurora/Platform/EventScript.hpp"
+#include "Aurora/Platform/Window.hpp"
+
+#include <algorithm>
+
+namespace Aurora::Platform {
+
+void EventScript::add(uint64_t frame, const Event& e) {
+    // Inserção estável: eventos do mesmo frame mantêm a ordem em que foram agendados
+    auto it = std::upper_bound(entries_.begin() + static_cast<std::ptrdiff_t>(next_), entries_.end(), frame,
+                               [](uint64_t f, const Entry& entry) { return f < entry.frame; });
+    entries_.insert(it, Entry{frame, e});
+}
+
+void EventScript::dispatch(uint64_t frame, IWindow& window) {
+    while (next_ < entries_.size() && entries_[next_].frame <= frame) {
+        window.injectEvent(entries_[next_].event);
+        ++next_;
+    }
+}
+
+}
@@ -0,0 +1,28 @@
+#include "HeadlessWindow.hpp"
+
+namespace Aurora::Platform {
+
+bool HeadlessWindow::pumpEvents() {
+    for (const auto& e : pending_) {
+        switch (e.type) {
+            case EventType::WindowResize:
+                width_ = e.width; height_ = e.height;
+                break;
+            case EventType::WindowClose:
+                running_ = false;
+                break;
+            case EventType::KeyDown:
+                // Mesmo atalho de saída da janela Win32
+                if (e.key == Key::Escape) running_ = false;
+                break;
+            default:
+                break;
+        }
+        applyEvent(input_, e);
+        events_.push_back(e);
+    }
+    pending_.clear();
+    return running_;
+}
+
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "Aurora/Platform/Window.hpp"
+#include "Aurora/Platform/Input.hpp"
+
+#include <vector>
+
+namespace Aurora::Platform {
+
+// Janela sem backend nativo: não há handle (o swapchain vira offscreen) e todos os eventos vêm de injectEvent
+class HeadlessWindow final : public IWindow {
+public:
+    explicit HeadlessWindow(const WindowDesc& desc) : width_(desc.width), height_(desc.height) {}
+
+    void show() override {}
+    bool pumpEvents() override;
+    void* getNativeHandle() const override { return nullptr; }
+    void getSize(uint32_t& outWidth, uint32_t& outHeight) const override { outWidth = width_; outHeight = height_; }
+    const std::vector<Event>& getEventQueue() const override { return events_; }
+    void clearEventQueue() override { events_.clear(); resetFrameInput(input_); }
+    const InputState& getInputState() const override { return input_; }
+    void injectEvent(const Event& e) override { pending_.push_back(e); }
+
+private:
+    uint32_t width_{0};
+    uint32_t height_{0};
+    bool running_{true};
+    std::vector<Event> pending_{};
+    std::vector<Event> events_{};
+    InputState input_{};
+};
+
+}
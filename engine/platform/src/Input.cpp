@@ -0,0 +1,86 @@
+#include "Aurora/Platform/Input.hpp"
+
+namespace Aurora::Platform {
+
+uint8_t toVirtualKeyIndex(Key key) {
+    if (key >= Key::A && key <= Key::Z) {
+        return static_cast<uint8_t>('A' + (static_cast<int>(key) - static_cast<int>(Key::A)));
+    }
+    if (key >= Key::Num0 && key <= Key::Num9) {
+        return static_cast<uint8_t>('0' + (static_cast<int>(key) - static_cast<int>(Key::Num0)));
+    }
+    switch (key) {
+        case Key::Escape: return 0x1B;
+        case Key::Space: return 0x20;
+        case Key::Enter: return 0x0D;
+        case Key::Tab: return 0x09;
+        case Key::ShiftLeft: return 0xA0;
+        case Key::ShiftRight: return 0xA1;
+        case Key::ControlLeft: return 0xA2;
+        case Key::ControlRight: return 0xA3;
+        case Key::AltLeft: return 0xA4;
+        case Key::AltRight: return 0xA5;
+        case Key::ArrowUp: return 0x26;
+        case Key::ArrowDown: return 0x28;
+        case Key::ArrowLeft: return 0x25;
+        case Key::ArrowRight: return 0x27;
+        default: return 0;
+    }
+}
+
+void applyEvent(InputState& state, const Event& e) {
+    switch (e.type) {
+        case EventType::KeyDown: {
+            size_t idx = toVirtualKeyIndex(e.key);
+            if (!idx) break;
+            if (!state.keyDown.test(idx)) state.keyPressed.set(idx);
+            state.keyDown.set(idx);
+            break;
+        }
+        case EventType::KeyUp: {
+            size_t idx = toVirtualKeyIndex(e.key);
+            if (!idx) break;
+            state.keyDown.reset(idx);
+            state.keyReleased.set(idx);
+            break;
+        }
+        case EventType::MouseMove:
+            state.mouseDeltaX += e.x - state.mouseX;
+            state.mouseDeltaY += e.y - state.mouseY;
+            state.mouseX = e.x; state.mouseY = e.y;
+            break;
+        case EventType::MouseDown:
+            if (e.mouseButton != MouseButton::Unknown) {
+                size_t idx = static_cast<size_t>(e.mouseButton);
+                state.mouseDown.set(idx); state.mousePressed.set(idx);
+            }
+            break;
+        case EventType::MouseUp:
+            if (e.mouseButton != MouseButton::Unknown) {
+                size_t idx = static_cast<size_t>(e.mouseButton);
+                state.mouseDown.reset(idx); state.mouseReleased.set(idx);
+            }
+            break;
+        case EventType::MouseWheel:
+            state.mouseWheelDelta += e.wheelDelta;
+            break;
+        case EventType::WindowFocus:
+            state.focused = true;
+            break;
+        case EventType::WindowLostFocus:
+            state.focused = false;
+            break;
+        default:
+            break;
+    }
+}
+
+void resetFrameInput(InputState& state) {
+    state.mouseDeltaX = state.mouseDeltaY = state.mouseWheelDelta = 0;
+    state.keyPressed.reset();
+    state.keyReleased.reset();
+    state.mousePressed.reset();
+    state.mouseReleased.reset();
+}
+
+}
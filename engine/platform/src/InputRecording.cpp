@@ -0,0 +1,234 @@
+#include "Aurora/Platform/InputRecording.hpp"
+#include "Aurora/Platform/Window.hpp"
+#include "Aurora/Core/Log.hpp"
+
+#include <cstring>
+#include <iterator>
+
+namespace Aurora::Platform {
+
+static constexpr char kMagic[4] = {'A', 'I', 'N', 'P'};
+static constexpr uint16_t kVersion = 1;
+static constexpr size_t kHeaderSize = 4 + 2 + 2 + 8; // magic, versão, reservado, nº de frames
+
+// ---- Codificação ----
+
+static void putU16(std::vector<uint8_t>& out, uint16_t v) {
+    out.push_back(static_cast<uint8_t>(v)); out.push_back(static_cast<uint8_t>(v >> 8));
+}
+
+static void putU64(std::vector<uint8_t>& out, uint64_t v) {
+    for (int i = 0; i < 8; ++i) out.push_back(static_cast<uint8_t>(v >> (8 * i)));
+}
+
+static void putVarint(std::vector<uint8_t>& out, uint64_t v) {
+    while (v >= 0x80) { out.push_back(static_cast<uint8_t>(v | 0x80)); v >>= 7; }
+    out.push_back(static_cast<uint8_t>(v));
+}
+
+static void putSigned(std::vector<uint8_t>& out, int64_t v) {
+    putVarint(out, (static_cast<uint64_t>(v) << 1) ^ static_cast<uint64_t>(v >> 63)); // zigzag
+}
+
+static void putDouble(std::vector<uint8_t>& out, double v) {
+    uint64_t bits; std::memcpy(&bits, &v, sizeof(bits));
+    putU64(out, bits);
+}
+
+static void encodeEvent(std::vector<uint8_t>& out, const Event& e) {
+    out.push_back(static_cast<uint8_t>(e.type));
+    switch (e.type) {
+        case EventType::KeyDown:
+        case EventType::KeyUp:
+            putVarint(out, static_cast<uint16_t>(e.key));
+            break;
+        case EventType::TextInput:
+            putVarint(out, e.character);
+            break;
+        case EventType::MouseMove:
+            putSigned(out, e.x); putSigned(out, e.y);
+            putSigned(out, e.dx); putSigned(out, e.dy);
+            break;
+        case EventType::MouseDown:
+        case EventType::MouseUp:
+            out.push_back(static_cast<uint8_t>(e.mouseButton));
+            putSigned(out, e.x); putSigned(out, e.y);
+            break;
+        case EventType::MouseWheel:
+            putSigned(out, e.wheelDelta);
+            break;
+        case EventType::WindowResize:
+            putVarint(out, e.width); putVarint(out, e.height);
+            break;
+        case EventType::WindowClose:
+        case EventType::WindowFocus:
+        case EventType::WindowLostFocus:
+            break;
+    }
+}
+
+// ---- Decodificação ----
+
+namespace {
+struct Reader {
+    const uint8_t* p{nullptr};
+    const uint8_t* end{nullptr};
+    bool ok{true};
+
+    uint8_t u8() { if (p >= end) { ok = false; return 0; } return *p++; }
+    uint64_t fixed(int bytes) {
+        uint64_t v = 0;
+        for (int i = 0; i < bytes; ++i) v |= static_cast<uint64_t>(u8()) << (8 * i);
+        return v;
+    }
+    uint64_t varint() {
+        uint64_t v = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            uint8_t b = u8();
+            v |= static_cast<uint64_t>(b & 0x7F) << shift;
+            if (!(b & 0x80)) return v;
+        }
+        ok = false;
+        return 0;
+    }
+    int64_t sgn() { uint64_t z = varint(); return static_cast<int64_t>(z >> 1) ^ -static_cast<int64_t>(z & 1); }
+    double f64() { uint64_t bits = fixed(8); double v; std::memcpy(&v, &bits, sizeof(v)); return v; }
+};
+}
+
+static bool decodeEvent(Reader& r, Event& e) {
+    e = Event{};
+    uint8_t type = r.u8();
+    if (type > static_cast<uint8_t>(EventType::WindowLostFocus)) return false;
+    e.type = static_cast<EventType>(type);
+    switch (e.type) {
+        case EventType::KeyDown:
+        case EventType::KeyUp:
+            e.key = static_cast<Key>(r.varint());
+            break;
+        case EventType::TextInput:
+            e.character = static_cast<uint32_t>(r.varint());
+            break;
+        case EventType::MouseMove:
+            e.x = static_cast<int>(r.sgn()); e.y = static_cast<int>(r.sgn());
+            e.dx = static_cast<int>(r.sgn()); e.dy = static_cast<int>(r.sgn());
+            break;
+        case EventType::MouseDown:
+        case EventType::MouseUp: {
+            // InputState guarda botões em bitset<8>: fora de Left..X2 (exceto Unknown) o arquivo está corrompido
+            const uint8_t button = r.u8();
+            if (button > static_cast<uint8_t>(MouseButton::X2) && button != static_cast<uint8_t>(MouseButton::Unknown)) return false;
+            e.mouseButton = static_cast<MouseButton>(button);
+            e.x = static_cast<int>(r.sgn()); e.y = static_cast<int>(r.sgn());
+            break;
+        }
+        case EventType::MouseWheel:
+            e.wheelDelta = static_cast<int>(r.sgn());
+            break;
+        case EventType::WindowResize:
+            e.width = static_cast<uint32_t>(r.varint()); e.height = static_cast<uint32_t>(r.varint());
+            break;
+        case EventType::WindowClose:
+        case EventType::WindowFocus:
+        case EventType::WindowLostFocus:
+            break;
+    }
+    return r.ok;
+}
+
+// ---- InputRecorder ----
+
+bool InputRecorder::open(const std::string& path) {
+    close();
+    file_.open(path, std::ios::binary | std::ios::trunc);
+    if (!file_) { Core::log(Core::LogLevel::Error, "InputRecorder: falha ao abrir " + path); return false; }
+    buffer_.clear();
+    buffer_.insert(buffer_.end(), std::begin(kMagic), std::end(kMagic));
+    putU16(buffer_, kVersion);
+    putU16(buffer_, 0);
+    putU64(buffer_, 0); // nº de frames, reescrito em close()
+    file_.write(reinterpret_cast<const char*>(buffer_.data()), static_cast<std::streamsize>(buffer_.size()));
+    frameCount_ = 0;
+    Core::log(Core::LogLevel::Info, "Gravando input em " + path);
+    return true;
+}
+
+void InputRecorder::recordFrame(double deltaSeconds, const std::vector<Event>& events) {
+    if (!file_.is_open()) return;
+    buffer_.clear();
+    putDouble(buffer_, deltaSeconds);
+    putVarint(buffer_, events.size());
+    for (const auto& e : events) encodeEvent(buffer_, e);
+    file_.write(reinterpret_cast<const char*>(buffer_.data()), static_cast<std::streamsize>(buffer_.size()));
+    ++frameCount_;
+}
+
+void InputRecorder::close() {
+    if (!file_.is_open()) return;
+    buffer_.clear();
+    putU64(buffer_, frameCount_);
+    file_.seekp(static_cast<std::streamoff>(kHeaderSize - 8));
+    file_.write(reinterpret_cast<const char*>(buffer_.data()), 8);
+    file_.close();
+    Core::log(Core::LogLevel::Info, "Gravação de input finalizada: " + std::to_string(frameCount_) + " frames");
+}
+
+// ---- InputReplay ----
+
+bool InputReplay::load(const std::string& path) {
+    frames_.clear(); events_.clear(); next_ = 0;
+    std::ifstream ifs(path, std::ios::binary);
+    if (!ifs) { Core::log(Core::LogLevel::Error, "InputReplay: falha ao abrir " + path); return false; }
+    std::vector<uint8_t> data((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+
+    Reader r{data.data(), data.data() + data.size()};
+    if (data.size() < kHeaderSize || std::memcmp(data.data(), kMagic, 4) != 0) {
+        Core::log(Core::LogLevel::Error, "InputReplay: arquivo inválido " + path);
+        return false;
+    }
+    r.p += 4;
+    uint16_t version = static_cast<uint16_t>(r.fixed(2));
+    r.fixed(2);
+    uint64_t declaredFrames = r.fixed(8);
+    if (version != kVersion) {
+        Core::log(Core::LogLevel::Error, "InputReplay: versão não suportada " + std::to_string(version));
+        return false;
+    }
+
+    // Lê até o fim do arquivo: gravações interrompidas (nº de frames = 0) continuam reproduzíveis
+    while (r.p < r.end) {
+        Frame f{};
+        f.deltaSeconds = r.f64();
+        uint64_t count = r.varint();
+        f.firstEvent = static_cast<uint32_t>(events_.size());
+        for (uint64_t i = 0; i < count && r.ok; ++i) {
+            Event e{};
+            if (!decodeEvent(r, e)) { r.ok = false; break; }
+            events_.push_back(e);
+        }
+        if (!r.ok) {
+            events_.resize(f.firstEvent);
+            Core::log(Core::LogLevel::Warn, "InputReplay: registro truncado no frame " + std::to_string(frames_.size()));
+            break;
+        }
+        f.eventCount = static_cast<uint32_t>(count);
+        frames_.push_back(f);
+    }
+    if (declaredFrames && declaredFrames != frames_.size()) {
+        Core::log(Core::LogLevel::Warn, "InputReplay: cabeçalho declara " + std::to_string(declaredFrames)
+            + " frames, lidos " + std::to_string(frames_.size()));
+    }
+    Core::log(Core::LogLevel::Info, "Replay de input carregado: " + std::to_string(frames_.size()) + " frames, "
+        + std::to_string(events_.size()) + " eventos");
+    return true;
+}
+
+bool InputReplay::playFrame(IWindow& window, double& outDeltaSeconds) {
+    if (finished()) return false;
+    const Frame& f = frames_[next_++];
+    for (uint32_t i = 0; i < f.eventCount; ++i) window.injectEvent(events_[f.firstEvent + i]);
+    outDeltaSeconds = f.deltaSeconds;
+    return true;
+}
+
+}
@@ -21,6 +21,27 @@ double secondsSince(const TimePoint& start) {
     return static_cast<double>(delta) / static_cast<double>(g_ticksPerSecond);
 }
 
+FrameClock::FrameClock(Mode mode, double fixedDeltaSeconds)
+    : mode_(mode), fixedDelta_(fixedDeltaSeconds > 0.0 ? fixedDeltaSeconds : 1.0 / 60.0) {
+    reset();
 }
 
+double FrameClock::tick() {
+    double dt = fixedDelta_;
+    if (mode_ == Mode::RealTime) {
+        TimePoint now = getTimeNow();
+        dt = static_cast<double>(now.ticks - last_.ticks) / static_cast<double>(g_ticksPerSecond);
+        last_ = now;
+    }
+    ++frameIndex_;
+    elapsed_ += dt;
+    return dt;
+}
+
+void FrameClock::reset() {
+    last_ = getTimeNow();
+    frameIndex_ = 0;
+    elapsed_ = 0.0;
+}
 
+}
@@ -1,4 +1,7 @@
 #include "Aurora/Platform/Window.hpp"
+#include "Aurora/Core/Log.hpp"
+#include "Aurora/Core/MemoryTracking.hpp"
+#include "Headless/HeadlessWindow.hpp"
 
 #ifdef _WIN32
 #  include "Windows/Win32Window.hpp"
@@ -7,11 +10,13 @@
 namespace Aurora::Platform {
 
 IWindow* createWindow(const WindowDesc& desc) {
+    Core::MemoryTagScope memoryTag(Core::MemoryTag::Platform);
+    if (desc.headless) return new HeadlessWindow(desc);
 #ifdef _WIN32
     return new Win32Window(desc);
 #else
-    (void)desc;
-    return nullptr;
+    Core::log(Core::LogLevel::Warn, "Sem backend de janela nesta plataforma; usando janela headless");
+    return new HeadlessWindow(desc);
 #endif
 }
 
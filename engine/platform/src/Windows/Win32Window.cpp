@@ -98,6 +98,13 @@ bool Win32Window::pumpEvents() {
         TranslateMessage(&msg);
         DispatchMessageW(&msg);
     }
+    // Eventos sintéticos entram depois dos nativos do frame
+    for (const auto& e : injected_) {
+        if (e.type == EventType::WindowClose) running_ = false;
+        applyEvent(input_, e);
+        events_.push_back(e);
+    }
+    injected_.clear();
     return running_;
 }
 
@@ -20,8 +20,9 @@ public:
     void* getNativeHandle() const override { return hwnd_; }
     void getSize(uint32_t& outWidth, uint32_t& outHeight) const override;
     const std::vector<Event>& getEventQueue() const override { return events_; }
-    void clearEventQueue() override { events_.clear(); input_.mouseDeltaX = input_.mouseDeltaY = input_.mouseWheelDelta = 0; input_.keyPressed.reset(); input_.keyReleased.reset(); input_.mousePressed.reset(); input_.mouseReleased.reset(); }
+    void clearEventQueue() override { events_.clear(); resetFrameInput(input_); }
     const InputState& getInputState() const override { return input_; }
+    void injectEvent(const Event& e) override { injected_.push_back(e); }
 
     static LRESULT CALLBACK WndProc(HWND hwnd, UINT msg, WPARAM wparam, LPARAM lparam);
 
@@ -30,6 +31,7 @@ private:
     HINSTANCE hinstance_{};
     bool running_{true};
     std::vector<Event> events_{};
+    std::vector<Event> injected_{};
     InputState input_{};
 };
 
@@ -0,0 +1,84 @@
+#include "Aurora/Platform/InputRecording.hpp"
+#include "Aurora/Platform/Window.hpp"
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+using namespace Aurora;
+
+static int g_failures = 0;
+
+#define EXPECT(cond) \
+    do { if (!(cond)) { std::fprintf(stderr, "%s:%d: falhou: %s\n", __FILE__, __LINE__, #cond); ++g_failures; } } while (0)
+
+static Platform::Event mouseDown(Platform::MouseButton button) {
+    Platform::Event e{};
+    e.type = Platform::EventType::MouseDown;
+    e.mouseButton = button;
+    return e;
+}
+
+static std::string writeRecording(const std::string& name) {
+    const std::string path = (std::filesystem::temp_directory_path() / name).string();
+    Platform::InputRecorder recorder;
+    if (!recorder.open(path)) return {};
+    recorder.recordFrame(1.0 / 60.0, {mouseDown(Platform::MouseButton::Left)});
+    recorder.recordFrame(1.0 / 60.0, {mouseDown(Platform::MouseButton::Right)});
+    recorder.close();
+    return path;
+}
+
+// Byte do botão no segundo frame: cabeçalho (16) + frame 0 (dt 8, nº de eventos 1, tipo 1, botão 1, x 1,
+// y 1) + dt 8, nº de eventos 1 e tipo 1 do frame 1
+static constexpr std::streamoff kSecondButtonOffset = 16 + 13 + 10;
+
+static void testRoundTrip() {
+    const std::string path = writeRecording("aurora_replay_roundtrip.ainput");
+    EXPECT(!path.empty());
+    Platform::InputReplay replay;
+    EXPECT(replay.load(path));
+    EXPECT(replay.getFrameCount() == 2);
+    std::filesystem::remove(path);
+}
+
+static void testCorruptedMouseButton() {
+    const std::string path = writeRecording("aurora_replay_corrupt.ainput");
+    EXPECT(!path.empty());
+    {
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekg(kSecondButtonOffset);
+        char original = 0;
+        file.read(&original, 1);
+        EXPECT(original == static_cast<char>(Platform::MouseButton::Right));
+        const char corrupted = 0x20;  // fora do bitset<8> do InputState
+        file.seekp(kSecondButtonOffset);
+        file.write(&corrupted, 1);
+    }
+
+    // O frame corrompido é descartado como registro truncado; o anterior continua reproduzível
+    Platform::InputReplay replay;
+    EXPECT(replay.load(path));
+    EXPECT(replay.getFrameCount() == 1);
+
+    Platform::WindowDesc desc{};
+    desc.headless = true;
+    Platform::IWindow* window = Platform::createWindow(desc);
+    double dt = 0.0;
+    while (replay.playFrame(*window, dt)) {
+        window->pumpEvents();
+        window->clearEventQueue();
+    }
+    EXPECT(replay.finished());
+    Platform::destroyWindow(window);
+    std::filesystem::remove(path);
+}
+
+int main() {
+    testRoundTrip();
+    testCorruptedMouseButton();
+    if (g_failures) std::fprintf(stderr, "%d falha(s)\n", g_failures);
+    return g_failures ? 1 : 0;
+}
@@ -0,0 +1,177 @@
+#pragma once
+
+#include "Aurora/RHI/RHI.hpp"
+#include "Aurora/Renderer/ThreadBuckets.hpp"
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Aurora::Renderer {
+
+// Com AURORA_DEBUG_DRAW=OFF no CMake (builds de shipping) as chamadas de desenho viram no-ops inline
+#ifdef AURORA_DEBUG_DRAW_DISABLED
+inline constexpr bool kDebugDrawEnabled = false;
+#else
+inline constexpr bool kDebugDrawEnabled = true;
+#endif
+
+struct DebugVec3 {
+    float x{0.0f}, y{0.0f}, z{0.0f};
+};
+
+struct DebugColor {
+    float r{1.0f}, g{1.0f}, b{1.0f}, a{1.0f};
+};
+
+// Vértice dos streams de debug. Layout do debug.vert.glsl: location 0 = vec3 posição, 1 = vec4 cor
+struct DebugVertex {
+    float x, y, z;
+    float r, g, b, a;
+};
+
+enum class DebugDepth : uint8_t {
+    Test,     // escondido pela cena (depth test sem escrita)
+    Overlay,  // sempre visível
+};
+
+struct DebugDrawStats {
+    uint32_t lineVertexCount{0};
+    uint32_t triangleVertexCount{0};
+    uint32_t persistentVertexCount{0};  // de primitivas com duração ainda vivas
+    uint32_t drawCount{0};
+    uint32_t bucketCount{0};            // threads que desenharam no frame
+    uint64_t vertexBytes{0};
+};
+
+// Desenho de depuração imediato (linhas, caixas, esferas, frustums, eixos e triângulos sólidos) em
+// coordenadas de mundo. Qualquer thread pode desenhar: cada uma acumula num bucket próprio (sem lock após o
+// primeiro desenho do frame) e os buckets reaproveitam a capacidade entre frames, sem alocação por
+// primitiva. flush() junta tudo num vertex buffer por frame em voo e record() emite um draw por tipo de
+// primitiva (linhas/triângulos) e modo de depth. Primitivas com duration > 0 persistem pelos segundos
+// pedidos (idade avançada em flush).
+// Matrizes em float[16] column-major (convenção GL), espaço de clip com z em [-1, 1].
+// Uso por frame: desenhos de qualquer thread -> flush() na thread dona, sem desenhos concorrentes ->
+// record() dentro de um render pass com depth (para DebugDepth::Test); os dados valem até o próximo flush().
+class DebugDraw {
+public:
+    explicit DebugDraw(RHI::IDevice& device);
+    ~DebugDraw();
+
+    DebugDraw(const DebugDraw&) = delete;
+    DebugDraw& operator=(const DebugDraw&) = delete;
+
+    // Shaders do layout de DebugVertex com a view-projection num UBO no binding 0 (mat4, std140)
+    bool initialize(RHI::IShaderModule* vertexShader, RHI::IShaderModule* fragmentShader);
+
+    void line(const DebugVec3& a, const DebugVec3& b, const DebugColor& color,
+              DebugDepth depth = DebugDepth::Test, float duration = 0.0f) {
+        if constexpr (kDebugDrawEnabled) addLine(a, b, color, depth, duration);
+    }
+    // Caixa alinhada aos eixos
+    void box(const DebugVec3& min, const DebugVec3& max, const DebugColor& color,
+             DebugDepth depth = DebugDepth::Test, float duration = 0.0f) {
+        if constexpr (kDebugDrawEnabled) addBox(min, max, nullptr, color, depth, duration, false);
+    }
+    // Cubo unitário [-0.5, 0.5]^3 transformado (OBB)
+    void box(const float transform[16], const DebugColor& color,
+             DebugDepth depth = DebugDepth::Test, float duration = 0.0f) {
+        if constexpr (kDebugDrawEnabled) addBox({-0.5f, -0.5f, -0.5f}, {0.5f, 0.5f, 0.5f}, transform, color, depth, duration, false);
+    }
+    void solidBox(const DebugVec3& min, const DebugVec3& max, const DebugColor& color,
+                  DebugDepth depth = DebugDepth::Test, float duration = 0.0f) {
+        if constexpr (kDebugDrawEnabled) addBox(min, max, nullptr, color, depth, duration, true);
+    }
+    // Três círculos máximos (XY, XZ, YZ)
+    void sphere(const DebugVec3& center, float radius, const DebugColor& color,
+                DebugDepth depth = DebugDepth::Test, float duration = 0.0f) {
+        if constexpr (kDebugDrawEnabled) addSphere(center, radius, color, depth, duration);
+    }
+    // Arestas do frustum da câmera cuja view-projection inversa é informada (cubo NDC transformado)
+    void frustum(const float inverseViewProjection[16], const DebugColor& color,
+                 DebugDepth depth = DebugDepth::Test, float duration = 0.0f) {
+        if constexpr (kDebugDrawEnabled) addFrustum(inverseViewProjection, color, depth, duration);
+    }
+    // Eixos X/Y/Z (vermelho/verde/azul) da transformação, com o comprimento dado
+    void axes(const float transform[16], float size = 1.0f,
+              DebugDepth depth = DebugDepth::Test, float duration = 0.0f) {
+        if constexpr (kDebugDrawEnabled) addAxes(transform, size, depth, duration);
+    }
+    void triangle(const DebugVec3& a, const DebugVec3& b, const DebugVec3& c, const DebugColor& color,
+                  DebugDepth depth = DebugDepth::Test, float duration = 0.0f) {
+        if constexpr (kDebugDrawEnabled) addTriangle(a, b, c, color, depth, duration);
+    }
+
+    // Descarta também as primitivas com duração
+    void clearPersistent();
+
+    void flush(const float viewProjection[16], float deltaSeconds);
+    void record(RHI::ICommandList& cmd) const;
+
+    const DebugDrawStats& getStats() const { return stats_; }
+
+private:
+    // Stream = tipo de primitiva x modo de depth (um pipeline e um draw cada)
+    static constexpr uint32_t kStreamCount = 4;
+    static constexpr size_t kMinVertexBufferBytes = 64 * 1024;
+
+    struct TimedSpan {
+        uint32_t vertexCount;
+        float remaining;
+    };
+
+    struct Stream {
+        std::vector<DebugVertex> vertices;
+        std::vector<DebugVertex> timedVertices;
+        std::vector<TimedSpan> timedSpans;
+    };
+
+    struct Bucket {
+        std::array<Stream, kStreamCount> streams;
+    };
+
+    struct Range {
+        uint32_t first{0};
+        uint32_t count{0};
+    };
+
+    static uint32_t streamIndex(bool triangles, DebugDepth depth) {
+        return (triangles ? 2u : 0u) + (depth == DebugDepth::Overlay ? 1u : 0u);
+    }
+
+    // Reserva count vértices no stream (com span de duração se duration > 0) e devolve onde escrevê-los
+    DebugVertex* append(uint32_t stream, uint32_t count, float duration);
+
+    void addLine(const DebugVec3& a, const DebugVec3& b, const DebugColor& color, DebugDepth depth, float duration);
+    void addBox(const DebugVec3& min, const DebugVec3& max, const float* transform, const DebugColor& color,
+                DebugDepth depth, float duration, bool solid);
+    void addSphere(const DebugVec3& center, float radius, const DebugColor& color, DebugDepth depth, float duration);
+    void addFrustum(const float* inverseViewProjection, const DebugColor& color, DebugDepth depth, float duration);
+    void addAxes(const float* transform, float size, DebugDepth depth, float duration);
+    void addTriangle(const DebugVec3& a, const DebugVec3& b, const DebugVec3& c, const DebugColor& color,
+                     DebugDepth depth, float duration);
+
+    void agePersistent(float deltaSeconds);
+    bool upload(const float viewProjection[16]);
+
+    RHI::IDevice& device_;
+    std::array<std::unique_ptr<RHI::IGraphicsPipeline>, kStreamCount> pipelines_;
+
+    ThreadBuckets<Bucket> buckets_;
+
+    // Primitivas com duração já transferidas dos buckets (só a thread dona mexe)
+    std::array<std::vector<DebugVertex>, kStreamCount> persistentVertices_;
+    std::array<std::vector<TimedSpan>, kStreamCount> persistentSpans_;
+
+    std::vector<DebugVertex> staging_;
+    std::array<Range, kStreamCount> ranges_{};
+    std::vector<std::unique_ptr<RHI::IBuffer>> vertexBuffers_;  // um por frame em voo
+    std::vector<std::unique_ptr<RHI::IBuffer>> uniformBuffers_;
+    std::vector<std::unique_ptr<RHI::IDescriptorSet>> descriptorSets_;
+    RHI::IBuffer* frameVertexBuffer_{nullptr};
+    RHI::IDescriptorSet* frameDescriptorSet_{nullptr};
+    DebugDrawStats stats_{};
+};
+
+}
@@ -0,0 +1,135 @@
+#pragma once
+
+#include "Aurora/RHI/RHI.hpp"
+#include "Aurora/Renderer/RenderGraph.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Aurora::Renderer {
+
+struct DynamicResolutionDesc {
+    float targetFrameMs{16.6f};
+    float minScale{0.5f};          // fração da resolução de saída em cada eixo
+    float maxScale{1.0f};
+    // PID na forma incremental sobre o erro relativo (alvo - medido) / alvo: a escala varia a cada frame
+    // em kp * Δerro + ki * erro + kd * Δ²erro, então o clamp em [minScale, maxScale] não acumula integral
+    float kp{0.25f};
+    float ki{0.08f};
+    float kd{0.05f};
+    float smoothing{0.2f};         // peso da amostra nova na média móvel exponencial do tempo medido
+    float deadband{0.03f};         // erro relativo ignorado (evita oscilar em torno do alvo)
+    // Passo da escala aplicada: limita os tamanhos distintos pedidos ao pool; a escala aplicada só muda
+    // quando a contínua se afasta um passo inteiro dela (histerese)
+    float scaleStep{0.05f};
+    RHI::TextureFormat colorFormat{RHI::TextureFormat::RGBA8};
+    RHI::TextureFormat depthFormat{RHI::TextureFormat::Depth24Stencil8};
+};
+
+// Controlador puro (sem GPU): converte tempos de frame medidos em escala de resolução.
+// Usa o tempo de GPU quando disponível (> 0); sem ele usa o tempo de CPU, que também reage a gargalos
+// de CPU (a escala desce até minScale sem ganho real). Não é thread-safe.
+class DynamicResolutionController {
+public:
+    explicit DynamicResolutionController(const DynamicResolutionDesc& desc = {});
+
+    // Uma vez por frame; retorna a escala aplicada (quantizada)
+    float update(float cpuFrameMs, float gpuFrameMs);
+    void reset();
+
+    float getScale() const { return appliedScale_; }
+    float getContinuousScale() const { return scale_; }
+    float getFilteredFrameMs() const { return filteredMs_; }
+    // GPU dentro do orçamento com o frame acima dele: reduzir a resolução não ajudaria
+    bool isCpuBound() const { return cpuBound_; }
+    const DynamicResolutionDesc& getDesc() const { return desc_; }
+
+private:
+    float quantize(float scale) const;
+
+    DynamicResolutionDesc desc_;
+    float scale_{1.0f};
+    float appliedScale_{1.0f};
+    float filteredMs_{0.0f};
+    float prevError_{0.0f};
+    float prevError2_{0.0f};
+    bool hasSample_{false};
+    bool cpuBound_{false};
+};
+
+struct DynamicResolutionStats {
+    uint32_t renderWidth{0};
+    uint32_t renderHeight{0};
+    float scale{1.0f};
+    float filteredFrameMs{0.0f};
+    float lastGpuFrameMs{0.0f};    // 0 sem Capabilities::supportsGpuTiming
+    bool cpuBound{false};
+    uint64_t resizeCount{0};       // mudanças do tamanho de render desde a criação
+};
+
+// Resolução dinâmica: a cena é renderizada em texturas transitórias do RenderGraph (vindas do
+// RenderTargetPool, como os ViewportResources do editor) no tamanho de saída * escala, e
+// addUpscalePass amplia o resultado com filtro bilinear no swapchain. update() realimenta o controlador
+// com o tempo de CPU do frame anterior e o tempo de GPU medido pelo device.
+// Uso por frame: update() -> createColorTarget/createDepthTarget + passes da cena -> addUpscalePass().
+// Não é thread-safe.
+class DynamicResolution {
+public:
+    explicit DynamicResolution(RHI::IDevice& device, const DynamicResolutionDesc& desc = {});
+    ~DynamicResolution();
+
+    DynamicResolution(const DynamicResolution&) = delete;
+    DynamicResolution& operator=(const DynamicResolution&) = delete;
+
+    // Shaders do upscale: triângulo de tela cheia gerado por gl_VertexID/gl_VertexIndex (sem vertex buffer)
+    // e fragment amostrando a cena no binding 0 (sampler2D). false se o pipeline não puder ser criado.
+    bool initialize(RHI::IShaderModule* upscaleVertex, RHI::IShaderModule* upscaleFragment);
+
+    void setDisplaySize(uint32_t width, uint32_t height);
+    void update(float cpuFrameMs);
+    // Desligado: escala fixa em maxScale (o upscale continua válido)
+    void setEnabled(bool enabled);
+
+    uint32_t getRenderWidth() const { return renderWidth_; }
+    uint32_t getRenderHeight() const { return renderHeight_; }
+    float getScale() const { return controller_.getScale(); }
+    RHI::TextureDesc getColorDesc() const;
+    RHI::TextureDesc getDepthDesc() const;
+
+    // Texturas da cena no tamanho de render corrente, declaradas no grafo do frame
+    RGTexture createColorTarget(RenderGraph& graph, const std::string& name = "SceneColor") const;
+    RGTexture createDepthTarget(RenderGraph& graph, const std::string& name = "SceneDepth") const;
+    // Pass "Upscale": lê source e escreve no backbuffer do swapchain
+    void addUpscalePass(RenderGraph& graph, RGTexture source, RHI::ISwapchain* swapchain, const float* clearColor = nullptr);
+
+    const DynamicResolutionController& getController() const { return controller_; }
+    const DynamicResolutionStats& getStats() const { return stats_; }
+
+private:
+    void applyScale(float scale);
+    RHI::IDescriptorSet* getUpscaleSet(RHI::ITexture* source, const RHI::RenderTargetPool& pool);
+
+    // Sets do upscale por textura de origem; o grafo tende a devolver as mesmas texturas do pool a cada
+    // frame. O cache é esvaziado quando o tamanho muda e quando o pool destrói alguma textura (evictionCount
+    // mudou): uma textura nova pode reaproveitar o endereço de uma destruída e herdar um set obsoleto
+    static constexpr size_t kMaxUpscaleSets = 8;
+
+    RHI::IDevice& device_;
+    DynamicResolutionController controller_;
+    bool enabled_{true};
+    uint32_t displayWidth_{0};
+    uint32_t displayHeight_{0};
+    uint32_t renderWidth_{0};
+    uint32_t renderHeight_{0};
+    std::unique_ptr<RHI::IGraphicsPipeline> upscalePipeline_;
+    std::unique_ptr<RHI::ISampler> sampler_;
+    std::vector<std::pair<RHI::ITexture*, std::unique_ptr<RHI::IDescriptorSet>>> upscaleSets_;
+    const RHI::RenderTargetPool* upscaleSetsPool_{nullptr};
+    uint64_t upscaleSetsEvictions_{0};
+    DynamicResolutionStats stats_{};
+};
+
+}
@@ -0,0 +1,237 @@
+#pragma once
+
+#include "Aurora/RHI/RHI.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Aurora::Renderer {
+
+class MaterialSystem;
+class MaterialTemplate;
+
+// Textura amostrada pelo material (layout(binding = N) uniform sampler2D ...)
+struct MaterialTextureSlot {
+    uint32_t binding{0};
+    const char* uniformName{nullptr}; // opcional: lookup por nome em vez de binding (GLSL)
+};
+
+struct MaterialTemplateDesc {
+    std::string name;
+    RHI::IShaderModule* vertexShader{nullptr};
+    RHI::IShaderModule* fragmentShader{nullptr};
+    RHI::VertexLayoutDesc vertexLayout{};
+    RHI::PipelineStateDesc state{};   // estado da variante 0
+    // Bloco de parâmetros por instância: layout(std140, binding = parameterBinding) uniform <parameterBlockName>.
+    // parameterLayout.cppSize define o tamanho (0 = material sem parâmetros); com campos descritos o layout
+    // também é verificado contra o shader na criação dos pipelines (GL)
+    uint32_t parameterBinding{0};
+    const char* parameterBlockName{nullptr};
+    RHI::BlockLayoutDesc parameterLayout{};
+    std::vector<MaterialTextureSlot> textureSlots;
+    // UBOs comuns a todas as instâncias (ex.: câmera); entram em todo descriptor set do template e não podem ser dinâmicos
+    std::vector<RHI::UniformBinding> sharedUniforms;
+    // Instâncias por UBO de parâmetros (página)
+    uint32_t instancesPerPage{256};
+};
+
+struct MaterialVariantDesc {
+    RHI::PipelineStateDesc state{};
+    RHI::IShaderModule* vertexShader{nullptr};   // nullptr = shader do template
+    RHI::IShaderModule* fragmentShader{nullptr};
+    bool translucent{false};                     // ordenado de trás para frente, depois dos opacos
+};
+
+// Chave de ordenação de 64 bits (ordem crescente = ordem de submissão):
+//   opaco:       [63]=0 | [62..48] pipeline | [47..24] conjunto de texturas | [23..0] profundidade (perto -> longe)
+//   translúcido: [63]=1 | [62..39] profundidade invertida (longe -> perto) | [38..24] pipeline | [23..0] texturas
+// Opacos agrupam por pipeline e depois por texturas para minimizar trocas de estado.
+namespace MaterialSortKey {
+constexpr uint32_t kPipelineBits = 15;
+constexpr uint32_t kTextureSetBits = 24;
+constexpr uint32_t kDepthBits = 24;
+
+// depth normalizado em [0, 1] (valores fora são saturados)
+constexpr uint32_t quantizeDepth(float depth) {
+    const float d = depth < 0.0f ? 0.0f : (depth > 1.0f ? 1.0f : depth);
+    return static_cast<uint32_t>(d * static_cast<float>((1u << kDepthBits) - 1u));
+}
+
+constexpr uint64_t make(uint32_t pipelineId, uint32_t textureSetId, float depth, bool translucent) {
+    const uint64_t pipeline = pipelineId & ((1u << kPipelineBits) - 1u);
+    const uint64_t textures = textureSetId & ((1u << kTextureSetBits) - 1u);
+    const uint64_t z = quantizeDepth(depth);
+    if (!translucent) return (pipeline << 48) | (textures << 24) | z;
+    const uint64_t invZ = ((1u << kDepthBits) - 1u) - z;
+    return (1ull << 63) | (invZ << 39) | (pipeline << 24) | textures;
+}
+}
+
+// Instância: parâmetros num slot estável do UBO paginado do template + texturas próprias.
+// Descriptor sets são compartilhados entre instâncias da mesma página com as mesmas texturas.
+class MaterialInstance {
+public:
+    MaterialTemplate& getTemplate() const { return *template_; }
+    // Índice estável do slot de parâmetros enquanto a instância existir
+    uint32_t getParameterIndex() const { return parameterIndex_; }
+
+    uint16_t getVariant() const { return variant_; }
+    bool setVariant(uint16_t variant);
+
+    // Copia os parâmetros para a cópia em CPU; o upload acontece no MaterialSystem::flush()
+    bool setParameters(const void* data, size_t bytes);
+    template <typename T>
+    bool setParameters(const T& params) { return setParameters(&params, sizeof(T)); }
+    const void* getParameters() const;
+
+    bool setTexture(uint32_t slot, RHI::ITexture* texture, RHI::ISampler* sampler);
+
+    uint64_t getSortKey(float depth) const;
+    RHI::IGraphicsPipeline* getPipeline() const;
+    RHI::IDescriptorSet* getDescriptorSet() const;
+    // Offset dinâmico do slot de parâmetros (vazio se o template não tem parâmetros)
+    std::span<const uint32_t> getDynamicOffsets() const;
+
+    // Aplica pipeline + descriptor set (ICommandList, ICommandBundle ou RHI::Backend::CommandList)
+    template <typename Recorder>
+    void bind(Recorder& cmd) const {
+        cmd.setGraphicsPipeline(getPipeline());
+        cmd.bindDescriptorSet(getDescriptorSet(), getDynamicOffsets());
+    }
+
+private:
+    friend class MaterialTemplate;
+    MaterialInstance(MaterialTemplate& owner, uint32_t parameterIndex);
+
+    struct TextureBinding {
+        RHI::ITexture* texture{nullptr};
+        RHI::ISampler* sampler{nullptr};
+        bool operator==(const TextureBinding&) const = default;
+    };
+
+    MaterialTemplate* template_;
+    uint32_t parameterIndex_;
+    uint32_t dynamicOffset_{0};
+    uint16_t variant_{0};
+    uint32_t textureSetId_{0};
+    std::vector<TextureBinding> textures_;
+};
+
+struct MaterialStats {
+    uint32_t templateCount{0};
+    uint32_t variantCount{0};
+    uint32_t instanceCount{0};
+    uint32_t parameterPageCount{0};
+    uint32_t descriptorSetCount{0};
+    uint64_t uploadedBytes{0};     // último flush
+};
+
+// Template: shaders, layout de parâmetros e slots de textura; possui os pipelines das variantes,
+// os UBOs de parâmetros (páginas) e os descriptor sets compartilhados.
+class MaterialTemplate {
+public:
+    static constexpr uint16_t kInvalidVariant = 0xFFFF;
+
+    ~MaterialTemplate();
+
+    const std::string& getName() const { return desc_.name; }
+    const MaterialTemplateDesc& getDesc() const { return desc_; }
+
+    // Cria o pipeline da variante; retorna o índice ou kInvalidVariant em falha
+    uint16_t addVariant(const MaterialVariantDesc& desc);
+    uint32_t getVariantCount() const { return static_cast<uint32_t>(variants_.size()); }
+    RHI::IGraphicsPipeline* getPipeline(uint16_t variant) const;
+
+    MaterialInstance* createInstance();
+    void destroyInstance(MaterialInstance* instance);
+    uint32_t getInstanceCount() const { return instanceCount_; }
+
+    size_t getParameterSize() const { return desc_.parameterLayout.cppSize; }
+    uint32_t getParameterStride() const { return parameterStride_; }
+
+private:
+    friend class MaterialSystem;
+    friend class MaterialInstance;
+
+    MaterialTemplate(MaterialSystem& system, const MaterialTemplateDesc& desc);
+    bool initialize();
+
+    struct Variant {
+        std::unique_ptr<RHI::IGraphicsPipeline> pipeline;
+        uint32_t pipelineId{0};
+        bool translucent{false};
+    };
+
+    // Página de parâmetros: UBO + cópia em CPU e faixa suja desde o último flush
+    struct Page {
+        std::unique_ptr<RHI::IBuffer> buffer;
+        std::vector<uint8_t> shadow;
+        size_t dirtyBegin{SIZE_MAX};
+        size_t dirtyEnd{0};
+    };
+
+    // Descriptor set compartilhado por (página, texturas); liberado quando a última instância sai
+    struct SharedSet {
+        std::unique_ptr<RHI::IDescriptorSet> set;
+        uint32_t id{0};
+        uint32_t refCount{0};
+    };
+
+    uint32_t acquireSet(uint32_t page, const std::vector<MaterialInstance::TextureBinding>& textures);
+    void releaseSet(uint32_t id);
+    const SharedSet* findSet(uint32_t id) const;
+    uint64_t flush(RHI::IDevice& device);
+    static std::string makeSetKey(uint32_t page, const std::vector<MaterialInstance::TextureBinding>& textures);
+
+    MaterialSystem& system_;
+    MaterialTemplateDesc desc_;
+    uint32_t parameterStride_{0};
+    std::vector<Variant> variants_;
+    std::vector<Page> pages_;
+    std::vector<std::unique_ptr<MaterialInstance>> instances_;  // indexado pelo slot de parâmetros
+    std::vector<uint32_t> freeSlots_;
+    uint32_t instanceCount_{0};
+    std::unordered_map<std::string, uint32_t> setsByKey_;
+    std::unordered_map<uint32_t, SharedSet> sets_;
+};
+
+// Registro de templates; distribui ids de pipeline/conjunto de texturas usados nas chaves de ordenação.
+// Não é thread-safe: crie/edite materiais na thread principal e chame flush() antes de gravar o frame.
+class MaterialSystem {
+public:
+    explicit MaterialSystem(RHI::IDevice& device) : device_(device) {}
+    ~MaterialSystem();
+
+    MaterialSystem(const MaterialSystem&) = delete;
+    MaterialSystem& operator=(const MaterialSystem&) = delete;
+
+    // nullptr em falha (nome repetido, shaders ausentes, pipeline inválido)
+    MaterialTemplate* createTemplate(const MaterialTemplateDesc& desc);
+    MaterialTemplate* findTemplate(const std::string& name) const;
+
+    // Envia as faixas de parâmetros modificadas desde o último flush
+    void flush();
+
+    RHI::IDevice& getDevice() const { return device_; }
+    MaterialStats getStats() const;
+
+private:
+    friend class MaterialTemplate;
+
+    uint32_t allocatePipelineId() { return nextPipelineId_++; }
+    uint32_t allocateTextureSetId();
+    void releaseTextureSetId(uint32_t id) { freeTextureSetIds_.push_back(id); }
+
+    RHI::IDevice& device_;
+    std::vector<std::unique_ptr<MaterialTemplate>> templates_;
+    uint32_t nextPipelineId_{0};
+    uint32_t nextTextureSetId_{0};
+    std::vector<uint32_t> freeTextureSetIds_;
+    uint64_t lastUploadedBytes_{0};
+};
+
+}
@@ -0,0 +1,211 @@
+#pragma once
+
+#include "Aurora/Core/JobSystem.hpp"
+#include "Aurora/RHI/RHI.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Aurora::Renderer {
+
+// Handles de recursos do grafo (válidos apenas até o próximo reset())
+struct RGTexture {
+    static constexpr uint32_t kInvalid = 0xFFFFFFFFu;
+    uint32_t id{kInvalid};
+    bool isValid() const { return id != kInvalid; }
+};
+
+struct RGBuffer {
+    static constexpr uint32_t kInvalid = 0xFFFFFFFFu;
+    uint32_t id{kInvalid};
+    bool isValid() const { return id != kInvalid; }
+};
+
+class RenderGraph;
+
+// Declaração de dependências de um pass (usado apenas dentro do setup)
+class RenderGraphBuilder {
+public:
+    // Textura amostrada/lida pelo pass
+    RGTexture read(RGTexture texture);
+    // Attachment de cor; clearColor == nullptr carrega o conteúdo anterior
+    RGTexture writeColor(RGTexture texture, const float* clearColor = nullptr);
+    RGTexture writeDepth(RGTexture texture, bool clear = true, float clearDepth = 1.0f);
+    RGBuffer read(RGBuffer buffer);
+    RGBuffer write(RGBuffer buffer);
+    // Renderiza no backbuffer do swapchain (implica side effect: o pass nunca é descartado)
+    void writeSwapchain(RHI::ISwapchain* swapchain, const float* clearColor = nullptr);
+    // Impede o culling mesmo sem saídas consumidas (ex.: readback, queries)
+    void setSideEffect();
+
+private:
+    friend class RenderGraph;
+    RenderGraphBuilder(RenderGraph& graph, uint32_t pass) : graph_(graph), pass_(pass) {}
+    RenderGraph& graph_;
+    uint32_t pass_;
+};
+
+// Acesso aos recursos físicos durante a gravação de um pass
+class RenderGraphContext {
+public:
+    RHI::ICommandList& getCommandList() { return cmd_; }
+    RHI::ITexture* getTexture(RGTexture texture) const;
+    RHI::IBuffer* getBuffer(RGBuffer buffer) const;
+
+private:
+    friend class RenderGraph;
+    RenderGraphContext(const RenderGraph& graph, RHI::ICommandList& cmd) : graph_(graph), cmd_(cmd) {}
+    const RenderGraph& graph_;
+    RHI::ICommandList& cmd_;
+};
+
+struct RenderGraphStats {
+    uint32_t passCount{0};
+    uint32_t culledPassCount{0};
+    uint32_t levelCount{0};           // níveis de dependência (passes de um nível gravam em paralelo)
+    uint32_t transientTextureCount{0};
+    uint32_t physicalTextureCount{0}; // após aliasing
+    uint64_t transientTextureBytes{0}; // memória sem aliasing
+    uint64_t physicalTextureBytes{0};  // memória realmente alocada
+    uint32_t transientBufferCount{0};
+    uint32_t physicalBufferCount{0};
+};
+
+// Grafo de frame: passes declaram o que leem e escrevem; compile() descarta passes sem saída consumida,
+// ordena topologicamente e faz aliasing de texturas/buffers transitórios com tempos de vida disjuntos;
+// execute() grava os passes de cada nível de dependência em paralelo (no JobSystem) e submete na ordem
+// topológica.
+// Uso por frame: reset() -> create/import + addPass -> compile() -> execute().
+class RenderGraph {
+public:
+    using SetupFn = std::function<void(RenderGraphBuilder&)>;
+    using ExecuteFn = std::function<void(RenderGraphContext&)>;
+
+    // Texturas transitórias vêm do pool informado (compartilhado com outros sistemas) ou de um pool próprio
+    explicit RenderGraph(RHI::IDevice& device, RHI::RenderTargetPool* pool = nullptr);
+    ~RenderGraph();
+
+    // Limpa passes e recursos declarados e devolve as texturas do frame anterior ao pool
+    void reset();
+
+    RGTexture createTexture(const std::string& name, const RHI::TextureDesc& desc);
+    RGTexture importTexture(const std::string& name, RHI::ITexture* texture);
+    RGBuffer createBuffer(const std::string& name, size_t bytes, RHI::BufferUsage usage);
+    RGBuffer importBuffer(const std::string& name, RHI::IBuffer* buffer);
+    // Marca um recurso como saída do frame: seus produtores não são descartados
+    void markOutput(RGTexture texture);
+    void markOutput(RGBuffer buffer);
+
+    void addPass(const std::string& name, const SetupFn& setup, ExecuteFn execute);
+
+    bool compile();
+    void execute();
+
+    // Threads de gravação (1 = grava tudo na thread chamadora); só vale com um JobSystem
+    void setMaxRecordingThreads(uint32_t count) { maxRecordingThreads_ = count ? count : 1; }
+    // Com um JobSystem os passes de cada nível viram jobs (um por pass) distribuídos entre os workers;
+    // sem ele, ou com maxRecordingThreads = 1, a gravação é serial na thread chamadora
+    void setJobSystem(Core::JobSystem* jobs) { jobs_ = jobs; }
+    // Frames sem uso antes de liberar um recurso físico do cache (buffers e pool próprio)
+    void setPhysicalRetainFrames(uint32_t frames);
+
+    const RenderGraphStats& getStats() const { return stats_; }
+    // Pool de onde vêm as texturas transitórias (o informado no construtor ou o próprio)
+    const RHI::RenderTargetPool& getTexturePool() const { return *pool_; }
+    // Ordem de execução dos passes não descartados (nomes), útil para debug
+    std::vector<std::string> getExecutionOrder() const;
+
+private:
+    friend class RenderGraphBuilder;
+    friend class RenderGraphContext;
+
+    static constexpr uint32_t kNone = 0xFFFFFFFFu;
+
+    struct Resource {
+        std::string name;
+        bool isTexture{true};
+        bool imported{false};
+        bool output{false};
+        RHI::TextureDesc textureDesc{};
+        size_t bufferBytes{0};
+        RHI::BufferUsage bufferUsage{RHI::BufferUsage::Uniform};
+        RHI::ITexture* externalTexture{nullptr};
+        RHI::IBuffer* externalBuffer{nullptr};
+        std::vector<uint32_t> writers;
+        std::vector<uint32_t> readers;
+        uint32_t firstUse{kNone};
+        uint32_t lastUse{kNone};
+        uint32_t physical{kNone};
+    };
+
+    struct ColorTarget {
+        uint32_t resource{kNone};
+        bool clear{false};
+        float clearColor[4]{0.0f, 0.0f, 0.0f, 1.0f};
+    };
+
+    struct Pass {
+        std::string name;
+        ExecuteFn execute;
+        std::vector<uint32_t> reads;
+        std::vector<uint32_t> writes;
+        std::vector<ColorTarget> colorTargets;
+        uint32_t depthTarget{kNone};
+        bool clearDepth{true};
+        float clearDepthValue{1.0f};
+        RHI::ISwapchain* swapchain{nullptr};
+        bool swapchainClear{false};
+        float swapchainClearColor[4]{0.0f, 0.0f, 0.0f, 1.0f};
+        bool sideEffect{false};
+        bool culled{true};
+        uint32_t level{0};
+        std::unique_ptr<RHI::IRenderPass> renderPass;
+        RHI::ICommandList* cmd{nullptr};
+    };
+
+    // Textura física do frame (emprestada do pool até o próximo reset)
+    struct TextureSlot {
+        RHI::TextureDesc desc{};
+        RHI::ITexture* texture{nullptr};
+        uint32_t busyUntil{0};   // último índice de execução ocupado no frame corrente
+    };
+
+    struct PhysicalBuffer {
+        size_t bytes{0};
+        RHI::BufferUsage usage{RHI::BufferUsage::Uniform};
+        std::unique_ptr<RHI::IBuffer> buffer;
+        uint32_t busyUntil{0};
+        bool assigned{false};
+        uint32_t unusedFrames{0};
+    };
+
+    void addRead(uint32_t pass, uint32_t resource);
+    void addWrite(uint32_t pass, uint32_t resource);
+    bool isValidResource(uint32_t id, bool texture) const;
+    RHI::ITexture* resolveTexture(uint32_t id) const;
+    RHI::IBuffer* resolveBuffer(uint32_t id) const;
+    void assignPhysicalResources();
+    void releaseTextureSlots();
+    void recordPass(Pass& pass);
+
+    RHI::IDevice& device_;
+    std::unique_ptr<RHI::RenderTargetPool> ownedPool_;
+    RHI::RenderTargetPool* pool_{nullptr};
+    std::vector<Resource> resources_;
+    std::vector<Pass> passes_;
+    std::vector<uint32_t> order_;        // passes não descartados em ordem de execução
+    std::vector<uint32_t> levelStarts_;  // início de cada nível em order_
+    std::vector<TextureSlot> textureSlots_;
+    std::vector<PhysicalBuffer> physicalBuffers_;
+    std::vector<std::unique_ptr<RHI::ICommandList>> commandLists_;
+    RenderGraphStats stats_{};
+    uint32_t maxRecordingThreads_{4};
+    Core::JobSystem* jobs_{nullptr};
+    uint32_t retainFrames_{3};
+    bool compiled_{false};
+};
+
+}
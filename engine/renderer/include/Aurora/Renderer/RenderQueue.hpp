@@ -0,0 +1,138 @@
+#pragma once
+
+#include "Aurora/Core/JobSystem.hpp"
+#include "Aurora/RHI/RHI.hpp"
+#include "Aurora/Renderer/ThreadBuckets.hpp"
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace Aurora::Renderer {
+
+class MaterialInstance;
+
+// Draw autocontido: estado completo + faixa de vértices/índices + chave de ordenação
+struct DrawPacket {
+    static constexpr uint32_t kMaxDynamicOffsets = 4;
+
+    RHI::IGraphicsPipeline* pipeline{nullptr};
+    RHI::IDescriptorSet* descriptorSet{nullptr};
+    std::array<uint32_t, kMaxDynamicOffsets> dynamicOffsets{};
+    uint32_t dynamicOffsetCount{0};
+    RHI::IBuffer* vertexBuffer{nullptr};
+    RHI::IBuffer* indexBuffer{nullptr};   // nullptr = draw não indexado
+    RHI::IndexType indexType{RHI::IndexType::Uint32};
+    uint32_t count{0};                    // vértices ou índices
+    uint32_t first{0};
+    uint64_t sortKey{0};                  // ordem crescente = ordem de emissão (ver MaterialSortKey)
+    // Dados por instância (ex.: transform) no formato de VertexLayoutDesc::instanceAttributes do pipeline,
+    // com instanceDataSize == instanceStride. Memória do chamador, válida até o emit(). Pacotes com dados
+    // por instância que compartilham estado e malha viram um único draw instanciado.
+    const void* instanceData{nullptr};
+    uint32_t instanceDataSize{0};
+};
+
+struct RenderQueueStats {
+    uint32_t packetCount{0};
+    uint32_t bucketCount{0};           // threads que submeteram no frame
+    uint32_t sortThreads{0};           // pedaços do radix sort (1 = serial)
+    uint32_t sortPasses{0};            // passes de 8 bits realmente executados
+    uint32_t drawCount{0};
+    uint32_t pipelineBinds{0};
+    uint32_t descriptorSetBinds{0};
+    uint32_t vertexBufferBinds{0};
+    uint32_t indexBufferBinds{0};
+    uint32_t redundantBindsSkipped{0};
+    uint32_t instancedDrawCount{0};
+    uint32_t mergedPacketCount{0};     // pacotes absorvidos por um draw instanciado de outro pacote
+    uint64_t instanceBytes{0};         // enviados ao buffer de instâncias no emit()
+};
+
+// Fila de draws do frame. submit() pode ser chamado de qualquer thread: cada thread escreve num bucket
+// próprio (sem lock após o primeiro submit do frame). sort() ordena todas as chaves de 64 bits com radix
+// sort LSD (paralelo no JobSystem para filas grandes, pulando bytes iguais em todas as chaves) e emit() grava os draws
+// em ordem removendo binds redundantes. Com instancing, pacotes opacos de um mesmo grupo de estado
+// (pipeline + descriptor set) são agrupados por malha e cada grupo vira um draw instanciado, com os dados
+// por instância copiados para um buffer transitório (um por frame em voo); translúcidos só fundem draws
+// vizinhos para preservar a ordem de trás para frente.
+// Uso por frame: reset() -> submit()... -> sort() -> emit(). reset/sort/emit na thread dona, sem submits
+// concorrentes; os pacotes valem até o próximo reset().
+class RenderQueue {
+public:
+    explicit RenderQueue(RHI::IDevice& device);
+    ~RenderQueue();
+
+    RenderQueue(const RenderQueue&) = delete;
+    RenderQueue& operator=(const RenderQueue&) = delete;
+
+    void reset();
+    void submit(const DrawPacket& packet);
+
+    void sort();
+    void emit(RHI::ICommandList& cmd);
+
+    // Chave no formato de MaterialSortKey para pacotes sem material (ids derivados dos ponteiros;
+    // colisões apenas intercalam estados, sem afetar a corretude)
+    static uint64_t makeSortKey(const DrawPacket& packet, float depth, bool translucent);
+    // Pipeline, descriptor set, offsets dinâmicos e chave do material; buffers/faixa ficam com o chamador
+    static DrawPacket makePacket(const MaterialInstance& material, float depth);
+
+    // Pedaços paralelos do radix sort (filas pequenas sempre ordenam na thread chamadora)
+    void setMaxSortThreads(uint32_t count) { maxSortThreads_ = count ? count : 1; }
+    // Sem JobSystem o sort roda inteiro na thread chamadora
+    void setJobSystem(Core::JobSystem* jobs) { jobs_ = jobs; }
+    // Desligado: cada pacote com dados por instância vira um draw instanciado de 1 instância
+    void setInstancingEnabled(bool enabled) { instancing_ = enabled; }
+    size_t size() const;
+    const RenderQueueStats& getStats() const { return stats_; }
+
+private:
+    struct Bucket {
+        std::vector<DrawPacket> packets;
+    };
+
+    struct SortItem {
+        uint64_t key;
+        const DrawPacket* packet;
+    };
+
+    // Draw a emitir: pacote representante + faixa no buffer de instâncias (instanceCount 0 = não instanciado)
+    struct Batch {
+        const DrawPacket* packet;
+        uint32_t instanceCount;
+        uint32_t firstInstance;
+    };
+
+    // Malhas de um grupo de estado: lista ligada de itens pelo índice em items_
+    struct MeshGroup {
+        uint32_t head;
+        uint32_t tail;
+    };
+
+    void radixSort(uint32_t threads);
+    void buildBatches();
+    void groupStateRun(size_t begin, size_t end);
+    void addBatch(const DrawPacket& packet, bool mergeWithPrevious);
+    RHI::IBuffer* uploadInstanceData();
+
+    RHI::IDevice& device_;
+    ThreadBuckets<Bucket> buckets_;
+    std::vector<SortItem> items_;
+    std::vector<SortItem> scratch_;
+    uint32_t maxSortThreads_{4};
+    Core::JobSystem* jobs_{nullptr};
+    bool instancing_{true};
+    bool sorted_{false};
+    std::vector<Batch> batches_;
+    std::vector<MeshGroup> meshGroups_;
+    std::vector<uint32_t> nextInGroup_;
+    std::unordered_map<uint64_t, uint32_t> meshLookup_; // hash da malha -> meshGroups_ (por grupo de estado)
+    std::vector<uint8_t> instanceStaging_;
+    std::vector<std::unique_ptr<RHI::IBuffer>> instanceBuffers_;  // um por frame em voo
+    RenderQueueStats stats_{};
+};
+
+}
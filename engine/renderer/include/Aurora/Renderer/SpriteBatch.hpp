@@ -0,0 +1,149 @@
+#pragma once
+
+#include "Aurora/RHI/RHI.hpp"
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace Aurora::Renderer {
+
+// Vértice do batch: posição já em NDC (convertida na CPU), uv e cor. Layout do sprite.vert.glsl:
+// location 0 = vec2 posição, 1 = vec2 uv, 2 = vec4 cor
+struct SpriteVertex {
+    float x, y;
+    float u, v;
+    float r, g, b, a;
+};
+
+// Quad em pixels (origem no canto superior esquerdo do viewport)
+struct Sprite {
+    RHI::ITexture* texture{nullptr};   // nullptr = branco (retângulos sólidos)
+    float x{0.0f};
+    float y{0.0f};
+    float width{0.0f};
+    float height{0.0f};
+    float u0{0.0f}, v0{0.0f}, u1{1.0f}, v1{1.0f};
+    float color[4]{1.0f, 1.0f, 1.0f, 1.0f};
+    float rotation{0.0f};              // radianos, em torno do pivô
+    float pivotX{0.0f};                // fração do tamanho; (0,0) = canto superior esquerdo
+    float pivotY{0.0f};
+    uint16_t layer{0};                 // camadas maiores por cima; dentro da camada a ordem é por textura
+};
+
+struct Glyph {
+    float u0{0.0f}, v0{0.0f}, u1{0.0f}, v1{0.0f};
+    float width{0.0f};
+    float height{0.0f};
+    float offsetX{0.0f};
+    float offsetY{0.0f};               // do topo da linha ao topo do glifo
+    float advance{0.0f};
+};
+
+// Fonte bitmap ASCII: glifos de uma página de atlas (caracteres fora da tabela são ignorados)
+struct BitmapFont {
+    RHI::ITexture* texture{nullptr};
+    float lineHeight{0.0f};
+    std::array<Glyph, 128> glyphs{};
+};
+
+struct SpriteBatchStats {
+    uint32_t spriteCount{0};
+    uint32_t drawCount{0};
+    uint32_t textureCount{0};          // texturas distintas no frame
+    uint64_t vertexBytes{0};           // enviados ao buffer do frame
+    bool sortSkipped{false};           // submissões já vinham em ordem
+};
+
+// Batch 2D de sprites, retângulos e glifos. Os vértices de todos os quads vão para um único vertex buffer
+// por frame em voo (um updateBuffer no end()); os quads são ordenados por camada e textura/página de atlas
+// e cada sequência com a mesma textura vira um drawIndexed sobre um index buffer estático de quads.
+// Uso por frame: begin() -> draw/drawRect/drawText... -> end() na thread dona; record() grava os draws num
+// render pass já aberto (pode rodar na thread de gravação de um pass do RenderGraph) e vale até o próximo
+// begin(). Não é thread-safe.
+class SpriteBatch {
+public:
+    explicit SpriteBatch(RHI::IDevice& device);
+    ~SpriteBatch();
+
+    SpriteBatch(const SpriteBatch&) = delete;
+    SpriteBatch& operator=(const SpriteBatch&) = delete;
+
+    // Shaders do layout de SpriteVertex com a textura no binding 0 (sampler2D); cria também a textura
+    // branca e a fonte de debug. false se algum recurso não puder ser criado.
+    bool initialize(RHI::IShaderModule* vertexShader, RHI::IShaderModule* fragmentShader);
+
+    // Amostragem da textura (padrão Linear; a fonte de debug usa Nearest). Entre frames, fora da gravação
+    void setTextureFilter(RHI::ITexture* texture, RHI::FilterMode filter);
+    // Descarta o descriptor set em cache da textura; chamar antes de destruí-la
+    void forgetTexture(RHI::ITexture* texture);
+
+    void begin(uint32_t viewportWidth, uint32_t viewportHeight);
+    void draw(const Sprite& sprite);
+    void drawRect(float x, float y, float width, float height, const float* color, uint16_t layer = 0);
+    // '\n' quebra linha; retorna a largura da linha mais longa em pixels
+    float drawText(const BitmapFont& font, float x, float y, std::string_view text,
+                   const float* color = nullptr, float scale = 1.0f, uint16_t layer = 0);
+    static float measureText(const BitmapFont& font, std::string_view text, float scale = 1.0f);
+    void end();
+
+    void record(RHI::ICommandList& cmd) const;
+
+    // Fonte 5x7 embutida (ASCII 32..126), para estatísticas e debug; use escalas inteiras
+    const BitmapFont& getDebugFont() const { return debugFont_; }
+    const SpriteBatchStats& getStats() const { return stats_; }
+
+private:
+    struct Batch {
+        RHI::IDescriptorSet* set;
+        uint32_t firstQuad;
+        uint32_t quadCount;
+    };
+
+    struct TextureEntry {
+        std::unique_ptr<RHI::IDescriptorSet> set;
+        RHI::FilterMode filter{RHI::FilterMode::Linear};
+    };
+
+    static constexpr size_t kMinVertexBufferBytes = 64 * 1024;
+    static constexpr uint32_t kMinQuadCapacity = 1024;
+
+    uint32_t textureSlot(RHI::ITexture* texture);
+    void sortKeys();
+    RHI::IDescriptorSet* getDescriptorSet(RHI::ITexture* texture);
+    bool ensureIndexCapacity(uint32_t quads);
+    RHI::IBuffer* uploadVertices(const std::vector<SpriteVertex>& vertices);
+    bool createDebugFont();
+
+    RHI::IDevice& device_;
+    std::unique_ptr<RHI::IGraphicsPipeline> pipeline_;
+    std::unique_ptr<RHI::ISampler> linearSampler_;
+    std::unique_ptr<RHI::ISampler> nearestSampler_;
+    std::unique_ptr<RHI::ITexture> whiteTexture_;
+    std::unique_ptr<RHI::ITexture> debugFontTexture_;
+    BitmapFont debugFont_{};
+    std::unordered_map<RHI::ITexture*, TextureEntry> textures_;
+
+    float scaleX_{0.0f};               // pixels -> NDC
+    float scaleY_{0.0f};
+    std::vector<SpriteVertex> vertices_;   // 4 por quad, na ordem de submissão
+    std::vector<uint64_t> keys_;           // camada | slot da textura | índice do quad
+    std::vector<uint64_t> scratchKeys_;
+    std::vector<RHI::ITexture*> frameTextures_;
+    std::unordered_map<RHI::ITexture*, uint32_t> frameSlots_;
+    RHI::ITexture* lastTexture_{nullptr};
+    uint32_t lastSlot_{0};
+    std::vector<SpriteVertex> sorted_;
+    std::vector<Batch> batches_;
+
+    std::vector<std::unique_ptr<RHI::IBuffer>> vertexBuffers_;  // um por frame em voo
+    RHI::IBuffer* frameVertexBuffer_{nullptr};
+    std::unique_ptr<RHI::IBuffer> indexBuffer_;
+    uint32_t quadCapacity_{0};
+    SpriteBatchStats stats_{};
+};
+
+}
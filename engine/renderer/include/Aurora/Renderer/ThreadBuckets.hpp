@@ -0,0 +1,73 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Aurora::Renderer {
+
+// Buckets de submissão por thread (RenderQueue, DebugDraw). acquire() pode ser chamado de qualquer thread:
+// cada uma recebe um bucket próprio, guardado num cache thread_local chaveado pela época, e só o primeiro
+// acquire da thread na época toma o lock. clear() abre uma nova época (na thread dona, sem acquires
+// concorrentes); os buckets são reaproveitados e esvaziá-los fica com quem os usa.
+template <typename Bucket>
+class ThreadBuckets {
+public:
+    ThreadBuckets() : epoch_(nextEpoch()) {}
+
+    ThreadBuckets(const ThreadBuckets&) = delete;
+    ThreadBuckets& operator=(const ThreadBuckets&) = delete;
+
+    Bucket& acquire();
+    void clear() {
+        active_ = 0;
+        epoch_ = nextEpoch();
+    }
+
+    // Buckets entregues na época atual
+    uint32_t size() const { return active_; }
+    Bucket& operator[](uint32_t index) { return *buckets_[index]; }
+    const Bucket& operator[](uint32_t index) const { return *buckets_[index]; }
+
+private:
+    // Entradas do cache por thread: uma thread pode alimentar várias instâncias por frame (ex.: uma por view)
+    static constexpr uint32_t kCacheSize = 8;
+
+    static uint64_t nextEpoch() {
+        static std::atomic<uint64_t> next{1};
+        return next.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    uint64_t epoch_{0};
+    std::mutex mutex_;
+    std::vector<std::unique_ptr<Bucket>> buckets_;  // reaproveitados entre épocas
+    uint32_t active_{0};
+};
+
+template <typename Bucket>
+Bucket& ThreadBuckets<Bucket>::acquire() {
+    struct CacheEntry {
+        uint64_t epoch{0};
+        Bucket* bucket{nullptr};
+    };
+    thread_local std::array<CacheEntry, kCacheSize> cache{};
+    thread_local uint32_t nextEntry = 0;
+
+    for (const auto& e : cache) {
+        if (e.epoch == epoch_) return *e.bucket;
+    }
+    Bucket* bucket = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (active_ == buckets_.size()) buckets_.push_back(std::make_unique<Bucket>());
+        bucket = buckets_[active_++].get();
+    }
+    cache[nextEntry] = {epoch_, bucket};
+    nextEntry = (nextEntry + 1) % kCacheSize;
+    return *bucket;
+}
+
+}
@@ -0,0 +1,315 @@
+#include "Aurora/Renderer/DebugDraw.hpp"
+#include "Aurora/Core/Log.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <string>
+
+namespace Aurora::Renderer {
+
+namespace {
+    constexpr uint32_t kCircleSegments = 24;
+
+    // Arestas de uma caixa cujos cantos são indexados pelos bits (x, y, z)
+    constexpr uint8_t kBoxEdges[12][2] = {
+        {0, 1}, {2, 3}, {4, 5}, {6, 7},
+        {0, 2}, {1, 3}, {4, 6}, {5, 7},
+        {0, 4}, {1, 5}, {2, 6}, {3, 7},
+    };
+    // Duas faces triangulares por lado, com o mesmo índice de cantos
+    constexpr uint8_t kBoxTriangles[12][3] = {
+        {0, 2, 6}, {0, 6, 4}, {1, 5, 7}, {1, 7, 3},
+        {0, 4, 5}, {0, 5, 1}, {2, 3, 7}, {2, 7, 6},
+        {0, 1, 3}, {0, 3, 2}, {4, 6, 7}, {4, 7, 5},
+    };
+
+    struct CircleTable {
+        float cosines[kCircleSegments + 1];
+        float sines[kCircleSegments + 1];
+    };
+
+    const CircleTable& circleTable() {
+        static const CircleTable table = [] {
+            CircleTable t{};
+            for (uint32_t i = 0; i <= kCircleSegments; ++i) {
+                const float angle = 6.28318530718f * static_cast<float>(i % kCircleSegments) / kCircleSegments;
+                t.cosines[i] = std::cos(angle);
+                t.sines[i] = std::sin(angle);
+            }
+            return t;
+        }();
+        return table;
+    }
+
+    DebugVec3 transformPoint(const float* m, const DebugVec3& p) {
+        return {m[0] * p.x + m[4] * p.y + m[8] * p.z + m[12],
+                m[1] * p.x + m[5] * p.y + m[9] * p.z + m[13],
+                m[2] * p.x + m[6] * p.y + m[10] * p.z + m[14]};
+    }
+
+    DebugVertex makeVertex(const DebugVec3& p, const DebugColor& c) {
+        return {p.x, p.y, p.z, c.r, c.g, c.b, c.a};
+    }
+
+    void boxCorners(const DebugVec3& min, const DebugVec3& max, const float* transform, DebugVec3 corners[8]) {
+        for (uint32_t i = 0; i < 8; ++i) {
+            const DebugVec3 p{(i & 1) ? max.x : min.x, (i & 2) ? max.y : min.y, (i & 4) ? max.z : min.z};
+            corners[i] = transform ? transformPoint(transform, p) : p;
+        }
+    }
+}
+
+DebugDraw::DebugDraw(RHI::IDevice& device) : device_(device) {}
+
+DebugDraw::~DebugDraw() = default;
+
+bool DebugDraw::initialize(RHI::IShaderModule* vertexShader, RHI::IShaderModule* fragmentShader) {
+    if constexpr (!kDebugDrawEnabled) return true;
+    if (!vertexShader || !fragmentShader) {
+        Core::log(Core::LogLevel::Error, "DebugDraw: shaders ausentes");
+        return false;
+    }
+    RHI::GraphicsPipelineDesc p{};
+    p.vertexShader = vertexShader;
+    p.fragmentShader = fragmentShader;
+    p.vertexLayout.stride = sizeof(DebugVertex);
+    p.vertexLayout.attributes.push_back({0, 3, offsetof(DebugVertex, x)});
+    p.vertexLayout.attributes.push_back({1, 4, offsetof(DebugVertex, r)});
+    p.state.raster.cullMode = RHI::CullMode::None;
+    p.state.blend.enable = true;
+    // Nunca escreve depth: as primitivas de debug não devem esconder a cena nem umas às outras
+    p.state.depthStencil.depthWriteEnable = false;
+    p.state.depthStencil.depthFunc = RHI::DepthFunc::LessEqual;
+    for (uint32_t s = 0; s < kStreamCount; ++s) {
+        p.state.topology = (s & 2) ? RHI::PrimitiveTopology::TriangleList : RHI::PrimitiveTopology::LineList;
+        p.state.depthStencil.depthTestEnable = (s & 1) == 0;
+        pipelines_[s] = device_.createGraphicsPipeline(p);
+        if (!pipelines_[s]) {
+            Core::log(Core::LogLevel::Error, "DebugDraw: falha ao criar pipeline " + std::to_string(s));
+            for (auto& pipeline : pipelines_) pipeline.reset();
+            return false;
+        }
+    }
+    return true;
+}
+
+DebugVertex* DebugDraw::append(uint32_t stream, uint32_t count, float duration) {
+    Stream& s = buckets_.acquire().streams[stream];
+    // resize só realoca quando passa da capacidade já atingida em frames anteriores
+    std::vector<DebugVertex>& target = duration > 0.0f ? s.timedVertices : s.vertices;
+    if (duration > 0.0f) s.timedSpans.push_back({count, duration});
+    const size_t first = target.size();
+    target.resize(first + count);
+    return target.data() + first;
+}
+
+void DebugDraw::addLine(const DebugVec3& a, const DebugVec3& b, const DebugColor& color, DebugDepth depth, float duration) {
+    DebugVertex* v = append(streamIndex(false, depth), 2, duration);
+    v[0] = makeVertex(a, color);
+    v[1] = makeVertex(b, color);
+}
+
+void DebugDraw::addBox(const DebugVec3& min, const DebugVec3& max, const float* transform, const DebugColor& color,
+                       DebugDepth depth, float duration, bool solid) {
+    DebugVec3 corners[8];
+    boxCorners(min, max, transform, corners);
+    if (solid) {
+        DebugVertex* v = append(streamIndex(true, depth), 36, duration);
+        for (const auto& tri : kBoxTriangles) {
+            for (uint8_t corner : tri) *v++ = makeVertex(corners[corner], color);
+        }
+        return;
+    }
+    DebugVertex* v = append(streamIndex(false, depth), 24, duration);
+    for (const auto& edge : kBoxEdges) {
+        *v++ = makeVertex(corners[edge[0]], color);
+        *v++ = makeVertex(corners[edge[1]], color);
+    }
+}
+
+void DebugDraw::addSphere(const DebugVec3& center, float radius, const DebugColor& color, DebugDepth depth, float duration) {
+    const CircleTable& t = circleTable();
+    DebugVertex* v = append(streamIndex(false, depth), 3 * kCircleSegments * 2, duration);
+    for (uint32_t i = 0; i < kCircleSegments; ++i) {
+        for (uint32_t k = i; k <= i + 1; ++k) {
+            const float c = t.cosines[k] * radius;
+            const float s = t.sines[k] * radius;
+            v[0] = makeVertex({center.x + c, center.y + s, center.z}, color);
+            v[kCircleSegments * 2] = makeVertex({center.x + c, center.y, center.z + s}, color);
+            v[kCircleSegments * 4] = makeVertex({center.x, center.y + c, center.z + s}, color);
+            ++v;
+        }
+    }
+}
+
+void DebugDraw::addFrustum(const float* inverseViewProjection, const DebugColor& color, DebugDepth depth, float duration) {
+    const float* m = inverseViewProjection;
+    DebugVec3 corners[8];
+    for (uint32_t i = 0; i < 8; ++i) {
+        const float x = (i & 1) ? 1.0f : -1.0f;
+        const float y = (i & 2) ? 1.0f : -1.0f;
+        const float z = (i & 4) ? 1.0f : -1.0f;
+        const float w = m[3] * x + m[7] * y + m[11] * z + m[15];
+        const DebugVec3 p = transformPoint(m, {x, y, z});
+        const float invW = w != 0.0f ? 1.0f / w : 0.0f;
+        corners[i] = {p.x * invW, p.y * invW, p.z * invW};
+    }
+    DebugVertex* v = append(streamIndex(false, depth), 24, duration);
+    for (const auto& edge : kBoxEdges) {
+        *v++ = makeVertex(corners[edge[0]], color);
+        *v++ = makeVertex(corners[edge[1]], color);
+    }
+}
+
+void DebugDraw::addAxes(const float* transform, float size, DebugDepth depth, float duration) {
+    const DebugVec3 origin = transformPoint(transform, {0.0f, 0.0f, 0.0f});
+    DebugVertex* v = append(streamIndex(false, depth), 6, duration);
+    for (uint32_t axis = 0; axis < 3; ++axis) {
+        DebugVec3 tip{0.0f, 0.0f, 0.0f};
+        (&tip.x)[axis] = size;
+        DebugColor color{0.0f, 0.0f, 0.0f, 1.0f};
+        (&color.r)[axis] = 1.0f;
+        *v++ = makeVertex(origin, color);
+        *v++ = makeVertex(transformPoint(transform, tip), color);
+    }
+}
+
+void DebugDraw::addTriangle(const DebugVec3& a, const DebugVec3& b, const DebugVec3& c, const DebugColor& color,
+                            DebugDepth depth, float duration) {
+    DebugVertex* v = append(streamIndex(true, depth), 3, duration);
+    v[0] = makeVertex(a, color);
+    v[1] = makeVertex(b, color);
+    v[2] = makeVertex(c, color);
+}
+
+void DebugDraw::clearPersistent() {
+    for (uint32_t s = 0; s < kStreamCount; ++s) {
+        persistentVertices_[s].clear();
+        persistentSpans_[s].clear();
+    }
+}
+
+void DebugDraw::agePersistent(float deltaSeconds) {
+    // Compacta no lugar, mantendo a ordem das primitivas vivas
+    for (uint32_t s = 0; s < kStreamCount; ++s) {
+        auto& vertices = persistentVertices_[s];
+        auto& spans = persistentSpans_[s];
+        size_t readVertex = 0, writeVertex = 0, writeSpan = 0;
+        for (const TimedSpan& span : spans) {
+            const float remaining = span.remaining - deltaSeconds;
+            if (remaining > 0.0f) {
+                if (readVertex != writeVertex) {
+                    std::copy(vertices.begin() + readVertex, vertices.begin() + readVertex + span.vertexCount,
+                              vertices.begin() + writeVertex);
+                }
+                spans[writeSpan++] = {span.vertexCount, remaining};
+                writeVertex += span.vertexCount;
+            }
+            readVertex += span.vertexCount;
+        }
+        vertices.resize(writeVertex);
+        spans.resize(writeSpan);
+    }
+}
+
+void DebugDraw::flush(const float viewProjection[16], float deltaSeconds) {
+    if constexpr (!kDebugDrawEnabled) return;
+    // Envelhece antes de receber as novas: uma primitiva de N segundos aparece por N segundos inteiros
+    agePersistent(deltaSeconds);
+
+    stats_ = {};
+    staging_.clear();
+    for (uint32_t s = 0; s < kStreamCount; ++s) {
+        ranges_[s].first = static_cast<uint32_t>(staging_.size());
+        auto& persistent = persistentVertices_[s];
+        for (uint32_t b = 0; b < buckets_.size(); ++b) {
+            Stream& stream = buckets_[b].streams[s];
+            persistent.insert(persistent.end(), stream.timedVertices.begin(), stream.timedVertices.end());
+            persistentSpans_[s].insert(persistentSpans_[s].end(), stream.timedSpans.begin(), stream.timedSpans.end());
+        }
+        staging_.insert(staging_.end(), persistent.begin(), persistent.end());
+        for (uint32_t b = 0; b < buckets_.size(); ++b) {
+            Stream& stream = buckets_[b].streams[s];
+            staging_.insert(staging_.end(), stream.vertices.begin(), stream.vertices.end());
+            stream.vertices.clear();
+            stream.timedVertices.clear();
+            stream.timedSpans.clear();
+        }
+        ranges_[s].count = static_cast<uint32_t>(staging_.size()) - ranges_[s].first;
+        if (ranges_[s].count) ++stats_.drawCount;
+        stats_.persistentVertexCount += static_cast<uint32_t>(persistent.size());
+        ((s & 2) ? stats_.triangleVertexCount : stats_.lineVertexCount) += ranges_[s].count;
+    }
+    stats_.bucketCount = buckets_.size();
+
+    // Nova época: caches thread_local do frame anterior deixam de valer
+    buckets_.clear();
+
+    if (!upload(viewProjection)) {
+        ranges_ = {};
+        stats_.drawCount = 0;
+    }
+}
+
+bool DebugDraw::upload(const float viewProjection[16]) {
+    frameVertexBuffer_ = nullptr;
+    frameDescriptorSet_ = nullptr;
+    if (staging_.empty()) return true;
+
+    const uint32_t frames = std::max(1u, device_.getFramesInFlight());
+    if (vertexBuffers_.size() != frames) {
+        vertexBuffers_.resize(frames);
+        uniformBuffers_.resize(frames);
+        descriptorSets_.resize(frames);
+    }
+    // Um conjunto por frame em voo: o frame anterior ainda pode estar lendo o seu
+    const uint32_t slot = device_.getFrameSlot() % frames;
+    const size_t bytes = staging_.size() * sizeof(DebugVertex);
+    auto& vertexBuffer = vertexBuffers_[slot];
+    if (!vertexBuffer || vertexBuffer->getSize() < bytes) {
+        size_t capacity = std::max(kMinVertexBufferBytes, vertexBuffer ? vertexBuffer->getSize() : 0);
+        while (capacity < bytes) capacity *= 2;
+        vertexBuffer = device_.createBuffer(nullptr, capacity, RHI::BufferUsage::Vertex, RHI::BufferUpdate::Stream);
+        if (!vertexBuffer) {
+            Core::log(Core::LogLevel::Error, "DebugDraw: falha ao criar vertex buffer (" + std::to_string(capacity) + " bytes)");
+            return false;
+        }
+    }
+    auto& uniformBuffer = uniformBuffers_[slot];
+    if (!uniformBuffer) {
+        uniformBuffer = device_.createBuffer(nullptr, 16 * sizeof(float), RHI::BufferUsage::Uniform, RHI::BufferUpdate::Stream);
+        RHI::DescriptorSetDesc desc{};
+        RHI::UniformBinding camera{};
+        camera.binding = 0;
+        camera.buffer = uniformBuffer.get();
+        camera.blockName = "DebugCamera";
+        desc.uniformBuffers.push_back(camera);
+        descriptorSets_[slot] = uniformBuffer ? device_.createDescriptorSet(desc) : nullptr;
+        if (!descriptorSets_[slot]) {
+            Core::log(Core::LogLevel::Error, "DebugDraw: falha ao criar o uniform buffer da câmera");
+            uniformBuffer.reset();
+            return false;
+        }
+    }
+    device_.updateBuffer(vertexBuffer.get(), staging_.data(), bytes, 0);
+    device_.updateBuffer(uniformBuffer.get(), viewProjection, 16 * sizeof(float), 0);
+    frameVertexBuffer_ = vertexBuffer.get();
+    frameDescriptorSet_ = descriptorSets_[slot].get();
+    stats_.vertexBytes = bytes;
+    return true;
+}
+
+void DebugDraw::record(RHI::ICommandList& cmd) const {
+    if (!frameVertexBuffer_ || !frameDescriptorSet_) return;
+    for (uint32_t s = 0; s < kStreamCount; ++s) {
+        if (!ranges_[s].count || !pipelines_[s]) continue;
+        // O layout de vértices é do pipeline (VAO no GL): o buffer é religado a cada troca
+        cmd.setGraphicsPipeline(pipelines_[s].get());
+        cmd.setVertexBuffer(frameVertexBuffer_);
+        cmd.bindDescriptorSet(frameDescriptorSet_);
+        cmd.draw(ranges_[s].count, ranges_[s].first);
+    }
+}
+
+}
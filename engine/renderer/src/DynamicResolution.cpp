@@ -0,0 +1,205 @@
+#include "Aurora/Renderer/DynamicResolution.hpp"
+#include "Aurora/Core/Log.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Aurora::Renderer {
+
+DynamicResolutionController::DynamicResolutionController(const DynamicResolutionDesc& desc) : desc_(desc) {
+    if (desc_.minScale <= 0.0f) desc_.minScale = 0.1f;
+    if (desc_.maxScale < desc_.minScale) desc_.maxScale = desc_.minScale;
+    if (desc_.targetFrameMs <= 0.0f) desc_.targetFrameMs = 16.6f;
+    desc_.smoothing = std::clamp(desc_.smoothing, 0.01f, 1.0f);
+    reset();
+}
+
+void DynamicResolutionController::reset() {
+    scale_ = desc_.maxScale;
+    appliedScale_ = desc_.maxScale;
+    filteredMs_ = 0.0f;
+    prevError_ = 0.0f;
+    prevError2_ = 0.0f;
+    hasSample_ = false;
+    cpuBound_ = false;
+}
+
+float DynamicResolutionController::quantize(float scale) const {
+    if (desc_.scaleStep > 0.0f) scale = std::round(scale / desc_.scaleStep) * desc_.scaleStep;
+    return std::clamp(scale, desc_.minScale, desc_.maxScale);
+}
+
+float DynamicResolutionController::update(float cpuFrameMs, float gpuFrameMs) {
+    const bool gpuTimed = gpuFrameMs > 0.0f;
+    const float measured = gpuTimed ? gpuFrameMs : cpuFrameMs;
+    if (!(measured > 0.0f)) return appliedScale_;
+
+    filteredMs_ = hasSample_ ? filteredMs_ + desc_.smoothing * (measured - filteredMs_) : measured;
+    hasSample_ = true;
+    cpuBound_ = gpuTimed && cpuFrameMs > desc_.targetFrameMs * (1.0f + desc_.deadband) && filteredMs_ <= desc_.targetFrameMs;
+
+    // > 0: sobra orçamento (sobe a escala); < 0: estourou (desce)
+    float error = (desc_.targetFrameMs - filteredMs_) / desc_.targetFrameMs;
+    if (std::fabs(error) < desc_.deadband) error = 0.0f;
+    const float delta = desc_.kp * (error - prevError_)
+                      + desc_.ki * error
+                      + desc_.kd * (error - 2.0f * prevError_ + prevError2_);
+    prevError2_ = prevError_;
+    prevError_ = error;
+    scale_ = std::clamp(scale_ + delta, desc_.minScale, desc_.maxScale);
+
+    // Histerese de um passo; nos limites a escala aplicada acompanha o clamp
+    const float step = desc_.scaleStep > 0.0f ? desc_.scaleStep : 0.0f;
+    const bool atLimit = scale_ <= desc_.minScale || scale_ >= desc_.maxScale;
+    if (std::fabs(scale_ - appliedScale_) >= step * 0.999f || (atLimit && scale_ != appliedScale_)) {
+        appliedScale_ = atLimit ? scale_ : quantize(scale_);
+    }
+    return appliedScale_;
+}
+
+DynamicResolution::DynamicResolution(RHI::IDevice& device, const DynamicResolutionDesc& desc)
+    : device_(device), controller_(desc) {
+    stats_.scale = controller_.getScale();
+}
+
+DynamicResolution::~DynamicResolution() = default;
+
+bool DynamicResolution::initialize(RHI::IShaderModule* upscaleVertex, RHI::IShaderModule* upscaleFragment) {
+    if (!upscaleVertex || !upscaleFragment) {
+        Core::log(Core::LogLevel::Error, "DynamicResolution: shaders de upscale ausentes");
+        return false;
+    }
+    RHI::GraphicsPipelineDesc p{};
+    p.vertexShader = upscaleVertex;
+    p.fragmentShader = upscaleFragment;
+    p.state.raster.cullMode = RHI::CullMode::None;
+    p.state.depthStencil.depthTestEnable = false;
+    p.state.depthStencil.depthWriteEnable = false;
+    upscalePipeline_ = device_.createGraphicsPipeline(p);
+    RHI::SamplerDesc s{};
+    s.minFilter = RHI::FilterMode::Linear;
+    s.magFilter = RHI::FilterMode::Linear;
+    s.addressU = RHI::AddressMode::ClampToEdge;
+    s.addressV = RHI::AddressMode::ClampToEdge;
+    sampler_ = device_.createSampler(s);
+    if (!upscalePipeline_ || !sampler_) {
+        Core::log(Core::LogLevel::Error, "DynamicResolution: falha ao criar pipeline/sampler de upscale");
+        upscalePipeline_.reset();
+        sampler_.reset();
+        return false;
+    }
+    return true;
+}
+
+void DynamicResolution::setDisplaySize(uint32_t width, uint32_t height) {
+    if (width == displayWidth_ && height == displayHeight_) return;
+    displayWidth_ = width;
+    displayHeight_ = height;
+    applyScale(controller_.getScale());
+}
+
+void DynamicResolution::setEnabled(bool enabled) {
+    if (enabled_ == enabled) return;
+    enabled_ = enabled;
+    controller_.reset();
+    applyScale(controller_.getScale());
+}
+
+void DynamicResolution::update(float cpuFrameMs) {
+    const float gpuMs = device_.getGpuFrameTimeMs();
+    stats_.lastGpuFrameMs = gpuMs;
+    if (enabled_) {
+        applyScale(controller_.update(cpuFrameMs, gpuMs));
+        stats_.filteredFrameMs = controller_.getFilteredFrameMs();
+        stats_.cpuBound = controller_.isCpuBound();
+    }
+}
+
+void DynamicResolution::applyScale(float scale) {
+    stats_.scale = scale;
+    const uint32_t w = std::max(1u, static_cast<uint32_t>(std::lround(static_cast<double>(displayWidth_) * scale)));
+    const uint32_t h = std::max(1u, static_cast<uint32_t>(std::lround(static_cast<double>(displayHeight_) * scale)));
+    if (!displayWidth_ || !displayHeight_ || (w == renderWidth_ && h == renderHeight_)) return;
+    renderWidth_ = w;
+    renderHeight_ = h;
+    stats_.renderWidth = w;
+    stats_.renderHeight = h;
+    ++stats_.resizeCount;
+    upscaleSets_.clear();
+}
+
+RHI::TextureDesc DynamicResolution::getColorDesc() const {
+    RHI::TextureDesc td{};
+    td.width = renderWidth_;
+    td.height = renderHeight_;
+    td.format = controller_.getDesc().colorFormat;
+    td.usage = RHI::TextureUsage::RenderTarget;
+    return td;
+}
+
+RHI::TextureDesc DynamicResolution::getDepthDesc() const {
+    RHI::TextureDesc td{};
+    td.width = renderWidth_;
+    td.height = renderHeight_;
+    td.format = controller_.getDesc().depthFormat;
+    td.usage = RHI::TextureUsage::DepthStencil;
+    return td;
+}
+
+RGTexture DynamicResolution::createColorTarget(RenderGraph& graph, const std::string& name) const {
+    if (!renderWidth_ || !renderHeight_) {
+        Core::log(Core::LogLevel::Error, "DynamicResolution: setDisplaySize não foi chamado");
+        return {};
+    }
+    return graph.createTexture(name, getColorDesc());
+}
+
+RGTexture DynamicResolution::createDepthTarget(RenderGraph& graph, const std::string& name) const {
+    if (!renderWidth_ || !renderHeight_) {
+        Core::log(Core::LogLevel::Error, "DynamicResolution: setDisplaySize não foi chamado");
+        return {};
+    }
+    return graph.createTexture(name, getDepthDesc());
+}
+
+RHI::IDescriptorSet* DynamicResolution::getUpscaleSet(RHI::ITexture* source, const RHI::RenderTargetPool& pool) {
+    const uint64_t evictions = pool.getStats().evictionCount;
+    if (&pool != upscaleSetsPool_ || evictions != upscaleSetsEvictions_) {
+        upscaleSets_.clear();
+        upscaleSetsPool_ = &pool;
+        upscaleSetsEvictions_ = evictions;
+    }
+    for (const auto& [texture, set] : upscaleSets_) {
+        if (texture == source) return set.get();
+    }
+    if (upscaleSets_.size() >= kMaxUpscaleSets) upscaleSets_.clear();
+    RHI::DescriptorSetDesc desc{};
+    desc.sampledTextures.push_back({0, source, sampler_.get(), nullptr});
+    auto set = device_.createDescriptorSet(desc);
+    if (!set) return nullptr;
+    upscaleSets_.emplace_back(source, std::move(set));
+    return upscaleSets_.back().second.get();
+}
+
+void DynamicResolution::addUpscalePass(RenderGraph& graph, RGTexture source, RHI::ISwapchain* swapchain, const float* clearColor) {
+    if (!upscalePipeline_) {
+        Core::log(Core::LogLevel::Error, "DynamicResolution: addUpscalePass sem initialize()");
+        return;
+    }
+    graph.addPass("Upscale",
+        [&](RenderGraphBuilder& builder) {
+            builder.read(source);
+            builder.writeSwapchain(swapchain, clearColor);
+        },
+        [this, source, pool = &graph.getTexturePool()](RenderGraphContext& ctx) {
+            RHI::ITexture* texture = ctx.getTexture(source);
+            RHI::IDescriptorSet* set = texture ? getUpscaleSet(texture, *pool) : nullptr;
+            if (!set) return;
+            auto& cmd = ctx.getCommandList();
+            cmd.setGraphicsPipeline(upscalePipeline_.get());
+            cmd.bindDescriptorSet(set);
+            cmd.draw(3, 0);
+        });
+}
+
+}
@@ -0,0 +1,335 @@
+#include "Aurora/Renderer/Material.hpp"
+#include "Aurora/Core/Log.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace Aurora::Renderer {
+
+static constexpr uint32_t kNoSet = 0xFFFFFFFFu;
+
+// MaterialInstance
+
+MaterialInstance::MaterialInstance(MaterialTemplate& owner, uint32_t parameterIndex)
+    : template_(&owner), parameterIndex_(parameterIndex) {
+    const uint32_t perPage = owner.desc_.instancesPerPage;
+    dynamicOffset_ = (parameterIndex % perPage) * owner.parameterStride_;
+    textures_.resize(owner.desc_.textureSlots.size());
+}
+
+bool MaterialInstance::setVariant(uint16_t variant) {
+    if (variant >= template_->variants_.size()) {
+        Core::log(Core::LogLevel::Error, "Material '" + template_->getName() + "': variante inexistente " + std::to_string(variant));
+        return false;
+    }
+    variant_ = variant;
+    return true;
+}
+
+bool MaterialInstance::setParameters(const void* data, size_t bytes) {
+    const size_t size = template_->getParameterSize();
+    if (bytes != size || !data) {
+        Core::log(Core::LogLevel::Error, "Material '" + template_->getName() + "': parâmetros com " + std::to_string(bytes)
+            + " bytes (esperado " + std::to_string(size) + ")");
+        return false;
+    }
+    const uint32_t perPage = template_->desc_.instancesPerPage;
+    auto& page = template_->pages_[parameterIndex_ / perPage];
+    std::memcpy(page.shadow.data() + dynamicOffset_, data, bytes);
+    page.dirtyBegin = std::min<size_t>(page.dirtyBegin, dynamicOffset_);
+    page.dirtyEnd = std::max<size_t>(page.dirtyEnd, dynamicOffset_ + bytes);
+    return true;
+}
+
+const void* MaterialInstance::getParameters() const {
+    if (!template_->parameterStride_) return nullptr;
+    const uint32_t perPage = template_->desc_.instancesPerPage;
+    return template_->pages_[parameterIndex_ / perPage].shadow.data() + dynamicOffset_;
+}
+
+bool MaterialInstance::setTexture(uint32_t slot, RHI::ITexture* texture, RHI::ISampler* sampler) {
+    if (slot >= textures_.size()) {
+        Core::log(Core::LogLevel::Error, "Material '" + template_->getName() + "': slot de textura inexistente " + std::to_string(slot));
+        return false;
+    }
+    if (textures_[slot] == TextureBinding{texture, sampler}) return true;
+    auto textures = textures_;
+    textures[slot] = {texture, sampler};
+    const uint32_t setId = template_->acquireSet(parameterIndex_ / template_->desc_.instancesPerPage, textures);
+    if (setId == kNoSet) return false;
+    template_->releaseSet(textureSetId_);
+    textureSetId_ = setId;
+    textures_ = std::move(textures);
+    return true;
+}
+
+uint64_t MaterialInstance::getSortKey(float depth) const {
+    const auto& v = template_->variants_[variant_];
+    return MaterialSortKey::make(v.pipelineId, textureSetId_, depth, v.translucent);
+}
+
+RHI::IGraphicsPipeline* MaterialInstance::getPipeline() const {
+    return template_->variants_[variant_].pipeline.get();
+}
+
+RHI::IDescriptorSet* MaterialInstance::getDescriptorSet() const {
+    const auto* shared = template_->findSet(textureSetId_);
+    return shared ? shared->set.get() : nullptr;
+}
+
+std::span<const uint32_t> MaterialInstance::getDynamicOffsets() const {
+    if (!template_->parameterStride_) return {};
+    return std::span<const uint32_t>(&dynamicOffset_, 1);
+}
+
+// MaterialTemplate
+
+MaterialTemplate::MaterialTemplate(MaterialSystem& system, const MaterialTemplateDesc& desc)
+    : system_(system), desc_(desc) {
+    if (desc_.instancesPerPage == 0) desc_.instancesPerPage = 1;
+}
+
+MaterialTemplate::~MaterialTemplate() = default;
+
+bool MaterialTemplate::initialize() {
+    if (!desc_.vertexShader || !desc_.fragmentShader) {
+        Core::log(Core::LogLevel::Error, "Material '" + desc_.name + "': shaders ausentes");
+        return false;
+    }
+    for (const auto& u : desc_.sharedUniforms) {
+        if (u.dynamic) {
+            Core::log(Core::LogLevel::Error, "Material '" + desc_.name + "': sharedUniforms não podem ser dinâmicos");
+            return false;
+        }
+    }
+    const auto& layout = desc_.parameterLayout;
+    if (!layout.fields.empty() && !RHI::matchesBlockLayout(layout)) {
+        Core::log(Core::LogLevel::Error, "Material '" + desc_.name + "': struct de parâmetros não confere com o layout std140");
+        return false;
+    }
+    if (layout.cppSize) {
+        // Cada slot começa num offset bindável como offset dinâmico
+        const size_t alignment = std::max<size_t>(system_.getDevice().getCapabilities().uniformBufferOffsetAlignment, 16);
+        parameterStride_ = static_cast<uint32_t>((layout.cppSize + alignment - 1) / alignment * alignment);
+    }
+
+    MaterialVariantDesc base{};
+    base.state = desc_.state;
+    return addVariant(base) != kInvalidVariant;
+}
+
+uint16_t MaterialTemplate::addVariant(const MaterialVariantDesc& desc) {
+    if (variants_.size() >= kInvalidVariant) {
+        Core::log(Core::LogLevel::Error, "Material '" + desc_.name + "': limite de variantes atingido");
+        return kInvalidVariant;
+    }
+    RHI::GraphicsPipelineDesc p{};
+    p.vertexShader = desc.vertexShader ? desc.vertexShader : desc_.vertexShader;
+    p.fragmentShader = desc.fragmentShader ? desc.fragmentShader : desc_.fragmentShader;
+    p.vertexLayout = desc_.vertexLayout;
+    p.state = desc.state;
+    if (!desc_.parameterLayout.fields.empty()) {
+        p.uniformBlockLayouts.push_back({desc_.parameterBinding, desc_.parameterBlockName, desc_.parameterLayout});
+    }
+    auto pipeline = system_.getDevice().createGraphicsPipeline(p);
+    if (!pipeline) {
+        Core::log(Core::LogLevel::Error, "Material '" + desc_.name + "': falha ao criar pipeline da variante " + std::to_string(variants_.size()));
+        return kInvalidVariant;
+    }
+    Variant v{};
+    v.pipeline = std::move(pipeline);
+    v.pipelineId = system_.allocatePipelineId();
+    v.translucent = desc.translucent;
+    if (v.pipelineId >= (1u << MaterialSortKey::kPipelineBits)) {
+        Core::log(Core::LogLevel::Warn, "MaterialSystem: ids de pipeline excedem a chave de ordenação (agrupamento degradado)");
+    }
+    variants_.push_back(std::move(v));
+    return static_cast<uint16_t>(variants_.size() - 1);
+}
+
+RHI::IGraphicsPipeline* MaterialTemplate::getPipeline(uint16_t variant) const {
+    return variant < variants_.size() ? variants_[variant].pipeline.get() : nullptr;
+}
+
+MaterialInstance* MaterialTemplate::createInstance() {
+    uint32_t slot = 0;
+    if (!freeSlots_.empty()) {
+        slot = freeSlots_.back();
+        freeSlots_.pop_back();
+    } else {
+        slot = static_cast<uint32_t>(instances_.size());
+        instances_.emplace_back();
+    }
+    const uint32_t pageIndex = slot / desc_.instancesPerPage;
+    while (pages_.size() <= pageIndex) {
+        Page page{};
+        if (parameterStride_) {
+            const size_t bytes = static_cast<size_t>(parameterStride_) * desc_.instancesPerPage;
+            page.buffer = system_.getDevice().createBuffer(nullptr, bytes, RHI::BufferUsage::Uniform, RHI::BufferUpdate::Dynamic);
+            if (!page.buffer) {
+                Core::log(Core::LogLevel::Error, "Material '" + desc_.name + "': falha ao criar UBO de parâmetros");
+                freeSlots_.push_back(slot);
+                return nullptr;
+            }
+            page.shadow.assign(bytes, 0);
+        }
+        pages_.push_back(std::move(page));
+    }
+
+    std::unique_ptr<MaterialInstance> instance(new MaterialInstance(*this, slot));
+    instance->textureSetId_ = acquireSet(pageIndex, instance->textures_);
+    if (instance->textureSetId_ == kNoSet) {
+        freeSlots_.push_back(slot);
+        return nullptr;
+    }
+    // Slot reaproveitado começa zerado
+    if (parameterStride_) {
+        auto& page = pages_[pageIndex];
+        std::memset(page.shadow.data() + instance->dynamicOffset_, 0, parameterStride_);
+        page.dirtyBegin = std::min<size_t>(page.dirtyBegin, instance->dynamicOffset_);
+        page.dirtyEnd = std::max<size_t>(page.dirtyEnd, instance->dynamicOffset_ + parameterStride_);
+    }
+    instances_[slot] = std::move(instance);
+    ++instanceCount_;
+    return instances_[slot].get();
+}
+
+void MaterialTemplate::destroyInstance(MaterialInstance* instance) {
+    if (!instance || &instance->getTemplate() != this) return;
+    const uint32_t slot = instance->parameterIndex_;
+    if (slot >= instances_.size() || instances_[slot].get() != instance) return;
+    releaseSet(instance->textureSetId_);
+    instances_[slot].reset();
+    freeSlots_.push_back(slot);
+    --instanceCount_;
+}
+
+std::string MaterialTemplate::makeSetKey(uint32_t page, const std::vector<MaterialInstance::TextureBinding>& textures) {
+    std::string key(reinterpret_cast<const char*>(&page), sizeof(page));
+    for (const auto& t : textures) {
+        key.append(reinterpret_cast<const char*>(&t.texture), sizeof(t.texture));
+        key.append(reinterpret_cast<const char*>(&t.sampler), sizeof(t.sampler));
+    }
+    return key;
+}
+
+uint32_t MaterialTemplate::acquireSet(uint32_t page, const std::vector<MaterialInstance::TextureBinding>& textures) {
+    const std::string key = makeSetKey(page, textures);
+    if (auto it = setsByKey_.find(key); it != setsByKey_.end()) {
+        ++sets_[it->second].refCount;
+        return it->second;
+    }
+
+    RHI::DescriptorSetDesc setDesc{};
+    setDesc.uniformBuffers = desc_.sharedUniforms;
+    if (parameterStride_) {
+        RHI::UniformBinding params{};
+        params.binding = desc_.parameterBinding;
+        params.buffer = pages_[page].buffer.get();
+        params.size = desc_.parameterLayout.cppSize;
+        params.blockName = desc_.parameterBlockName;
+        params.dynamic = true;
+        setDesc.uniformBuffers.push_back(params);
+    }
+    for (size_t i = 0; i < textures.size(); ++i) {
+        if (!textures[i].texture) continue; // slot ainda não atribuído
+        RHI::DescriptorSetDesc::SampledTextureBinding tb{};
+        tb.binding = desc_.textureSlots[i].binding;
+        tb.texture = textures[i].texture;
+        tb.sampler = textures[i].sampler;
+        tb.uniformName = desc_.textureSlots[i].uniformName;
+        setDesc.sampledTextures.push_back(tb);
+    }
+    auto set = system_.getDevice().createDescriptorSet(setDesc);
+    if (!set) {
+        Core::log(Core::LogLevel::Error, "Material '" + desc_.name + "': falha ao criar descriptor set");
+        return kNoSet;
+    }
+    const uint32_t id = system_.allocateTextureSetId();
+    SharedSet& shared = sets_[id];
+    shared.set = std::move(set);
+    shared.id = id;
+    shared.refCount = 1;
+    setsByKey_[key] = id;
+    return id;
+}
+
+void MaterialTemplate::releaseSet(uint32_t id) {
+    auto it = sets_.find(id);
+    if (it == sets_.end() || --it->second.refCount > 0) return;
+    for (auto k = setsByKey_.begin(); k != setsByKey_.end(); ++k) {
+        if (k->second == id) { setsByKey_.erase(k); break; }
+    }
+    sets_.erase(it);
+    system_.releaseTextureSetId(id);
+}
+
+const MaterialTemplate::SharedSet* MaterialTemplate::findSet(uint32_t id) const {
+    auto it = sets_.find(id);
+    return it != sets_.end() ? &it->second : nullptr;
+}
+
+uint64_t MaterialTemplate::flush(RHI::IDevice& device) {
+    uint64_t uploaded = 0;
+    for (auto& page : pages_) {
+        if (page.dirtyBegin >= page.dirtyEnd) continue;
+        const size_t bytes = page.dirtyEnd - page.dirtyBegin;
+        device.updateBuffer(page.buffer.get(), page.shadow.data() + page.dirtyBegin, bytes, page.dirtyBegin);
+        uploaded += bytes;
+        page.dirtyBegin = SIZE_MAX;
+        page.dirtyEnd = 0;
+    }
+    return uploaded;
+}
+
+// MaterialSystem
+
+MaterialSystem::~MaterialSystem() = default;
+
+MaterialTemplate* MaterialSystem::createTemplate(const MaterialTemplateDesc& desc) {
+    if (findTemplate(desc.name)) {
+        Core::log(Core::LogLevel::Error, "MaterialSystem: template '" + desc.name + "' já existe");
+        return nullptr;
+    }
+    std::unique_ptr<MaterialTemplate> t(new MaterialTemplate(*this, desc));
+    if (!t->initialize()) return nullptr;
+    templates_.push_back(std::move(t));
+    return templates_.back().get();
+}
+
+MaterialTemplate* MaterialSystem::findTemplate(const std::string& name) const {
+    for (const auto& t : templates_) {
+        if (t->getName() == name) return t.get();
+    }
+    return nullptr;
+}
+
+void MaterialSystem::flush() {
+    lastUploadedBytes_ = 0;
+    for (auto& t : templates_) lastUploadedBytes_ += t->flush(device_);
+}
+
+uint32_t MaterialSystem::allocateTextureSetId() {
+    if (!freeTextureSetIds_.empty()) {
+        const uint32_t id = freeTextureSetIds_.back();
+        freeTextureSetIds_.pop_back();
+        return id;
+    }
+    // Acima de 24 bits os ids colidem na chave (apenas o agrupamento piora)
+    return nextTextureSetId_++;
+}
+
+MaterialStats MaterialSystem::getStats() const {
+    MaterialStats s{};
+    s.templateCount = static_cast<uint32_t>(templates_.size());
+    for (const auto& t : templates_) {
+        s.variantCount += t->getVariantCount();
+        s.instanceCount += t->getInstanceCount();
+        s.parameterPageCount += static_cast<uint32_t>(t->parameterStride_ ? t->pages_.size() : 0);
+        s.descriptorSetCount += static_cast<uint32_t>(t->sets_.size());
+    }
+    s.uploadedBytes = lastUploadedBytes_;
+    return s;
+}
+
+}
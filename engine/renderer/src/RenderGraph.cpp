@@ -0,0 +1,509 @@
+#include "Aurora/Renderer/RenderGraph.hpp"
+#include "Aurora/Core/Log.hpp"
+#include "Aurora/Core/MemoryTracking.hpp"
+
+#include <algorithm>
+
+namespace Aurora::Renderer {
+
+// ---- Builder ----
+
+RGTexture RenderGraphBuilder::read(RGTexture texture) {
+    if (graph_.isValidResource(texture.id, true)) graph_.addRead(pass_, texture.id);
+    return texture;
+}
+
+RGTexture RenderGraphBuilder::writeColor(RGTexture texture, const float* clearColor) {
+    if (!graph_.isValidResource(texture.id, true)) return texture;
+    graph_.addWrite(pass_, texture.id);
+    RenderGraph::ColorTarget ct{};
+    ct.resource = texture.id;
+    if (clearColor) {
+        ct.clear = true;
+        for (int i = 0; i < 4; ++i) ct.clearColor[i] = clearColor[i];
+    }
+    graph_.passes_[pass_].colorTargets.push_back(ct);
+    return texture;
+}
+
+RGTexture RenderGraphBuilder::writeDepth(RGTexture texture, bool clear, float clearDepth) {
+    if (!graph_.isValidResource(texture.id, true)) return texture;
+    graph_.addWrite(pass_, texture.id);
+    auto& p = graph_.passes_[pass_];
+    p.depthTarget = texture.id;
+    p.clearDepth = clear;
+    p.clearDepthValue = clearDepth;
+    return texture;
+}
+
+RGBuffer RenderGraphBuilder::read(RGBuffer buffer) {
+    if (graph_.isValidResource(buffer.id, false)) graph_.addRead(pass_, buffer.id);
+    return buffer;
+}
+
+RGBuffer RenderGraphBuilder::write(RGBuffer buffer) {
+    if (graph_.isValidResource(buffer.id, false)) graph_.addWrite(pass_, buffer.id);
+    return buffer;
+}
+
+void RenderGraphBuilder::writeSwapchain(RHI::ISwapchain* swapchain, const float* clearColor) {
+    auto& p = graph_.passes_[pass_];
+    p.swapchain = swapchain;
+    p.sideEffect = true;
+    if (clearColor) {
+        p.swapchainClear = true;
+        for (int i = 0; i < 4; ++i) p.swapchainClearColor[i] = clearColor[i];
+    }
+}
+
+void RenderGraphBuilder::setSideEffect() {
+    graph_.passes_[pass_].sideEffect = true;
+}
+
+// ---- Context ----
+
+RHI::ITexture* RenderGraphContext::getTexture(RGTexture texture) const {
+    return graph_.isValidResource(texture.id, true) ? graph_.resolveTexture(texture.id) : nullptr;
+}
+
+RHI::IBuffer* RenderGraphContext::getBuffer(RGBuffer buffer) const {
+    return graph_.isValidResource(buffer.id, false) ? graph_.resolveBuffer(buffer.id) : nullptr;
+}
+
+// ---- Declaração ----
+
+RenderGraph::RenderGraph(RHI::IDevice& device, RHI::RenderTargetPool* pool) : device_(device), pool_(pool) {
+    if (!pool_) {
+        ownedPool_ = std::make_unique<RHI::RenderTargetPool>(device);
+        pool_ = ownedPool_.get();
+    }
+}
+
+RenderGraph::~RenderGraph() {
+    passes_.clear(); // render passes referenciam as texturas do pool
+    releaseTextureSlots();
+}
+
+void RenderGraph::setPhysicalRetainFrames(uint32_t frames) {
+    retainFrames_ = frames;
+    if (ownedPool_) ownedPool_->setMaxUnusedFrames(frames);
+}
+
+void RenderGraph::releaseTextureSlots() {
+    for (auto& slot : textureSlots_) pool_->release(slot.texture);
+    textureSlots_.clear();
+}
+
+void RenderGraph::reset() {
+    releaseTextureSlots();
+    if (ownedPool_) ownedPool_->endFrame();
+    resources_.clear();
+    passes_.clear();
+    order_.clear();
+    levelStarts_.clear();
+    compiled_ = false;
+}
+
+RGTexture RenderGraph::createTexture(const std::string& name, const RHI::TextureDesc& desc) {
+    Resource r{};
+    r.name = name;
+    r.textureDesc = desc;
+    resources_.push_back(std::move(r));
+    return RGTexture{static_cast<uint32_t>(resources_.size() - 1)};
+}
+
+RGTexture RenderGraph::importTexture(const std::string& name, RHI::ITexture* texture) {
+    Resource r{};
+    r.name = name;
+    r.imported = true;
+    r.externalTexture = texture;
+    if (texture) r.textureDesc = texture->getDesc();
+    resources_.push_back(std::move(r));
+    return RGTexture{static_cast<uint32_t>(resources_.size() - 1)};
+}
+
+RGBuffer RenderGraph::createBuffer(const std::string& name, size_t bytes, RHI::BufferUsage usage) {
+    Resource r{};
+    r.name = name;
+    r.isTexture = false;
+    r.bufferBytes = bytes;
+    r.bufferUsage = usage;
+    resources_.push_back(std::move(r));
+    return RGBuffer{static_cast<uint32_t>(resources_.size() - 1)};
+}
+
+RGBuffer RenderGraph::importBuffer(const std::string& name, RHI::IBuffer* buffer) {
+    Resource r{};
+    r.name = name;
+    r.isTexture = false;
+    r.imported = true;
+    r.externalBuffer = buffer;
+    if (buffer) { r.bufferBytes = buffer->getSize(); r.bufferUsage = buffer->getUsage(); }
+    resources_.push_back(std::move(r));
+    return RGBuffer{static_cast<uint32_t>(resources_.size() - 1)};
+}
+
+void RenderGraph::markOutput(RGTexture texture) {
+    if (isValidResource(texture.id, true)) resources_[texture.id].output = true;
+}
+
+void RenderGraph::markOutput(RGBuffer buffer) {
+    if (isValidResource(buffer.id, false)) resources_[buffer.id].output = true;
+}
+
+void RenderGraph::addPass(const std::string& name, const SetupFn& setup, ExecuteFn execute) {
+    Pass p{};
+    p.name = name;
+    p.execute = std::move(execute);
+    passes_.push_back(std::move(p));
+    compiled_ = false;
+    RenderGraphBuilder builder(*this, static_cast<uint32_t>(passes_.size() - 1));
+    if (setup) setup(builder);
+}
+
+bool RenderGraph::isValidResource(uint32_t id, bool texture) const {
+    return id < resources_.size() && resources_[id].isTexture == texture;
+}
+
+RHI::ITexture* RenderGraph::resolveTexture(uint32_t id) const {
+    const auto& r = resources_[id];
+    if (r.imported) return r.externalTexture;
+    return r.physical != kNone ? textureSlots_[r.physical].texture : nullptr;
+}
+
+RHI::IBuffer* RenderGraph::resolveBuffer(uint32_t id) const {
+    const auto& r = resources_[id];
+    if (r.imported) return r.externalBuffer;
+    return r.physical != kNone ? physicalBuffers_[r.physical].buffer.get() : nullptr;
+}
+
+void RenderGraph::addRead(uint32_t pass, uint32_t resource) {
+    auto& reads = passes_[pass].reads;
+    if (std::find(reads.begin(), reads.end(), resource) != reads.end()) return;
+    reads.push_back(resource);
+    resources_[resource].readers.push_back(pass);
+}
+
+void RenderGraph::addWrite(uint32_t pass, uint32_t resource) {
+    auto& writes = passes_[pass].writes;
+    if (std::find(writes.begin(), writes.end(), resource) != writes.end()) return;
+    writes.push_back(resource);
+    resources_[resource].writers.push_back(pass);
+}
+
+// ---- Compilação ----
+
+bool RenderGraph::compile() {
+    Core::MemoryTagScope memoryTag(Core::MemoryTag::Renderer);
+    const uint32_t passCount = static_cast<uint32_t>(passes_.size());
+    order_.clear();
+    levelStarts_.clear();
+    stats_ = RenderGraphStats{};
+    stats_.passCount = passCount;
+    // compile() pode rodar mais de uma vez sobre os mesmos recursos: tempos de vida recomeçam do zero
+    for (auto& res : resources_) {
+        res.firstUse = kNone;
+        res.lastUse = kNone;
+    }
+
+    // Dependências. A ordem de declaração desambigua versões: um leitor consome os escritores declarados
+    // antes dele (ou todos, se o produtor foi declarado depois). Escritores também esperam escritores
+    // anteriores (WAW) e leitores da versão anterior (WAR). Só arestas de dados propagam o culling.
+    std::vector<std::vector<uint32_t>> dataPreds(passCount), orderPreds(passCount);
+    for (uint32_t p = 0; p < passCount; ++p) {
+        // Passes no mesmo swapchain seguem a ordem de declaração (ex.: overlay depois da cena)
+        if (passes_[p].swapchain) {
+            for (uint32_t q = p; q-- > 0;) {
+                if (passes_[q].swapchain == passes_[p].swapchain) { orderPreds[p].push_back(q); break; }
+            }
+        }
+        for (uint32_t r : passes_[p].reads) {
+            const auto& writers = resources_[r].writers;
+            bool hasEarlier = std::any_of(writers.begin(), writers.end(), [p](uint32_t w) { return w < p; });
+            for (uint32_t w : writers) {
+                if (w == p) continue;
+                if (!hasEarlier || w < p) dataPreds[p].push_back(w);
+            }
+            if (writers.empty() && !resources_[r].imported) {
+                Core::log(Core::LogLevel::Warn, "RenderGraph: pass '" + passes_[p].name + "' lê '" + resources_[r].name + "' que nunca é escrito");
+            }
+        }
+        for (uint32_t r : passes_[p].writes) {
+            const auto& res = resources_[r];
+            for (uint32_t w : res.writers) if (w < p) dataPreds[p].push_back(w);
+            for (uint32_t rd : res.readers) {
+                if (rd >= p) continue;
+                bool readOlder = std::any_of(res.writers.begin(), res.writers.end(), [rd](uint32_t w) { return w < rd; });
+                if (readOlder) orderPreds[p].push_back(rd);
+            }
+        }
+    }
+
+    // Culling: parte dos passes com efeito colateral ou que escrevem recursos importados/de saída
+    std::vector<uint32_t> stack;
+    for (uint32_t p = 0; p < passCount; ++p) {
+        auto& pass = passes_[p];
+        pass.culled = true;
+        bool root = pass.sideEffect;
+        for (uint32_t r : pass.writes) root = root || resources_[r].imported || resources_[r].output;
+        if (root) { pass.culled = false; stack.push_back(p); }
+    }
+    while (!stack.empty()) {
+        uint32_t p = stack.back(); stack.pop_back();
+        for (uint32_t d : dataPreds[p]) {
+            if (passes_[d].culled) { passes_[d].culled = false; stack.push_back(d); }
+        }
+    }
+
+    // Ordenação topológica (Kahn) por níveis entre os passes mantidos
+    std::vector<uint32_t> inDegree(passCount, 0);
+    std::vector<std::vector<uint32_t>> succs(passCount);
+    for (uint32_t p = 0; p < passCount; ++p) {
+        if (passes_[p].culled) continue;
+        auto addEdges = [&](const std::vector<uint32_t>& preds) {
+            for (uint32_t d : preds) {
+                if (passes_[d].culled) continue;
+                if (std::find(succs[d].begin(), succs[d].end(), p) != succs[d].end()) continue;
+                succs[d].push_back(p);
+                ++inDegree[p];
+            }
+        };
+        addEdges(dataPreds[p]);
+        addEdges(orderPreds[p]);
+    }
+    std::vector<uint32_t> current;
+    uint32_t alive = 0;
+    for (uint32_t p = 0; p < passCount; ++p) {
+        if (passes_[p].culled) { ++stats_.culledPassCount; continue; }
+        ++alive;
+        if (inDegree[p] == 0) current.push_back(p);
+    }
+    uint32_t level = 0;
+    while (!current.empty()) {
+        std::sort(current.begin(), current.end()); // estável em relação à declaração
+        levelStarts_.push_back(static_cast<uint32_t>(order_.size()));
+        std::vector<uint32_t> next;
+        for (uint32_t p : current) {
+            passes_[p].level = level;
+            order_.push_back(p);
+            for (uint32_t s : succs[p]) if (--inDegree[s] == 0) next.push_back(s);
+        }
+        current.swap(next);
+        ++level;
+    }
+    if (order_.size() != alive) {
+        Core::log(Core::LogLevel::Error, "RenderGraph: ciclo de dependências entre passes");
+        order_.clear();
+        levelStarts_.clear();
+        return false;
+    }
+    stats_.levelCount = level;
+
+    // Tempo de vida por índice de execução
+    for (uint32_t i = 0; i < order_.size(); ++i) {
+        const auto& pass = passes_[order_[i]];
+        auto touch = [&](uint32_t r) {
+            auto& res = resources_[r];
+            res.firstUse = std::min(res.firstUse, i);
+            res.lastUse = res.lastUse == kNone ? i : std::max(res.lastUse, i);
+        };
+        for (uint32_t r : pass.reads) touch(r);
+        for (uint32_t r : pass.writes) touch(r);
+    }
+    for (auto& res : resources_) {
+        // Saídas precisam sobreviver até o fim do frame
+        if (res.output && res.firstUse != kNone) res.lastUse = static_cast<uint32_t>(order_.size());
+    }
+
+    assignPhysicalResources();
+
+    // Render passes a partir dos attachments declarados. Load/store saem dos tempos de vida: transitórios
+    // não são carregados no primeiro uso nem guardados após o último (economiza banda em tilers/llvmpipe).
+    uint32_t lastSwapchainPass = kNone;
+    for (uint32_t i = 0; i < order_.size(); ++i) {
+        if (passes_[order_[i]].swapchain) lastSwapchainPass = i;
+    }
+    for (uint32_t i = 0; i < order_.size(); ++i) {
+        auto& pass = passes_[order_[i]];
+        pass.renderPass.reset();
+        auto loadFor = [&](uint32_t r, bool clear) {
+            const auto& res = resources_[r];
+            if (clear) return RHI::LoadAction::Clear;
+            return (!res.imported && res.firstUse == i) ? RHI::LoadAction::DontCare : RHI::LoadAction::Load;
+        };
+        auto storeFor = [&](uint32_t r) {
+            const auto& res = resources_[r];
+            return (res.imported || res.output || res.lastUse > i) ? RHI::StoreAction::Store : RHI::StoreAction::DontCare;
+        };
+        if (pass.swapchain) {
+            RHI::RenderPassDesc rp{};
+            rp.swapchainColorLoad = pass.swapchainClear ? RHI::LoadAction::Clear : RHI::LoadAction::Load;
+            rp.swapchainDepthLoad = pass.swapchainClear ? RHI::LoadAction::Clear : RHI::LoadAction::Load;
+            // Depth do backbuffer só é preservado se outro pass ainda vai renderizar nele
+            rp.swapchainDepthStore = (i < lastSwapchainPass) ? RHI::StoreAction::Store : RHI::StoreAction::DontCare;
+            for (int c = 0; c < 4; ++c) rp.clearColor[c] = pass.swapchainClearColor[c];
+            pass.renderPass = device_.createRenderPass(rp);
+        } else if (!pass.colorTargets.empty() || pass.depthTarget != kNone) {
+            RHI::RenderPassDesc rp{};
+            bool clearColorSet = false;
+            for (const auto& ct : pass.colorTargets) {
+                RHI::RenderPassDesc::Attachment a{};
+                a.texture = resolveTexture(ct.resource);
+                a.load = loadFor(ct.resource, ct.clear);
+                a.store = storeFor(ct.resource);
+                rp.colorAttachments.push_back(a);
+                // Um único clearColor por pass (o do primeiro attachment que limpa)
+                if (ct.clear && !clearColorSet) {
+                    clearColorSet = true;
+                    for (int c = 0; c < 4; ++c) rp.clearColor[c] = ct.clearColor[c];
+                }
+            }
+            if (pass.depthTarget != kNone) {
+                rp.depthAttachment.texture = resolveTexture(pass.depthTarget);
+                rp.depthAttachment.load = loadFor(pass.depthTarget, pass.clearDepth);
+                rp.depthAttachment.store = storeFor(pass.depthTarget);
+                rp.clearDepth = pass.clearDepthValue;
+            }
+            pass.renderPass = device_.createRenderPass(rp);
+        }
+    }
+
+    compiled_ = true;
+    return true;
+}
+
+void RenderGraph::assignPhysicalResources() {
+    releaseTextureSlots();
+    for (auto& pb : physicalBuffers_) { pb.assigned = false; pb.busyUntil = 0; }
+
+    // Transitórios em ordem de primeiro uso; reaproveita um slot compatível já livre (aliasing)
+    std::vector<uint32_t> transients;
+    for (uint32_t i = 0; i < resources_.size(); ++i) {
+        auto& r = resources_[i];
+        r.physical = kNone;
+        if (!r.imported && r.firstUse != kNone) transients.push_back(i);
+    }
+    std::sort(transients.begin(), transients.end(),
+              [this](uint32_t a, uint32_t b) { return resources_[a].firstUse < resources_[b].firstUse; });
+
+    for (uint32_t id : transients) {
+        auto& r = resources_[id];
+        if (r.isTexture) {
+            ++stats_.transientTextureCount;
+            stats_.transientTextureBytes += RHI::estimateTextureBytes(r.textureDesc);
+            for (uint32_t i = 0; i < textureSlots_.size(); ++i) {
+                const auto& slot = textureSlots_[i];
+                if (slot.desc == r.textureDesc && slot.busyUntil < r.firstUse) { r.physical = i; break; }
+            }
+            if (r.physical == kNone) {
+                TextureSlot slot{};
+                slot.desc = r.textureDesc;
+                slot.texture = pool_->acquire(r.textureDesc);
+                if (!slot.texture) {
+                    Core::log(Core::LogLevel::Error, "RenderGraph: falha ao criar textura '" + r.name + "'");
+                    continue;
+                }
+                textureSlots_.push_back(slot);
+                r.physical = static_cast<uint32_t>(textureSlots_.size() - 1);
+            }
+            textureSlots_[r.physical].busyUntil = r.lastUse;
+        } else {
+            ++stats_.transientBufferCount;
+            for (uint32_t i = 0; i < physicalBuffers_.size(); ++i) {
+                auto& pb = physicalBuffers_[i];
+                if (pb.bytes != r.bufferBytes || pb.usage != r.bufferUsage) continue;
+                if (pb.assigned && pb.busyUntil >= r.firstUse) continue;
+                r.physical = i;
+                break;
+            }
+            if (r.physical == kNone) {
+                PhysicalBuffer pb{};
+                pb.bytes = r.bufferBytes;
+                pb.usage = r.bufferUsage;
+                pb.buffer = device_.createBuffer(nullptr, r.bufferBytes, r.bufferUsage);
+                if (!pb.buffer) {
+                    Core::log(Core::LogLevel::Error, "RenderGraph: falha ao criar buffer '" + r.name + "'");
+                    continue;
+                }
+                physicalBuffers_.push_back(std::move(pb));
+                r.physical = static_cast<uint32_t>(physicalBuffers_.size() - 1);
+            }
+            auto& pb = physicalBuffers_[r.physical];
+            pb.assigned = true;
+            pb.busyUntil = r.lastUse;
+        }
+    }
+
+    // Buffers sem uso há mais de retainFrames_ frames são liberados (índices remapeados)
+    std::vector<uint32_t> remap(physicalBuffers_.size(), kNone);
+    uint32_t kept = 0;
+    for (uint32_t i = 0; i < physicalBuffers_.size(); ++i) {
+        auto& pb = physicalBuffers_[i];
+        pb.unusedFrames = pb.assigned ? 0 : pb.unusedFrames + 1;
+        if (pb.assigned || pb.unusedFrames <= retainFrames_) {
+            if (kept != i) physicalBuffers_[kept] = std::move(pb);
+            remap[i] = kept++;
+        }
+    }
+    physicalBuffers_.resize(kept);
+    for (auto& r : resources_) {
+        if (r.physical != kNone && !r.isTexture) r.physical = remap[r.physical];
+    }
+
+    stats_.physicalTextureCount = static_cast<uint32_t>(textureSlots_.size());
+    for (const auto& slot : textureSlots_) stats_.physicalTextureBytes += RHI::estimateTextureBytes(slot.desc);
+    for (const auto& pb : physicalBuffers_) if (pb.assigned) ++stats_.physicalBufferCount;
+}
+
+// ---- Execução ----
+
+void RenderGraph::recordPass(Pass& pass) {
+    if (!pass.cmd) return; // backend sem command lists (Null)
+    Core::MemoryTagScope memoryTag(Core::MemoryTag::Renderer);  // também nos workers
+    RHI::ICommandList& cmd = *pass.cmd;
+    cmd.begin();
+    if (pass.renderPass) cmd.beginRenderPass(pass.renderPass.get(), pass.swapchain);
+    RenderGraphContext ctx(*this, cmd);
+    if (pass.execute) pass.execute(ctx);
+    if (pass.renderPass) cmd.endRenderPass();
+    cmd.end();
+}
+
+void RenderGraph::execute() {
+    Core::MemoryTagScope memoryTag(Core::MemoryTag::Renderer);
+    if (!compiled_) {
+        Core::log(Core::LogLevel::Warn, "RenderGraph: execute() sem compile() bem-sucedido");
+        return;
+    }
+    // Command lists criadas na thread chamadora e reaproveitadas entre frames
+    while (commandLists_.size() < order_.size()) commandLists_.push_back(device_.createCommandList());
+    for (uint32_t i = 0; i < order_.size(); ++i) passes_[order_[i]].cmd = commandLists_[i].get();
+
+    // Passes de um mesmo nível não dependem entre si: gravação paralela nos jobs; níveis em sequência.
+    // Sem JobSystem grava tudo na thread chamadora (nada de threads criadas por frame)
+    for (size_t l = 0; l < levelStarts_.size(); ++l) {
+        const uint32_t begin = levelStarts_[l];
+        const uint32_t end = (l + 1 < levelStarts_.size()) ? levelStarts_[l + 1] : static_cast<uint32_t>(order_.size());
+        const uint32_t count = end - begin;
+        const uint32_t threads = jobs_ ? std::min(count, maxRecordingThreads_) : 1;
+        if (threads <= 1) {
+            for (uint32_t i = begin; i < end; ++i) recordPass(passes_[order_[i]]);
+            continue;
+        }
+        jobs_->parallelFor(count, [&](uint32_t first, uint32_t last) {
+            for (uint32_t i = first; i < last; ++i) recordPass(passes_[order_[begin + i]]);
+        }, 1);
+    }
+
+    // Submissão na ordem topológica (thread chamadora)
+    for (uint32_t p : order_) if (passes_[p].cmd) device_.submit(passes_[p].cmd);
+}
+
+std::vector<std::string> RenderGraph::getExecutionOrder() const {
+    std::vector<std::string> names;
+    names.reserve(order_.size());
+    for (uint32_t p : order_) names.push_back(passes_[p].name);
+    return names;
+}
+
+}
@@ -0,0 +1,335 @@
+#include "Aurora/Renderer/RenderQueue.hpp"
+#include "Aurora/Renderer/Material.hpp"
+#include "Aurora/Core/Log.hpp"
+
+#include <algorithm>
+
+namespace Aurora::Renderer {
+
+// Abaixo disso o custo de distribuir os passes em jobs supera o ganho do sort paralelo
+static constexpr size_t kParallelSortThreshold = 16384;
+static constexpr uint32_t kEndOfGroup = 0xFFFFFFFFu;
+static constexpr size_t kMinInstanceBufferBytes = 64 * 1024;
+
+RenderQueue::RenderQueue(RHI::IDevice& device) : device_(device) {}
+
+RenderQueue::~RenderQueue() = default;
+
+void RenderQueue::reset() {
+    for (uint32_t i = 0; i < buckets_.size(); ++i) buckets_[i].packets.clear();
+    // Nova época: caches thread_local do frame anterior deixam de valer
+    buckets_.clear();
+    items_.clear();
+    sorted_ = false;
+    stats_ = {};
+}
+
+void RenderQueue::submit(const DrawPacket& packet) {
+    buckets_.acquire().packets.push_back(packet);
+}
+
+size_t RenderQueue::size() const {
+    size_t total = 0;
+    for (uint32_t i = 0; i < buckets_.size(); ++i) total += buckets_[i].packets.size();
+    return total;
+}
+
+void RenderQueue::sort() {
+    items_.clear();
+    items_.reserve(size());
+    for (uint32_t i = 0; i < buckets_.size(); ++i) {
+        for (const DrawPacket& p : buckets_[i].packets) items_.push_back({p.sortKey, &p});
+    }
+    const uint32_t threads = jobs_ && items_.size() >= kParallelSortThreshold ? std::min(maxSortThreads_, jobs_->getThreadCount()) : 1;
+    radixSort(threads);
+
+    stats_.packetCount = static_cast<uint32_t>(items_.size());
+    stats_.bucketCount = buckets_.size();
+    stats_.sortThreads = threads;
+    sorted_ = true;
+}
+
+void RenderQueue::radixSort(uint32_t threads) {
+    const size_t n = items_.size();
+    if (n < 2) { stats_.sortPasses = 0; return; }
+
+    // Só ordena os bytes que variam entre as chaves
+    uint64_t anyBits = 0, allBits = ~0ull;
+    for (const SortItem& item : items_) { anyBits |= item.key; allBits &= item.key; }
+    const uint64_t varying = anyBits ^ allBits;
+    uint32_t passes[8];
+    uint32_t passCount = 0;
+    for (uint32_t b = 0; b < 8; ++b) {
+        if ((varying >> (b * 8)) & 0xFF) passes[passCount++] = b * 8;
+    }
+    stats_.sortPasses = passCount;
+    if (passCount == 0) return;
+
+    scratch_.resize(n);
+    const uint32_t chunks = static_cast<uint32_t>(std::min<size_t>(threads, n));
+    std::vector<std::array<uint32_t, 256>> histograms(chunks);
+    SortItem* src = items_.data();
+    SortItem* dst = scratch_.data();
+    uint32_t shift = 0;
+
+    // Cada pedaço conta e espalha a sua faixa; o destino de cada dígito é (dígitos menores de todos os
+    // pedaços) + (mesmo dígito dos pedaços anteriores), o que mantém o sort estável
+    auto countDigits = [&](uint32_t first, uint32_t last) {
+        for (uint32_t t = first; t < last; ++t) {
+            auto& hist = histograms[t];
+            hist.fill(0);
+            for (size_t i = n * t / chunks, end = n * (t + 1) / chunks; i < end; ++i) ++hist[(src[i].key >> shift) & 0xFF];
+        }
+    };
+    auto scatter = [&](uint32_t first, uint32_t last) {
+        for (uint32_t t = first; t < last; ++t) {
+            auto& offsets = histograms[t];
+            for (size_t i = n * t / chunks, end = n * (t + 1) / chunks; i < end; ++i) dst[offsets[(src[i].key >> shift) & 0xFF]++] = src[i];
+        }
+    };
+    auto forEachChunk = [&](auto& body) {
+        if (chunks > 1) jobs_->parallelFor(chunks, body, 1);
+        else body(0u, chunks);
+    };
+
+    for (uint32_t p = 0; p < passCount; ++p) {
+        shift = passes[p];
+        forEachChunk(countDigits);
+        // Contagens viram offsets de destino (prefixo por dígito, depois por pedaço)
+        uint32_t running = 0;
+        for (uint32_t d = 0; d < 256; ++d) {
+            for (uint32_t t = 0; t < chunks; ++t) {
+                const uint32_t count = histograms[t][d];
+                histograms[t][d] = running;
+                running += count;
+            }
+        }
+        forEachChunk(scatter);
+        std::swap(src, dst);
+    }
+
+    if (passCount % 2) items_.swap(scratch_);
+}
+
+static bool sameDescriptorBinding(const DrawPacket& a, const DrawPacket* b) {
+    if (!b || a.descriptorSet != b->descriptorSet || a.dynamicOffsetCount != b->dynamicOffsetCount) return false;
+    return std::equal(a.dynamicOffsets.begin(), a.dynamicOffsets.begin() + a.dynamicOffsetCount, b->dynamicOffsets.begin());
+}
+
+// Grupo de estado: mesmo pipeline e mesmo set/offsets (e mesma classe opaco/translúcido)
+static bool sameState(const DrawPacket& a, const DrawPacket& b) {
+    return a.pipeline == b.pipeline && (a.sortKey >> 63) == (b.sortKey >> 63)
+        && (a.descriptorSet ? sameDescriptorBinding(a, &b) : !b.descriptorSet);
+}
+
+static bool sameMesh(const DrawPacket& a, const DrawPacket& b) {
+    return a.vertexBuffer == b.vertexBuffer && a.indexBuffer == b.indexBuffer && a.indexType == b.indexType
+        && a.count == b.count && a.first == b.first && a.instanceDataSize == b.instanceDataSize;
+}
+
+static uint64_t hashMesh(const DrawPacket& p) {
+    uint64_t h = 1469598103934665603ull;
+    auto mix = [&h](uint64_t v) { h = (h ^ v) * 1099511628211ull; };
+    mix(reinterpret_cast<uintptr_t>(p.vertexBuffer));
+    mix(reinterpret_cast<uintptr_t>(p.indexBuffer));
+    mix((static_cast<uint64_t>(p.count) << 32) | p.first);
+    mix((static_cast<uint64_t>(p.instanceDataSize) << 8) | static_cast<uint64_t>(p.indexType));
+    return h;
+}
+
+static bool isDrawable(const DrawPacket& p) { return p.pipeline && p.count > 0; }
+static bool hasInstanceData(const DrawPacket& p) { return p.instanceData && p.instanceDataSize > 0; }
+
+void RenderQueue::addBatch(const DrawPacket& packet, bool mergeWithPrevious) {
+    if (!hasInstanceData(packet)) {
+        batches_.push_back({&packet, 0, 0});
+        return;
+    }
+    // Os dados do último batch instanciado estão no fim do staging: estender mantém as instâncias contíguas
+    if (mergeWithPrevious && !batches_.empty()) {
+        Batch& last = batches_.back();
+        if (last.instanceCount && sameState(*last.packet, packet) && sameMesh(*last.packet, packet)) {
+            const auto* bytes = static_cast<const uint8_t*>(packet.instanceData);
+            instanceStaging_.insert(instanceStaging_.end(), bytes, bytes + packet.instanceDataSize);
+            ++last.instanceCount;
+            ++stats_.mergedPacketCount;
+            return;
+        }
+    }
+    // firstInstance * stride precisa cair no início do bloco: alinha o staging ao stride deste pipeline
+    const size_t stride = packet.instanceDataSize;
+    const size_t offset = (instanceStaging_.size() + stride - 1) / stride * stride;
+    instanceStaging_.resize(offset);
+    const auto* bytes = static_cast<const uint8_t*>(packet.instanceData);
+    instanceStaging_.insert(instanceStaging_.end(), bytes, bytes + stride);
+    batches_.push_back({&packet, 1, static_cast<uint32_t>(offset / stride)});
+}
+
+void RenderQueue::groupStateRun(size_t begin, size_t end) {
+    // Agrupa por malha na ordem da primeira aparição (o mais próximo primeiro); a ordem entre malhas
+    // do mesmo estado não afeta o resultado de opacos com depth test
+    meshGroups_.clear();
+    meshLookup_.clear();
+    for (size_t i = begin; i < end; ++i) {
+        const DrawPacket& p = *items_[i].packet;
+        if (!isDrawable(p)) continue;
+        if (!hasInstanceData(p)) {
+            addBatch(p, false);
+            continue;
+        }
+        const uint32_t item = static_cast<uint32_t>(i);
+        nextInGroup_[item] = kEndOfGroup;
+        auto [it, inserted] = meshLookup_.try_emplace(hashMesh(p), static_cast<uint32_t>(meshGroups_.size()));
+        if (!inserted) {
+            MeshGroup& group = meshGroups_[it->second];
+            if (sameMesh(*items_[group.head].packet, p)) {
+                nextInGroup_[group.tail] = item;
+                group.tail = item;
+                continue;
+            }
+            // Colisão de hash: grupo próprio fora do lookup
+        }
+        meshGroups_.push_back({item, item});
+    }
+    for (const MeshGroup& group : meshGroups_) {
+        addBatch(*items_[group.head].packet, false);
+        for (uint32_t i = nextInGroup_[group.head]; i != kEndOfGroup; i = nextInGroup_[i]) addBatch(*items_[i].packet, true);
+    }
+}
+
+void RenderQueue::buildBatches() {
+    batches_.clear();
+    instanceStaging_.clear();
+    nextInGroup_.resize(items_.size());
+    size_t begin = 0;
+    while (begin < items_.size()) {
+        const DrawPacket& head = *items_[begin].packet;
+        size_t end = begin + 1;
+        while (end < items_.size() && sameState(head, *items_[end].packet)) ++end;
+        const bool translucent = (head.sortKey >> 63) != 0;
+        if (instancing_ && !translucent) {
+            groupStateRun(begin, end);
+        } else {
+            // Translúcidos: só vizinhos, para não alterar a ordem de composição
+            for (size_t i = begin; i < end; ++i) {
+                if (isDrawable(*items_[i].packet)) addBatch(*items_[i].packet, instancing_);
+            }
+        }
+        begin = end;
+    }
+}
+
+RHI::IBuffer* RenderQueue::uploadInstanceData() {
+    const size_t bytes = instanceStaging_.size();
+    const uint32_t frames = std::max(1u, device_.getFramesInFlight());
+    if (instanceBuffers_.size() != frames) instanceBuffers_.resize(frames);
+    // Um buffer por frame em voo: o frame anterior ainda pode estar lendo o seu
+    auto& buffer = instanceBuffers_[device_.getFrameSlot() % frames];
+    if (!buffer || buffer->getSize() < bytes) {
+        size_t capacity = std::max(kMinInstanceBufferBytes, buffer ? buffer->getSize() : 0);
+        while (capacity < bytes) capacity *= 2;
+        buffer = device_.createBuffer(nullptr, capacity, RHI::BufferUsage::Vertex, RHI::BufferUpdate::Stream);
+        if (!buffer) {
+            Core::log(Core::LogLevel::Error, "RenderQueue: falha ao criar buffer de instâncias (" + std::to_string(capacity) + " bytes)");
+            return nullptr;
+        }
+    }
+    device_.updateBuffer(buffer.get(), instanceStaging_.data(), bytes, 0);
+    stats_.instanceBytes = bytes;
+    return buffer.get();
+}
+
+void RenderQueue::emit(RHI::ICommandList& cmd) {
+    if (!sorted_) {
+        Core::log(Core::LogLevel::Warn, "RenderQueue: emit() sem sort(); ordenando agora");
+        sort();
+    }
+    buildBatches();
+    RHI::IBuffer* instanceBuffer = instanceStaging_.empty() ? nullptr : uploadInstanceData();
+    if (instanceBuffer) cmd.setInstanceBuffer(instanceBuffer);
+
+    // Mesmas regras do CommandBundle: trocar de pipeline invalida VBO/IBO/set já emitidos
+    RHI::IGraphicsPipeline* pipeline = nullptr;
+    RHI::IBuffer* vertexBuffer = nullptr;
+    RHI::IBuffer* indexBuffer = nullptr;
+    const DrawPacket* bound = nullptr;
+
+    for (const Batch& batch : batches_) {
+        const DrawPacket& p = *batch.packet;
+        if (batch.instanceCount && !instanceBuffer) continue;
+        if (p.pipeline != pipeline) {
+            cmd.setGraphicsPipeline(p.pipeline);
+            pipeline = p.pipeline;
+            vertexBuffer = indexBuffer = nullptr;
+            bound = nullptr;
+            ++stats_.pipelineBinds;
+        } else {
+            ++stats_.redundantBindsSkipped;
+        }
+        if (p.vertexBuffer) {
+            if (p.vertexBuffer != vertexBuffer) {
+                cmd.setVertexBuffer(p.vertexBuffer);
+                vertexBuffer = p.vertexBuffer;
+                ++stats_.vertexBufferBinds;
+            } else {
+                ++stats_.redundantBindsSkipped;
+            }
+        }
+        if (p.indexBuffer) {
+            if (p.indexBuffer != indexBuffer) {
+                cmd.setIndexBuffer(p.indexBuffer);
+                indexBuffer = p.indexBuffer;
+                ++stats_.indexBufferBinds;
+            } else {
+                ++stats_.redundantBindsSkipped;
+            }
+        }
+        if (p.descriptorSet) {
+            if (!sameDescriptorBinding(p, bound)) {
+                cmd.bindDescriptorSet(p.descriptorSet, std::span<const uint32_t>(p.dynamicOffsets.data(), p.dynamicOffsetCount));
+                bound = &p;
+                ++stats_.descriptorSetBinds;
+            } else {
+                ++stats_.redundantBindsSkipped;
+            }
+        }
+        if (batch.instanceCount) {
+            if (p.indexBuffer) cmd.drawIndexedInstanced(p.count, p.first, p.indexType, batch.instanceCount, batch.firstInstance);
+            else cmd.drawInstanced(p.count, p.first, batch.instanceCount, batch.firstInstance);
+            ++stats_.instancedDrawCount;
+        } else if (p.indexBuffer) {
+            cmd.drawIndexed(p.count, p.first, p.indexType);
+        } else {
+            cmd.draw(p.count, p.first);
+        }
+        ++stats_.drawCount;
+    }
+}
+
+// Mistura os bits do ponteiro para espalhar objetos alocados lado a lado
+static uint32_t pointerSortId(const void* ptr) {
+    uint64_t x = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(ptr));
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdull;
+    x ^= x >> 33;
+    return static_cast<uint32_t>(x);
+}
+
+uint64_t RenderQueue::makeSortKey(const DrawPacket& packet, float depth, bool translucent) {
+    const uint32_t pipelineId = packet.pipeline ? pointerSortId(packet.pipeline) : 0;
+    const uint32_t setId = packet.descriptorSet ? pointerSortId(packet.descriptorSet) : 0;
+    return MaterialSortKey::make(pipelineId, setId, depth, translucent);
+}
+
+DrawPacket RenderQueue::makePacket(const MaterialInstance& material, float depth) {
+    DrawPacket p{};
+    p.pipeline = material.getPipeline();
+    p.descriptorSet = material.getDescriptorSet();
+    const auto offsets = material.getDynamicOffsets();
+    p.dynamicOffsetCount = static_cast<uint32_t>(std::min<size_t>(offsets.size(), DrawPacket::kMaxDynamicOffsets));
+    std::copy_n(offsets.begin(), p.dynamicOffsetCount, p.dynamicOffsets.begin());
+    p.sortKey = material.getSortKey(depth);
+    return p;
+}
+
+}
@@ -0,0 +1,391 @@
+#include "Aurora/Renderer/SpriteBatch.hpp"
+#include "Aurora/Core/Log.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <string>
+
+namespace Aurora::Renderer {
+
+namespace {
+    // Fonte 5x7 clássica, ASCII 32..126: 5 colunas por caractere, bit 0 = linha de cima
+    constexpr uint8_t kDebugFont5x7[95][5] = {
+        {0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x5F,0x00,0x00}, {0x00,0x07,0x00,0x07,0x00}, {0x14,0x7F,0x14,0x7F,0x14},
+        {0x24,0x2A,0x7F,0x2A,0x12}, {0x23,0x13,0x08,0x64,0x62}, {0x36,0x49,0x55,0x22,0x50}, {0x00,0x05,0x03,0x00,0x00},
+        {0x00,0x1C,0x22,0x41,0x00}, {0x00,0x41,0x22,0x1C,0x00}, {0x08,0x2A,0x1C,0x2A,0x08}, {0x08,0x08,0x3E,0x08,0x08},
+        {0x00,0x50,0x30,0x00,0x00}, {0x08,0x08,0x08,0x08,0x08}, {0x00,0x60,0x60,0x00,0x00}, {0x20,0x10,0x08,0x04,0x02},
+        {0x3E,0x51,0x49,0x45,0x3E}, {0x00,0x42,0x7F,0x40,0x00}, {0x42,0x61,0x51,0x49,0x46}, {0x21,0x41,0x45,0x4B,0x31},
+        {0x18,0x14,0x12,0x7F,0x10}, {0x27,0x45,0x45,0x45,0x39}, {0x3C,0x4A,0x49,0x49,0x30}, {0x01,0x71,0x09,0x05,0x03},
+        {0x36,0x49,0x49,0x49,0x36}, {0x06,0x49,0x49,0x29,0x1E}, {0x00,0x36,0x36,0x00,0x00}, {0x00,0x56,0x36,0x00,0x00},
+        {0x08,0x14,0x22,0x41,0x00}, {0x14,0x14,0x14,0x14,0x14}, {0x00,0x41,0x22,0x14,0x08}, {0x02,0x01,0x51,0x09,0x06},
+        {0x32,0x49,0x79,0x41,0x3E}, {0x7E,0x11,0x11,0x11,0x7E}, {0x7F,0x49,0x49,0x49,0x36}, {0x3E,0x41,0x41,0x41,0x22},
+        {0x7F,0x41,0x41,0x22,0x1C}, {0x7F,0x49,0x49,0x49,0x41}, {0x7F,0x09,0x09,0x09,0x01}, {0x3E,0x41,0x49,0x49,0x7A},
+        {0x7F,0x08,0x08,0x08,0x7F}, {0x00,0x41,0x7F,0x41,0x00}, {0x20,0x40,0x41,0x3F,0x01}, {0x7F,0x08,0x14,0x22,0x41},
+        {0x7F,0x40,0x40,0x40,0x40}, {0x7F,0x02,0x0C,0x02,0x7F}, {0x7F,0x04,0x08,0x10,0x7F}, {0x3E,0x41,0x41,0x41,0x3E},
+        {0x7F,0x09,0x09,0x09,0x06}, {0x3E,0x41,0x51,0x21,0x5E}, {0x7F,0x09,0x19,0x29,0x46}, {0x46,0x49,0x49,0x49,0x31},
+        {0x01,0x01,0x7F,0x01,0x01}, {0x3F,0x40,0x40,0x40,0x3F}, {0x1F,0x20,0x40,0x20,0x1F}, {0x3F,0x40,0x38,0x40,0x3F},
+        {0x63,0x14,0x08,0x14,0x63}, {0x07,0x08,0x70,0x08,0x07}, {0x61,0x51,0x49,0x45,0x43}, {0x00,0x7F,0x41,0x41,0x00},
+        {0x02,0x04,0x08,0x10,0x20}, {0x00,0x41,0x41,0x7F,0x00}, {0x04,0x02,0x01,0x02,0x04}, {0x40,0x40,0x40,0x40,0x40},
+        {0x00,0x01,0x02,0x04,0x00}, {0x20,0x54,0x54,0x54,0x78}, {0x7F,0x48,0x44,0x44,0x38}, {0x38,0x44,0x44,0x44,0x20},
+        {0x38,0x44,0x44,0x48,0x7F}, {0x38,0x54,0x54,0x54,0x18}, {0x08,0x7E,0x09,0x01,0x02}, {0x0C,0x52,0x52,0x52,0x3E},
+        {0x7F,0x08,0x04,0x04,0x78}, {0x00,0x44,0x7D,0x40,0x00}, {0x20,0x40,0x44,0x3D,0x00}, {0x7F,0x10,0x28,0x44,0x00},
+        {0x00,0x41,0x7F,0x40,0x00}, {0x7C,0x04,0x18,0x04,0x78}, {0x7C,0x08,0x04,0x04,0x78}, {0x38,0x44,0x44,0x44,0x38},
+        {0x7C,0x14,0x14,0x14,0x08}, {0x08,0x14,0x14,0x18,0x7C}, {0x7C,0x08,0x04,0x04,0x08}, {0x48,0x54,0x54,0x54,0x20},
+        {0x04,0x3F,0x44,0x40,0x20}, {0x3C,0x40,0x40,0x20,0x7C}, {0x1C,0x20,0x40,0x20,0x1C}, {0x3C,0x40,0x30,0x40,0x3C},
+        {0x44,0x28,0x10,0x28,0x44}, {0x0C,0x50,0x50,0x50,0x3C}, {0x44,0x64,0x54,0x4C,0x44}, {0x00,0x08,0x36,0x41,0x00},
+        {0x00,0x00,0x7F,0x00,0x00}, {0x00,0x41,0x36,0x08,0x00}, {0x08,0x04,0x08,0x10,0x08},
+    };
+
+    constexpr uint32_t kFontFirstChar = 32;
+    constexpr uint32_t kFontGlyphW = 5;
+    constexpr uint32_t kFontGlyphH = 7;
+    constexpr uint32_t kFontCellW = 6;      // 1 px de margem entre glifos no atlas
+    constexpr uint32_t kFontCellH = 8;
+    constexpr uint32_t kFontColumns = 16;
+    constexpr uint32_t kFontRows = 6;
+
+    constexpr uint64_t kQuadIndexMask = 0xFFFFFFFFull;
+    constexpr uint32_t kMaxTextureSlots = 0xFFFF;
+}
+
+SpriteBatch::SpriteBatch(RHI::IDevice& device) : device_(device) {}
+
+SpriteBatch::~SpriteBatch() = default;
+
+bool SpriteBatch::initialize(RHI::IShaderModule* vertexShader, RHI::IShaderModule* fragmentShader) {
+    if (!vertexShader || !fragmentShader) {
+        Core::log(Core::LogLevel::Error, "SpriteBatch: shaders ausentes");
+        return false;
+    }
+    RHI::GraphicsPipelineDesc p{};
+    p.vertexShader = vertexShader;
+    p.fragmentShader = fragmentShader;
+    p.vertexLayout.stride = sizeof(SpriteVertex);
+    p.vertexLayout.attributes.push_back({0, 2, offsetof(SpriteVertex, x)});
+    p.vertexLayout.attributes.push_back({1, 2, offsetof(SpriteVertex, u)});
+    p.vertexLayout.attributes.push_back({2, 4, offsetof(SpriteVertex, r)});
+    p.state.raster.cullMode = RHI::CullMode::None;
+    p.state.depthStencil.depthTestEnable = false;
+    p.state.depthStencil.depthWriteEnable = false;
+    p.state.blend.enable = true;
+    pipeline_ = device_.createGraphicsPipeline(p);
+
+    RHI::SamplerDesc s{};
+    s.addressU = RHI::AddressMode::ClampToEdge;
+    s.addressV = RHI::AddressMode::ClampToEdge;
+    linearSampler_ = device_.createSampler(s);
+    s.minFilter = RHI::FilterMode::Nearest;
+    s.magFilter = RHI::FilterMode::Nearest;
+    nearestSampler_ = device_.createSampler(s);
+
+    const uint32_t white = 0xFFFFFFFFu;
+    RHI::TextureDesc td{};
+    td.width = 1;
+    td.height = 1;
+    whiteTexture_ = device_.createTexture(td, &white);
+
+    if (!pipeline_ || !linearSampler_ || !nearestSampler_ || !whiteTexture_ || !createDebugFont()) {
+        Core::log(Core::LogLevel::Error, "SpriteBatch: falha ao criar pipeline/samplers/texturas");
+        return false;
+    }
+    return true;
+}
+
+bool SpriteBatch::createDebugFont() {
+    const uint32_t width = kFontColumns * kFontCellW;
+    const uint32_t height = kFontRows * kFontCellH;
+    // Branco com alfa = cobertura: a cor do texto vem do vértice
+    std::vector<uint32_t> pixels(static_cast<size_t>(width) * height, 0x00FFFFFFu);
+    for (uint32_t c = 0; c < 95; ++c) {
+        const uint32_t cx = (c % kFontColumns) * kFontCellW;
+        const uint32_t cy = (c / kFontColumns) * kFontCellH;
+        for (uint32_t col = 0; col < kFontGlyphW; ++col) {
+            for (uint32_t row = 0; row < kFontGlyphH; ++row) {
+                if (kDebugFont5x7[c][col] & (1u << row)) pixels[(cy + row) * width + cx + col] = 0xFFFFFFFFu;
+            }
+        }
+        Glyph& g = debugFont_.glyphs[kFontFirstChar + c];
+        g.u0 = static_cast<float>(cx) / width;
+        g.v0 = static_cast<float>(cy) / height;
+        g.u1 = static_cast<float>(cx + kFontGlyphW) / width;
+        g.v1 = static_cast<float>(cy + kFontGlyphH) / height;
+        g.width = static_cast<float>(kFontGlyphW);
+        g.height = static_cast<float>(kFontGlyphH);
+        g.advance = static_cast<float>(kFontCellW);
+    }
+    RHI::TextureDesc td{};
+    td.width = width;
+    td.height = height;
+    debugFontTexture_ = device_.createTexture(td, pixels.data());
+    if (!debugFontTexture_) return false;
+    debugFont_.texture = debugFontTexture_.get();
+    debugFont_.lineHeight = static_cast<float>(kFontCellH + 1);
+    setTextureFilter(debugFont_.texture, RHI::FilterMode::Nearest);
+    return true;
+}
+
+void SpriteBatch::setTextureFilter(RHI::ITexture* texture, RHI::FilterMode filter) {
+    auto& entry = textures_[texture];
+    if (entry.filter != filter) entry.set.reset();
+    entry.filter = filter;
+}
+
+void SpriteBatch::forgetTexture(RHI::ITexture* texture) {
+    textures_.erase(texture);
+}
+
+void SpriteBatch::begin(uint32_t viewportWidth, uint32_t viewportHeight) {
+    scaleX_ = viewportWidth ? 2.0f / static_cast<float>(viewportWidth) : 0.0f;
+    scaleY_ = viewportHeight ? 2.0f / static_cast<float>(viewportHeight) : 0.0f;
+    vertices_.clear();
+    keys_.clear();
+    frameTextures_.clear();
+    frameSlots_.clear();
+    lastTexture_ = nullptr;
+    lastSlot_ = 0;
+    batches_.clear();
+    frameVertexBuffer_ = nullptr;
+    stats_ = SpriteBatchStats{};
+}
+
+uint32_t SpriteBatch::textureSlot(RHI::ITexture* texture) {
+    // Submissões costumam vir em sequência com a mesma textura (texto, tiles)
+    if (texture == lastTexture_ && !frameTextures_.empty()) return lastSlot_;
+    auto [it, inserted] = frameSlots_.try_emplace(texture, static_cast<uint32_t>(frameTextures_.size()));
+    if (inserted) {
+        if (frameTextures_.size() >= kMaxTextureSlots) {
+            frameSlots_.erase(it);
+            return kMaxTextureSlots;
+        }
+        frameTextures_.push_back(texture);
+    }
+    lastTexture_ = texture;
+    lastSlot_ = it->second;
+    return lastSlot_;
+}
+
+void SpriteBatch::draw(const Sprite& sprite) {
+    RHI::ITexture* texture = sprite.texture ? sprite.texture : whiteTexture_.get();
+    const uint32_t slot = textureSlot(texture);
+    if (slot == kMaxTextureSlots) {
+        Core::log(Core::LogLevel::Warn, "SpriteBatch: texturas demais no frame; sprite ignorado");
+        return;
+    }
+
+    // Cantos relativos ao pivô (sentido: sup. esq., sup. dir., inf. dir., inf. esq.)
+    const float left = -sprite.pivotX * sprite.width;
+    const float top = -sprite.pivotY * sprite.height;
+    float cornersX[4] = {left, left + sprite.width, left + sprite.width, left};
+    float cornersY[4] = {top, top, top + sprite.height, top + sprite.height};
+    if (sprite.rotation != 0.0f) {
+        const float c = std::cos(sprite.rotation);
+        const float s = std::sin(sprite.rotation);
+        for (int i = 0; i < 4; ++i) {
+            const float x = cornersX[i];
+            const float y = cornersY[i];
+            cornersX[i] = x * c - y * s;
+            cornersY[i] = x * s + y * c;
+        }
+    }
+    const float us[4] = {sprite.u0, sprite.u1, sprite.u1, sprite.u0};
+    const float vs[4] = {sprite.v0, sprite.v0, sprite.v1, sprite.v1};
+
+    const uint32_t quad = static_cast<uint32_t>(keys_.size());
+    keys_.push_back((static_cast<uint64_t>(sprite.layer) << 48) | (static_cast<uint64_t>(slot) << 32) | quad);
+    for (int i = 0; i < 4; ++i) {
+        SpriteVertex v;
+        v.x = (sprite.x + cornersX[i]) * scaleX_ - 1.0f;
+        v.y = 1.0f - (sprite.y + cornersY[i]) * scaleY_;
+        v.u = us[i];
+        v.v = vs[i];
+        v.r = sprite.color[0];
+        v.g = sprite.color[1];
+        v.b = sprite.color[2];
+        v.a = sprite.color[3];
+        vertices_.push_back(v);
+    }
+}
+
+void SpriteBatch::drawRect(float x, float y, float width, float height, const float* color, uint16_t layer) {
+    Sprite s{};
+    s.x = x;
+    s.y = y;
+    s.width = width;
+    s.height = height;
+    if (color) std::copy(color, color + 4, s.color);
+    s.layer = layer;
+    draw(s);
+}
+
+float SpriteBatch::drawText(const BitmapFont& font, float x, float y, std::string_view text,
+                            const float* color, float scale, uint16_t layer) {
+    Sprite s{};
+    s.texture = font.texture;
+    if (color) std::copy(color, color + 4, s.color);
+    s.layer = layer;
+    float penX = x;
+    float penY = y;
+    float maxWidth = 0.0f;
+    for (char ch : text) {
+        if (ch == '\n') {
+            maxWidth = std::max(maxWidth, penX - x);
+            penX = x;
+            penY += font.lineHeight * scale;
+            continue;
+        }
+        const auto code = static_cast<unsigned char>(ch);
+        if (code >= font.glyphs.size()) continue;
+        const Glyph& g = font.glyphs[code];
+        if (g.width > 0.0f && g.height > 0.0f) {
+            s.x = penX + g.offsetX * scale;
+            s.y = penY + g.offsetY * scale;
+            s.width = g.width * scale;
+            s.height = g.height * scale;
+            s.u0 = g.u0; s.v0 = g.v0; s.u1 = g.u1; s.v1 = g.v1;
+            draw(s);
+        }
+        penX += g.advance * scale;
+    }
+    return std::max(maxWidth, penX - x);
+}
+
+float SpriteBatch::measureText(const BitmapFont& font, std::string_view text, float scale) {
+    float line = 0.0f;
+    float maxWidth = 0.0f;
+    for (char ch : text) {
+        if (ch == '\n') {
+            maxWidth = std::max(maxWidth, line);
+            line = 0.0f;
+            continue;
+        }
+        const auto code = static_cast<unsigned char>(ch);
+        if (code < font.glyphs.size()) line += font.glyphs[code].advance * scale;
+    }
+    return std::max(maxWidth, line);
+}
+
+RHI::IDescriptorSet* SpriteBatch::getDescriptorSet(RHI::ITexture* texture) {
+    auto& entry = textures_[texture];
+    if (!entry.set) {
+        RHI::DescriptorSetDesc desc{};
+        RHI::ISampler* sampler = entry.filter == RHI::FilterMode::Nearest ? nearestSampler_.get() : linearSampler_.get();
+        desc.sampledTextures.push_back({0, texture, sampler, nullptr});
+        entry.set = device_.createDescriptorSet(desc);
+    }
+    return entry.set.get();
+}
+
+bool SpriteBatch::ensureIndexCapacity(uint32_t quads) {
+    if (indexBuffer_ && quads <= quadCapacity_) return true;
+    uint32_t capacity = std::max(kMinQuadCapacity, quadCapacity_);
+    while (capacity < quads) capacity *= 2;
+    // Padrão fixo 0-1-2, 2-3-0 por quad: firstIndex = 6 * primeiro quad dispensa base vertex
+    std::vector<uint32_t> indices(static_cast<size_t>(capacity) * 6);
+    for (uint32_t q = 0; q < capacity; ++q) {
+        const uint32_t v = q * 4;
+        uint32_t* i = &indices[static_cast<size_t>(q) * 6];
+        i[0] = v; i[1] = v + 1; i[2] = v + 2;
+        i[3] = v + 2; i[4] = v + 3; i[5] = v;
+    }
+    indexBuffer_ = device_.createBuffer(indices.data(), indices.size() * sizeof(uint32_t), RHI::BufferUsage::Index);
+    if (!indexBuffer_) {
+        Core::log(Core::LogLevel::Error, "SpriteBatch: falha ao criar index buffer (" + std::to_string(capacity) + " quads)");
+        quadCapacity_ = 0;
+        return false;
+    }
+    quadCapacity_ = capacity;
+    return true;
+}
+
+RHI::IBuffer* SpriteBatch::uploadVertices(const std::vector<SpriteVertex>& vertices) {
+    const size_t bytes = vertices.size() * sizeof(SpriteVertex);
+    const uint32_t frames = std::max(1u, device_.getFramesInFlight());
+    if (vertexBuffers_.size() != frames) vertexBuffers_.resize(frames);
+    // Um buffer por frame em voo: o frame anterior ainda pode estar lendo o seu
+    auto& buffer = vertexBuffers_[device_.getFrameSlot() % frames];
+    if (!buffer || buffer->getSize() < bytes) {
+        size_t capacity = std::max(kMinVertexBufferBytes, buffer ? buffer->getSize() : 0);
+        while (capacity < bytes) capacity *= 2;
+        buffer = device_.createBuffer(nullptr, capacity, RHI::BufferUsage::Vertex, RHI::BufferUpdate::Stream);
+        if (!buffer) {
+            Core::log(Core::LogLevel::Error, "SpriteBatch: falha ao criar vertex buffer (" + std::to_string(capacity) + " bytes)");
+            return nullptr;
+        }
+    }
+    device_.updateBuffer(buffer.get(), vertices.data(), bytes, 0);
+    stats_.vertexBytes = bytes;
+    return buffer.get();
+}
+
+void SpriteBatch::sortKeys() {
+    // Radix LSD só nos bytes de camada/textura que variam: os índices já estão em ordem de submissão e o
+    // radix é estável, então quads de um mesmo grupo mantêm a ordem em que foram desenhados
+    uint64_t anyBits = 0, allBits = ~0ull;
+    for (uint64_t key : keys_) { anyBits |= key; allBits &= key; }
+    const uint64_t varying = anyBits ^ allBits;
+    scratchKeys_.resize(keys_.size());
+    for (uint32_t shift = 32; shift < 64; shift += 8) {
+        if (!((varying >> shift) & 0xFF)) continue;
+        std::array<uint32_t, 256> offsets{};
+        for (uint64_t key : keys_) ++offsets[(key >> shift) & 0xFF];
+        uint32_t running = 0;
+        for (uint32_t& o : offsets) { const uint32_t c = o; o = running; running += c; }
+        for (uint64_t key : keys_) scratchKeys_[offsets[(key >> shift) & 0xFF]++] = key;
+        keys_.swap(scratchKeys_);
+    }
+}
+
+void SpriteBatch::end() {
+    const uint32_t quads = static_cast<uint32_t>(keys_.size());
+    stats_.spriteCount = quads;
+    stats_.textureCount = static_cast<uint32_t>(frameTextures_.size());
+    if (!quads || !pipeline_) return;
+    if (!ensureIndexCapacity(quads)) return;
+
+    stats_.sortSkipped = std::is_sorted(keys_.begin(), keys_.end());
+    const std::vector<SpriteVertex>* upload = &vertices_;
+    if (!stats_.sortSkipped) {
+        sortKeys();
+        sorted_.resize(vertices_.size());
+        for (uint32_t q = 0; q < quads; ++q) {
+            const size_t src = static_cast<size_t>(keys_[q] & kQuadIndexMask) * 4;
+            std::copy_n(&vertices_[src], 4, &sorted_[static_cast<size_t>(q) * 4]);
+        }
+        upload = &sorted_;
+    }
+
+    // Quads consecutivos com a mesma textura viram um draw (camadas diferentes não quebram o batch)
+    uint32_t runSlot = 0xFFFFFFFFu;
+    for (uint32_t q = 0; q < quads; ++q) {
+        const uint32_t slot = static_cast<uint32_t>((keys_[q] >> 32) & 0xFFFF);
+        if (slot == runSlot) {
+            ++batches_.back().quadCount;
+            continue;
+        }
+        RHI::IDescriptorSet* set = getDescriptorSet(frameTextures_[slot]);
+        if (!set) {
+            runSlot = 0xFFFFFFFFu;
+            continue;
+        }
+        batches_.push_back(Batch{set, q, 1});
+        runSlot = slot;
+    }
+
+    frameVertexBuffer_ = uploadVertices(*upload);
+    if (!frameVertexBuffer_) batches_.clear();
+    stats_.drawCount = static_cast<uint32_t>(batches_.size());
+}
+
+void SpriteBatch::record(RHI::ICommandList& cmd) const {
+    if (batches_.empty() || !frameVertexBuffer_) return;
+    cmd.setGraphicsPipeline(pipeline_.get());
+    cmd.setVertexBuffer(frameVertexBuffer_);
+    cmd.setIndexBuffer(indexBuffer_.get());
+    for (const Batch& b : batches_) {
+        cmd.bindDescriptorSet(b.set);
+        cmd.drawIndexed(b.quadCount * 6, b.firstQuad * 6, RHI::IndexType::Uint32);
+    }
+}
+
+}
@@ -0,0 +1,148 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace Aurora::RHI {
+
+// Regras de layout de blocos GLSL: std140 (UBOs) e std430 (SSBOs; arrays e matrizes sem arredondar a vec4)
+enum class BlockLayout : uint8_t { Std140, Std430 };
+
+// Tipos de membro suportados (matrizes column-major; structs aninhadas não são suportadas)
+enum class GlslType : uint8_t {
+    Float, Int, UInt, Bool,
+    Vec2, Vec3, Vec4,
+    IVec2, IVec3, IVec4,
+    UVec2, UVec3, UVec4,
+    Mat2, Mat3, Mat4
+};
+
+// Membro do bloco ligado ao campo C++ correspondente (use AURORA_BLOCK_FIELD/AURORA_BLOCK_ARRAY)
+struct BlockFieldDesc {
+    GlslType type{GlslType::Float};
+    uint32_t arrayCount{0};  // 0 = não é array
+    size_t cppOffset{0};
+    size_t cppSize{0};
+    const char* name{nullptr};
+};
+
+// Descrição completa de uma struct C++ espelhando um bloco GLSL
+struct BlockLayoutDesc {
+    BlockLayout layout{BlockLayout::Std140};
+    std::span<const BlockFieldDesc> fields{};
+    size_t cppSize{0};
+};
+
+// Offset/tamanho de um membro segundo as regras do layout
+struct BlockMemberLayout {
+    uint32_t offset{0};
+    uint32_t size{0};
+    uint32_t arrayStride{0};  // arrays: distância entre elementos; matrizes: distância entre colunas
+};
+
+constexpr uint32_t alignBlockOffset(uint32_t value, uint32_t alignment) {
+    return (value + alignment - 1u) / alignment * alignment;
+}
+
+// Linhas (componentes por coluna) e colunas do tipo
+constexpr uint32_t getGlslTypeRows(GlslType type) {
+    switch (type) {
+        case GlslType::Vec2: case GlslType::IVec2: case GlslType::UVec2: case GlslType::Mat2: return 2;
+        case GlslType::Vec3: case GlslType::IVec3: case GlslType::UVec3: case GlslType::Mat3: return 3;
+        case GlslType::Vec4: case GlslType::IVec4: case GlslType::UVec4: case GlslType::Mat4: return 4;
+        default: return 1;
+    }
+}
+
+constexpr uint32_t getGlslTypeColumns(GlslType type) {
+    switch (type) {
+        case GlslType::Mat2: return 2;
+        case GlslType::Mat3: return 3;
+        case GlslType::Mat4: return 4;
+        default: return 1;
+    }
+}
+
+// Alinhamento base de um vetor de N componentes de 4 bytes (vec3 alinha como vec4)
+constexpr uint32_t getGlslVectorAlignment(uint32_t rows) {
+    return rows == 1 ? 4u : (rows == 2 ? 8u : 16u);
+}
+
+// Alinhamento base do membro (regras 1-10 da spec; arrays/matrizes arredondam a vec4 apenas em std140)
+constexpr uint32_t getBlockMemberAlignment(BlockLayout layout, GlslType type, uint32_t arrayCount) {
+    const uint32_t vectorAlign = getGlslVectorAlignment(getGlslTypeRows(type));
+    const bool aggregate = arrayCount > 0 || getGlslTypeColumns(type) > 1;
+    if (aggregate && layout == BlockLayout::Std140) return alignBlockOffset(vectorAlign, 16);
+    return vectorAlign;
+}
+
+// Posiciona o membro a partir de cursor (fim do membro anterior)
+constexpr BlockMemberLayout layoutBlockMember(BlockLayout layout, GlslType type, uint32_t arrayCount, uint32_t cursor) {
+    const uint32_t rows = getGlslTypeRows(type);
+    const uint32_t columns = getGlslTypeColumns(type);
+    const uint32_t alignment = getBlockMemberAlignment(layout, type, arrayCount);
+    BlockMemberLayout m{};
+    m.offset = alignBlockOffset(cursor, alignment);
+    const bool aggregate = arrayCount > 0 || columns > 1;
+    // Colunas de matriz e elementos de array de vetores ocupam um slot alinhado; escalar/vetor isolado usa 4*rows
+    const uint32_t columnStride = aggregate ? alignment : 4u * rows;
+    const uint32_t elementSize = columnStride * columns;
+    if (arrayCount > 0) {
+        m.arrayStride = alignBlockOffset(elementSize, alignment);
+        m.size = m.arrayStride * arrayCount;
+    } else {
+        m.arrayStride = columns > 1 ? columnStride : 0;
+        m.size = elementSize;
+    }
+    return m;
+}
+
+constexpr BlockMemberLayout getBlockMemberLayout(BlockLayout layout, std::span<const BlockFieldDesc> fields, size_t index) {
+    uint32_t cursor = 0;
+    BlockMemberLayout m{};
+    for (size_t i = 0; i <= index && i < fields.size(); ++i) {
+        m = layoutBlockMember(layout, fields[i].type, fields[i].arrayCount, cursor);
+        cursor = m.offset + m.size;
+    }
+    return m;
+}
+
+// Tamanho mínimo do range a bindar: fim do último membro arredondado ao maior alinhamento (vec4 em std140)
+constexpr uint32_t getBlockSize(BlockLayout layout, std::span<const BlockFieldDesc> fields) {
+    uint32_t cursor = 0;
+    uint32_t maxAlign = layout == BlockLayout::Std140 ? 16u : 4u;
+    for (const auto& f : fields) {
+        const BlockMemberLayout m = layoutBlockMember(layout, f.type, f.arrayCount, cursor);
+        cursor = m.offset + m.size;
+        const uint32_t a = getBlockMemberAlignment(layout, f.type, f.arrayCount);
+        if (a > maxAlign) maxAlign = a;
+    }
+    return alignBlockOffset(cursor, maxAlign);
+}
+
+// Índice do primeiro campo cujo offset/tamanho C++ diverge do layout GLSL; fields.size() se tudo confere
+constexpr size_t findBlockLayoutMismatch(BlockLayout layout, std::span<const BlockFieldDesc> fields) {
+    uint32_t cursor = 0;
+    for (size_t i = 0; i < fields.size(); ++i) {
+        const BlockMemberLayout m = layoutBlockMember(layout, fields[i].type, fields[i].arrayCount, cursor);
+        if (fields[i].cppOffset != m.offset || fields[i].cppSize != m.size) return i;
+        cursor = m.offset + m.size;
+    }
+    return fields.size();
+}
+
+// true se todos os campos coincidem e a struct C++ cobre o tamanho do bloco (uso em static_assert)
+constexpr bool matchesBlockLayout(const BlockLayoutDesc& desc) {
+    return findBlockLayoutMismatch(desc.layout, desc.fields) == desc.fields.size()
+        && desc.cppSize >= getBlockSize(desc.layout, desc.fields);
+}
+
+}
+
+// Descrevem um campo de Struct como membro GLSL; exigem struct standard-layout (offsetof em constexpr).
+// Ex.: static constexpr RHI::BlockFieldDesc kFields[] = { AURORA_BLOCK_FIELD(Globals, color, Vec4) };
+#define AURORA_BLOCK_FIELD(Struct, member, glslType) \
+    ::Aurora::RHI::BlockFieldDesc{ ::Aurora::RHI::GlslType::glslType, 0u, offsetof(Struct, member), sizeof(Struct::member), #member }
+#define AURORA_BLOCK_ARRAY(Struct, member, glslType, count) \
+    ::Aurora::RHI::BlockFieldDesc{ ::Aurora::RHI::GlslType::glslType, (count), offsetof(Struct, member), sizeof(Struct::member), #member }
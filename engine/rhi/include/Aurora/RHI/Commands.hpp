@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <span>
 #include "Resources.hpp"
 #include "Pipeline.hpp"
 #include "Descriptors.hpp"
@@ -10,6 +11,37 @@ namespace Aurora::RHI {
 class ISwapchain; // fwd
 class IRenderPass; // fwd
 
+// Consumidores que precisam enxergar escritas anteriores de compute (memoryBarrier)
+enum BarrierFlags : uint32_t {
+    Barrier_StorageBuffer  = 1 << 0, // leitura/escrita de SSBO
+    Barrier_StorageTexture = 1 << 1, // leitura/escrita de imagem de storage
+    Barrier_VertexIndex    = 1 << 2, // buffer usado como vertex/index
+    Barrier_Indirect       = 1 << 3, // argumentos de dispatchIndirect
+    Barrier_Uniform        = 1 << 4, // buffer usado como UBO
+    Barrier_Sampled        = 1 << 5, // textura amostrada
+    Barrier_All = Barrier_StorageBuffer | Barrier_StorageTexture | Barrier_VertexIndex
+                | Barrier_Indirect | Barrier_Uniform | Barrier_Sampled
+};
+
+// Sequência de estado + draws gravada uma vez e reexecutada em qualquer render pass (geometria estática).
+// end() valida e remove binds redundantes; o bundle é imutável até o próximo begin().
+// Recursos referenciados precisam viver enquanto o bundle for usado.
+class ICommandBundle {
+public:
+    virtual ~ICommandBundle() = default;
+    virtual void begin() = 0;
+    virtual void end() = 0;
+    virtual void setGraphicsPipeline(IGraphicsPipeline* pipeline) = 0;
+    virtual void setVertexBuffer(IBuffer* buffer) = 0;
+    virtual void setIndexBuffer(IBuffer* buffer) = 0;
+    // dynamicOffsets: um por UniformBinding::dynamic do set (ordem crescente de binding)
+    virtual void bindDescriptorSet(IDescriptorSet* set, std::span<const uint32_t> dynamicOffsets = {}) = 0;
+    virtual void draw(uint32_t vertexCount, uint32_t firstVertex) = 0;
+    virtual void drawIndexed(uint32_t indexCount, uint32_t firstIndex, IndexType indexType) = 0;
+    // false se a gravação falhou na validação (executeBundle ignora bundles inválidos)
+    virtual bool isValid() const = 0;
+};
+
 class ICommandList {
 public:
     virtual ~ICommandList() = default;
@@ -20,9 +52,25 @@ public:
     virtual void setGraphicsPipeline(IGraphicsPipeline* pipeline) = 0;
     virtual void setVertexBuffer(IBuffer* buffer) = 0;
     virtual void setIndexBuffer(IBuffer* buffer) = 0;
-    virtual void bindDescriptorSet(IDescriptorSet* set) = 0;
+    // dynamicOffsets: um por UniformBinding::dynamic do set (ordem crescente de binding)
+    virtual void bindDescriptorSet(IDescriptorSet* set, std::span<const uint32_t> dynamicOffsets = {}) = 0;
     virtual void draw(uint32_t vertexCount, uint32_t firstVertex) = 0;
     virtual void drawIndexed(uint32_t indexCount, uint32_t firstIndex, IndexType indexType) = 0;
+    // Buffer dos atributos por instância (VertexLayoutDesc::instanceAttributes)
+    virtual void setInstanceBuffer(IBuffer* buffer) = 0;
+    // firstInstance desloca a leitura dos atributos por instância (não use gl_InstanceID/gl_InstanceIndex,
+    // que diferem entre GL e Vulkan quando firstInstance != 0)
+    virtual void drawInstanced(uint32_t vertexCount, uint32_t firstVertex, uint32_t instanceCount, uint32_t firstInstance) = 0;
+    virtual void drawIndexedInstanced(uint32_t indexCount, uint32_t firstIndex, IndexType indexType, uint32_t instanceCount, uint32_t firstInstance) = 0;
+    // Compute: fora de render pass. bindDescriptorSet depois de setComputePipeline vale para o dispatch.
+    virtual void setComputePipeline(IComputePipeline* pipeline) = 0;
+    virtual void dispatch(uint32_t groupsX, uint32_t groupsY, uint32_t groupsZ) = 0;
+    // Lê {groupsX, groupsY, groupsZ} (uint32) de buffer + offset (offset múltiplo de 4)
+    virtual void dispatchIndirect(IBuffer* buffer, size_t offset) = 0;
+    // Torna escritas de compute anteriores visíveis aos consumidores em BarrierFlags
+    virtual void memoryBarrier(uint32_t barriers) = 0;
+    // Reexecuta um bundle dentro do render pass corrente; o estado bindado depois é o do fim do bundle
+    virtual void executeBundle(ICommandBundle* bundle) = 0;
     // Debug helpers
     virtual void setDebugWireframe(bool enable) = 0;
 };
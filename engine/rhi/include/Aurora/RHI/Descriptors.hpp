@@ -13,6 +13,28 @@ struct UniformBinding {
     size_t offset{0};
     size_t size{0};
     const char* blockName{nullptr}; // use OU binding OU nome. Se blockName != nullptr, binding é ignorado.
+    // Offset dinâmico: bindDescriptorSet recebe um offset extra por binding dinâmico (em ordem crescente de
+    // binding, como no Vulkan) e o range [offset + dinâmico, +size) é bindado. size é obrigatório e o offset
+    // dinâmico deve ser múltiplo de Capabilities::uniformBufferOffsetAlignment.
+    bool dynamic{false};
+};
+
+// SSBO (layout(std430, binding = N) buffer); size == 0 usa o buffer inteiro a partir de offset
+struct StorageBufferBinding {
+    uint32_t binding{0};
+    IBuffer* buffer{nullptr};
+    size_t offset{0};
+    size_t size{0};
+};
+
+enum class StorageAccess : uint8_t { ReadOnly, WriteOnly, ReadWrite };
+
+// Imagem de storage (layout(binding = N, <formato>) uniform image2D); a textura precisa de TextureUsage::Storage
+struct StorageTextureBinding {
+    uint32_t binding{0};
+    ITexture* texture{nullptr};
+    uint32_t mipLevel{0};
+    StorageAccess access{StorageAccess::ReadWrite};
 };
 
 struct DescriptorSetDesc {
@@ -24,6 +46,8 @@ struct DescriptorSetDesc {
         const char* uniformName{nullptr}; // se fornecido, binding é ignorado
     };
     std::vector<SampledTextureBinding> sampledTextures;
+    std::vector<StorageBufferBinding> storageBuffers;
+    std::vector<StorageTextureBinding> storageTextures;
 };
 
 class IDescriptorSet {
@@ -13,6 +13,7 @@ namespace Aurora::RHI {
 enum class BackendType {
     Null,
     OpenGL,
+    Vulkan, // requer AURORA_RHI_VULKAN=ON
 };
 
 struct SwapchainDesc {
@@ -20,6 +21,8 @@ struct SwapchainDesc {
     uint32_t width{0};
     uint32_t height{0};
     bool vsync{true};
+    // Frames que a CPU pode gravar à frente da GPU (OpenGL: 1..3 via fences; Vulkan: fixo em 2)
+    uint32_t framesInFlight{2};
 };
 
 class ISwapchain {
@@ -32,19 +35,37 @@ public:
     virtual void setVsync(bool enabled) = 0;
 };
 
+// O que acontece com o conteúdo de um attachment no início do pass
+enum class LoadAction : uint8_t {
+    Load,     // preserva o conteúdo anterior
+    Clear,    // limpa com clearColor/clearDepth
+    DontCare, // conteúdo indefinido (será totalmente sobrescrito): sem clear nem leitura
+};
+
+// O que acontece no fim do pass
+enum class StoreAction : uint8_t {
+    Store,    // conteúdo preservado para passes seguintes
+    DontCare, // descartado (GL: glInvalidateFramebuffer) — ex.: depth transitório
+    Resolve,  // copiado para Attachment::resolveTarget e descartado na origem
+};
+
 struct RenderPassDesc {
-    // Clear e depth
     float clearColor[4]{0.1f, 0.1f, 0.1f, 1.0f};
-    bool clearColorEnabled{true};
-    bool clearDepthEnabled{true};
     float clearDepth{1.0f};
-    // Attachments opcionais (MVP: ignorados no OpenGL e tratamos backbuffer)
     struct Attachment {
         ITexture* texture{nullptr};
         uint32_t mipLevel{0};
+        LoadAction load{LoadAction::Clear};
+        StoreAction store{StoreAction::Store};
+        ITexture* resolveTarget{nullptr}; // StoreAction::Resolve (mesmo formato; não vale para o backbuffer)
     };
     std::vector<Attachment> colorAttachments;
     Attachment depthAttachment{};
+    // Sem attachments o pass renderiza no backbuffer do swapchain com estas ações
+    LoadAction swapchainColorLoad{LoadAction::Clear};
+    StoreAction swapchainColorStore{StoreAction::Store};
+    LoadAction swapchainDepthLoad{LoadAction::Clear};
+    StoreAction swapchainDepthStore{StoreAction::DontCare};
 };
 
 class IRenderPass {
@@ -56,8 +77,16 @@ class IDevice {
 public:
     virtual ~IDevice() = default;
     virtual const char* getName() const = 0;
+    // beginFrame espera o frame que usou o mesmo slot (N frames atrás); recursos destruídos só são
+    // liberados de fato quando os frames que podem referenciá-los terminam na GPU
     virtual void beginFrame() = 0;
     virtual void endFrame() = 0;
+    // Tempo de GPU (ms) do frame mais recente já concluído, medido entre beginFrame e endFrame.
+    // Chega com atraso de até getFramesInFlight() frames; 0 sem Capabilities::supportsGpuTiming.
+    virtual float getGpuFrameTimeMs() const = 0;
+    // Slot do frame corrente em [0, getFramesInFlight()): índice para ring buffers de upload por frame
+    virtual uint32_t getFramesInFlight() const = 0;
+    virtual uint32_t getFrameSlot() const = 0;
     virtual std::unique_ptr<ISwapchain> createSwapchain(const SwapchainDesc& desc) = 0;
     virtual std::unique_ptr<IRenderPass> createRenderPass(const RenderPassDesc& desc) = 0;
     virtual void beginRenderPass(IRenderPass* renderPass, ISwapchain* target) = 0;
@@ -65,8 +94,11 @@ public:
 
     // Resources
     virtual std::unique_ptr<IShaderModule> createShaderModule(const ShaderModuleDesc& desc) = 0;
-    virtual std::unique_ptr<IBuffer> createBuffer(const void* data, size_t bytes, BufferUsage usage) = 0;
+    virtual std::unique_ptr<IBuffer> createBuffer(const void* data, size_t bytes, BufferUsage usage,
+                                                 BufferUpdate update = BufferUpdate::Static) = 0;
     virtual std::unique_ptr<IGraphicsPipeline> createGraphicsPipeline(const GraphicsPipelineDesc& desc) = 0;
+    // nullptr se !Capabilities::supportsCompute
+    virtual std::unique_ptr<IComputePipeline> createComputePipeline(const ComputePipelineDesc& desc) = 0;
     virtual std::unique_ptr<IDescriptorSet> createDescriptorSet(const DescriptorSetDesc& desc) = 0;
     virtual void updateBuffer(IBuffer* buffer, const void* data, size_t bytes, size_t dstOffset = 0) = 0;
     // Textures/samplers
@@ -77,17 +109,35 @@ public:
     virtual void setGraphicsPipeline(IGraphicsPipeline* pipeline) = 0;
     virtual void setVertexBuffer(IBuffer* buffer) = 0;
     virtual void setIndexBuffer(IBuffer* buffer) = 0;
-    virtual void bindDescriptorSet(IDescriptorSet* set) = 0;
+    virtual void bindDescriptorSet(IDescriptorSet* set, std::span<const uint32_t> dynamicOffsets = {}) = 0;
     virtual void draw(uint32_t vertexCount, uint32_t firstVertex) = 0;
     virtual void drawIndexed(uint32_t indexCount, uint32_t firstIndex, IndexType indexType) = 0;
+    virtual void setInstanceBuffer(IBuffer* buffer) = 0;
+    virtual void drawInstanced(uint32_t vertexCount, uint32_t firstVertex, uint32_t instanceCount, uint32_t firstInstance) = 0;
+    virtual void drawIndexedInstanced(uint32_t indexCount, uint32_t firstIndex, IndexType indexType, uint32_t instanceCount, uint32_t firstInstance) = 0;
+    virtual void setComputePipeline(IComputePipeline* pipeline) = 0;
+    virtual void dispatch(uint32_t groupsX, uint32_t groupsY, uint32_t groupsZ) = 0;
+    virtual void dispatchIndirect(IBuffer* buffer, size_t offset) = 0;
+    virtual void memoryBarrier(uint32_t barriers) = 0;
 
     // Command list
     virtual std::unique_ptr<ICommandList> createCommandList() = 0;
+    virtual std::unique_ptr<ICommandBundle> createCommandBundle() = 0;
     virtual void submit(ICommandList* list) = 0;
 
     struct Capabilities {
         bool supportsGLSL420{false};
         bool hasShadingLanguage420Pack{false};
+        // Alinhamento exigido para offsets de UBO (UniformBinding::offset e offsets dinâmicos)
+        uint32_t uniformBufferOffsetAlignment{256};
+        // Compute shaders, SSBOs e imagens de storage (GL 4.3 / ARB_compute_shader)
+        bool supportsCompute{false};
+        uint32_t storageBufferOffsetAlignment{256};
+        // Módulos SPIR-V (GL 4.6 / ARB_gl_spirv); spirvVulkanTarget: binários compilados para Vulkan (.vk.spv)
+        bool supportsSpirv{false};
+        bool spirvVulkanTarget{false};
+        // getGpuFrameTimeMs() mede o frame (timer query); sem isso, use o tempo de CPU
+        bool supportsGpuTiming{false};
     };
     virtual Capabilities getCapabilities() const = 0;
 
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace Aurora::RHI {
+
+// Handle de 32 bits: 20 bits de índice no pool + 12 bits de geração. Gerações começam em 1, então um handle
+// zero-inicializado nunca resolve; destruir um recurso incrementa a geração do slot e invalida cópias antigas.
+template <typename Tag>
+struct Handle {
+    static constexpr uint32_t kIndexBits = 20;
+    static constexpr uint32_t kIndexMask = (1u << kIndexBits) - 1u;
+    static constexpr uint32_t kMaxGeneration = (1u << (32u - kIndexBits)) - 1u;
+
+    uint32_t value{0};
+
+    static constexpr Handle make(uint32_t index, uint32_t generation) { return Handle{(generation << kIndexBits) | index}; }
+    constexpr uint32_t index() const { return value & kIndexMask; }
+    constexpr uint32_t generation() const { return value >> kIndexBits; }
+    constexpr bool isValid() const { return value != 0; }
+    constexpr bool operator==(const Handle&) const = default;
+};
+
+using BufferHandle = Handle<struct BufferHandleTag>;
+using TextureHandle = Handle<struct TextureHandleTag>;
+using SamplerHandle = Handle<struct SamplerHandleTag>;
+using ShaderModuleHandle = Handle<struct ShaderModuleHandleTag>;
+using GraphicsPipelineHandle = Handle<struct GraphicsPipelineHandleTag>;
+using ComputePipelineHandle = Handle<struct ComputePipelineHandleTag>;
+using DescriptorSetHandle = Handle<struct DescriptorSetHandleTag>;
+
+// Pool denso por tipo em SoA: cada coluna (Ts...) é um vetor contíguo indexado pelo slot, com gerações e lista
+// livre à parte. Validar um handle é comparar a geração do slot; handles velhos resolvem para nullptr.
+// Slots cuja geração estoura são aposentados (nunca reutilizados). Não é thread-safe.
+template <typename H, typename... Ts>
+class HandlePool {
+public:
+    H create(Ts... values) {
+        uint32_t index = 0;
+        if (!freeList_.empty()) {
+            index = freeList_.back();
+            freeList_.pop_back();
+            generations_[index] &= static_cast<uint16_t>(~kFreeBit);
+        } else {
+            if (generations_.size() > H::kIndexMask) return {};
+            index = static_cast<uint32_t>(generations_.size());
+            generations_.push_back(1);
+            std::apply([](auto&... column) { (column.emplace_back(), ...); }, columns_);
+        }
+        assign(index, std::index_sequence_for<Ts...>{}, std::move(values)...);
+        ++count_;
+        return H::make(index, generations_[index]);
+    }
+
+    bool isValid(H handle) const {
+        const uint32_t index = handle.index();
+        return handle.isValid() && index < generations_.size() && generations_[index] == handle.generation();
+    }
+
+    // Ponteiro para a coluna I do slot (nullptr se o handle estiver velho ou for inválido)
+    template <size_t I>
+    auto* get(H handle) {
+        return isValid(handle) ? &std::get<I>(columns_)[handle.index()] : nullptr;
+    }
+    template <size_t I>
+    const auto* get(H handle) const {
+        return isValid(handle) ? &std::get<I>(columns_)[handle.index()] : nullptr;
+    }
+
+    // Libera o slot (colunas voltam ao valor padrão, destruindo o que possuíam)
+    bool destroy(H handle) {
+        if (!isValid(handle)) return false;
+        const uint32_t index = handle.index();
+        std::apply([index](auto&... column) { ((column[index] = {}), ...); }, columns_);
+        --count_;
+        if (generations_[index] >= H::kMaxGeneration) {
+            generations_[index] = 0; // aposentado: nenhum handle tem geração 0
+        } else {
+            generations_[index] = static_cast<uint16_t>((generations_[index] + 1u) | kFreeBit);
+            freeList_.push_back(index);
+        }
+        return true;
+    }
+
+    // Chama fn(handle) para cada slot vivo
+    template <typename Fn>
+    void forEach(Fn&& fn) const {
+        for (uint32_t i = 0; i < generations_.size(); ++i) {
+            const uint16_t generation = generations_[i];
+            if (generation != 0 && !(generation & kFreeBit)) fn(H::make(i, generation));
+        }
+    }
+
+    void clear() {
+        std::apply([](auto&... column) { (column.clear(), ...); }, columns_);
+        generations_.clear();
+        freeList_.clear();
+        count_ = 0;
+    }
+
+    uint32_t size() const { return count_; }
+    uint32_t capacity() const { return static_cast<uint32_t>(generations_.size()); }
+
+private:
+    // Slot livre: guarda a próxima geração com este bit, que nunca casa com a geração de um handle
+    static constexpr uint16_t kFreeBit = 0x8000;
+
+    template <size_t... Is, typename... Vs>
+    void assign(uint32_t index, std::index_sequence<Is...>, Vs&&... values) {
+        ((std::get<Is>(columns_)[index] = std::forward<Vs>(values)), ...);
+    }
+
+    std::tuple<std::vector<Ts>...> columns_;
+    std::vector<uint16_t> generations_;
+    std::vector<uint32_t> freeList_;
+    uint32_t count_{0};
+};
+
+}
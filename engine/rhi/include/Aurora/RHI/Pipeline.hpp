@@ -1,8 +1,10 @@
 #pragma once
 
 #include <cstdint>
+#include <vector>
 #include "Formats.hpp"
 #include "Resources.hpp"
+#include "BlockLayout.hpp"
 
 namespace Aurora::RHI {
 
@@ -13,6 +15,8 @@ public:
 
 enum class DepthFunc : uint8_t { Never, Less, Equal, LessEqual, Greater, NotEqual, GreaterEqual, Always };
 enum class CullMode : uint8_t { None, Front, Back };
+// Como os vértices de um draw são montados em primitivas (vale para todos os draws do pipeline)
+enum class PrimitiveTopology : uint8_t { TriangleList, LineList };
 
 enum class BlendFactor : uint8_t {
     Zero, One,
@@ -50,16 +54,37 @@ struct DepthStencilState {
 };
 
 struct PipelineStateDesc {
+    PrimitiveTopology topology{PrimitiveTopology::TriangleList};
     RasterState raster{};
     BlendState blend{};
     DepthStencilState depthStencil{};
 };
 
+class IComputePipeline {
+public:
+    virtual ~IComputePipeline() = default;
+};
+
+// Verificação opcional do uniform block refletido contra a struct C++ que o preenche. O bloco é localizado
+// por blockName (GLSL) ou, sem nome/sem match, pelo binding (SPIR-V sem nomes). Divergências de offsets ou
+// tamanho geram warning na criação do pipeline (OpenGL; Vulkan ignora, sem reflexão de SPIR-V).
+struct UniformBlockLayoutCheck {
+    uint32_t binding{0};
+    const char* blockName{nullptr};
+    BlockLayoutDesc layout{};
+};
+
+struct ComputePipelineDesc {
+    IShaderModule* computeShader{nullptr};
+    std::vector<UniformBlockLayoutCheck> uniformBlockLayouts;
+};
+
 struct GraphicsPipelineDesc {
     IShaderModule* vertexShader{nullptr};
     IShaderModule* fragmentShader{nullptr};
     VertexLayoutDesc vertexLayout{};
     PipelineStateDesc state{};
+    std::vector<UniformBlockLayoutCheck> uniformBlockLayouts;
 };
 
 }
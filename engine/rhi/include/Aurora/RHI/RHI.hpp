@@ -3,10 +3,14 @@
 // RHI agregado: reexporta headers fatiados
 #include "Formats.hpp"
 #include "Resources.hpp"
+#include "BlockLayout.hpp"
 #include "Pipeline.hpp"
 #include "Descriptors.hpp"
 #include "Commands.hpp"
 #include "Device.hpp"
+#include "RenderTargetPool.hpp"
+#include "Handles.hpp"
+#include "ResourceRegistry.hpp"
 
 // Desabilita o conteúdo monolítico legado abaixo
 #if 0
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+#include "Resources.hpp"
+
+namespace Aurora::RHI {
+
+class IDevice;
+
+struct RenderTargetPoolStats {
+    uint32_t textureCount{0};   // texturas vivas no pool (livres + em uso)
+    uint32_t inUseCount{0};
+    uint64_t pooledBytes{0};    // memória estimada de todas as texturas do pool
+    uint64_t inUseBytes{0};
+    uint64_t acquireCount{0};   // acumulados desde a criação
+    uint64_t reuseCount{0};
+    uint64_t allocationCount{0};
+    uint64_t evictionCount{0};
+
+    double getReuseRate() const { return acquireCount ? static_cast<double>(reuseCount) / static_cast<double>(acquireCount) : 0.0; }
+};
+
+// Pool de render targets transitórios chaveado pelo TextureDesc completo (tamanho, formato, mips e usage).
+// Quem renderiza adquire/devolve targets por frame em vez de possuí-los; texturas livres por mais de
+// maxUnusedFrames frames são destruídas em endFrame(). Não é thread-safe.
+class RenderTargetPool {
+public:
+    explicit RenderTargetPool(IDevice& device) : device_(device) {}
+    ~RenderTargetPool() { clear(); }
+
+    RenderTargetPool(const RenderTargetPool&) = delete;
+    RenderTargetPool& operator=(const RenderTargetPool&) = delete;
+
+    // Reaproveita uma textura livre com o mesmo desc ou cria uma nova (nullptr em falha)
+    ITexture* acquire(const TextureDesc& desc);
+    // Devolve ao pool; o conteúdo não é preservado para o próximo acquire
+    void release(ITexture* texture);
+
+    // Avança o relógio de frames e descarta texturas livres antigas
+    void endFrame();
+    // Destroi todas as texturas livres (as em uso continuam válidas até release)
+    void trim();
+    void clear();
+
+    void setMaxUnusedFrames(uint32_t frames) { maxUnusedFrames_ = frames; }
+    const RenderTargetPoolStats& getStats() const { return stats_; }
+
+private:
+    struct Entry {
+        std::unique_ptr<ITexture> texture;
+        uint64_t lastUsedFrame{0};
+        bool inUse{false};
+    };
+
+    struct DescHash {
+        size_t operator()(const TextureDesc& d) const {
+            size_t h = static_cast<size_t>(d.width) * 73856093u;
+            h ^= static_cast<size_t>(d.height) * 19349663u;
+            h ^= (static_cast<size_t>(d.format) << 8) ^ (static_cast<size_t>(d.usage) << 16) ^ (static_cast<size_t>(d.mipLevels) << 24);
+            return h;
+        }
+    };
+
+    void evict(bool onlyStale);
+
+    IDevice& device_;
+    std::unordered_map<TextureDesc, std::vector<Entry>, DescHash> buckets_;
+    std::unordered_map<ITexture*, TextureDesc> inUse_;
+    RenderTargetPoolStats stats_{};
+    uint64_t frame_{0};
+    uint32_t maxUnusedFrames_{3};
+};
+
+}
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include "Handles.hpp"
+#include "Resources.hpp"
+#include "Pipeline.hpp"
+#include "Descriptors.hpp"
+
+namespace Aurora::RHI {
+
+class IDevice;
+
+struct ResourceRegistryStats {
+    uint32_t bufferCount{0};
+    uint32_t textureCount{0};
+    uint32_t samplerCount{0};
+    uint32_t shaderModuleCount{0};
+    uint32_t pipelineCount{0};      // gráficos + compute
+    uint32_t descriptorSetCount{0};
+    uint64_t staleAccessCount{0};   // resoluções/destruições com handle velho (acumulado)
+};
+
+// Dono dos recursos do device acessados por handles geracionais de 32 bits. Cada tipo vive num HandlePool
+// denso em SoA: o objeto do backend numa coluna e os dados quentes (tamanho/uso do buffer, desc da textura,
+// estágio do shader) em colunas próprias, consultáveis sem tocar no objeto. Handles velhos resolvem para
+// nullptr (contados em staleAccessCount e logados em debug) em vez de acessar memória liberada.
+// A destruição segue as regras do backend (GL/Vulkan adiam a liberação até a GPU terminar). Não é thread-safe.
+class ResourceRegistry {
+public:
+    explicit ResourceRegistry(IDevice& device) : device_(device) {}
+    ~ResourceRegistry() { clear(); }
+
+    ResourceRegistry(const ResourceRegistry&) = delete;
+    ResourceRegistry& operator=(const ResourceRegistry&) = delete;
+
+    // Criação via device (handle inválido em falha)
+    BufferHandle createBuffer(const void* data, size_t bytes, BufferUsage usage, BufferUpdate update = BufferUpdate::Static);
+    TextureHandle createTexture(const TextureDesc& desc, const void* initialPixelsRGBA8 = nullptr);
+    SamplerHandle createSampler(const SamplerDesc& desc);
+    ShaderModuleHandle createShaderModule(const ShaderModuleDesc& desc);
+    GraphicsPipelineHandle createGraphicsPipeline(const GraphicsPipelineDesc& desc);
+    ComputePipelineHandle createComputePipeline(const ComputePipelineDesc& desc);
+    DescriptorSetHandle createDescriptorSet(const DescriptorSetDesc& desc);
+
+    // Adota objetos já criados (migração incremental de código baseado em unique_ptr)
+    BufferHandle adopt(std::unique_ptr<IBuffer> buffer);
+    TextureHandle adopt(std::unique_ptr<ITexture> texture);
+    SamplerHandle adopt(std::unique_ptr<ISampler> sampler);
+    ShaderModuleHandle adopt(std::unique_ptr<IShaderModule> module);
+    GraphicsPipelineHandle adopt(std::unique_ptr<IGraphicsPipeline> pipeline);
+    ComputePipelineHandle adopt(std::unique_ptr<IComputePipeline> pipeline);
+    DescriptorSetHandle adopt(std::unique_ptr<IDescriptorSet> set);
+
+    IBuffer* get(BufferHandle handle) const;
+    ITexture* get(TextureHandle handle) const;
+    ISampler* get(SamplerHandle handle) const;
+    IShaderModule* get(ShaderModuleHandle handle) const;
+    IGraphicsPipeline* get(GraphicsPipelineHandle handle) const;
+    IComputePipeline* get(ComputePipelineHandle handle) const;
+    IDescriptorSet* get(DescriptorSetHandle handle) const;
+
+    template <typename Tag>
+    bool isValid(Handle<Tag> handle) const;
+
+    // Dados quentes sem acessar o objeto do backend (0/nullptr para handles velhos)
+    size_t getBufferSize(BufferHandle handle) const;
+    const TextureDesc* getTextureDesc(TextureHandle handle) const;
+
+    // Atualização com validação de handle e de limites
+    bool updateBuffer(BufferHandle handle, const void* data, size_t bytes, size_t dstOffset = 0);
+
+    bool destroy(BufferHandle handle);
+    bool destroy(TextureHandle handle);
+    bool destroy(SamplerHandle handle);
+    bool destroy(ShaderModuleHandle handle);
+    bool destroy(GraphicsPipelineHandle handle);
+    bool destroy(ComputePipelineHandle handle);
+    bool destroy(DescriptorSetHandle handle);
+
+    // Destroi tudo; handles emitidos antes passam a ser inválidos
+    void clear();
+
+    ResourceRegistryStats getStats() const;
+
+private:
+    using BufferPool = HandlePool<BufferHandle, std::unique_ptr<IBuffer>, size_t, BufferUsage>;
+    using TexturePool = HandlePool<TextureHandle, std::unique_ptr<ITexture>, TextureDesc>;
+    using SamplerPool = HandlePool<SamplerHandle, std::unique_ptr<ISampler>>;
+    using ShaderModulePool = HandlePool<ShaderModuleHandle, std::unique_ptr<IShaderModule>, ShaderStage>;
+    using GraphicsPipelinePool = HandlePool<GraphicsPipelineHandle, std::unique_ptr<IGraphicsPipeline>>;
+    using ComputePipelinePool = HandlePool<ComputePipelineHandle, std::unique_ptr<IComputePipeline>>;
+    using DescriptorSetPool = HandlePool<DescriptorSetHandle, std::unique_ptr<IDescriptorSet>>;
+
+    void reportStale(const char* kind, uint32_t handleValue) const;
+
+    IDevice& device_;
+    BufferPool buffers_;
+    TexturePool textures_;
+    SamplerPool samplers_;
+    ShaderModulePool shaderModules_;
+    GraphicsPipelinePool graphicsPipelines_;
+    ComputePipelinePool computePipelines_;
+    DescriptorSetPool descriptorSets_;
+    mutable uint64_t staleAccessCount_{0};
+};
+
+template <typename Tag>
+bool ResourceRegistry::isValid(Handle<Tag> handle) const {
+    if constexpr (std::is_same_v<Handle<Tag>, BufferHandle>) return buffers_.isValid(handle);
+    else if constexpr (std::is_same_v<Handle<Tag>, TextureHandle>) return textures_.isValid(handle);
+    else if constexpr (std::is_same_v<Handle<Tag>, SamplerHandle>) return samplers_.isValid(handle);
+    else if constexpr (std::is_same_v<Handle<Tag>, ShaderModuleHandle>) return shaderModules_.isValid(handle);
+    else if constexpr (std::is_same_v<Handle<Tag>, GraphicsPipelineHandle>) return graphicsPipelines_.isValid(handle);
+    else if constexpr (std::is_same_v<Handle<Tag>, ComputePipelineHandle>) return computePipelines_.isValid(handle);
+    else return descriptorSets_.isValid(handle);
+}
+
+}
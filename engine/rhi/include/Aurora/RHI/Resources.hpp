@@ -1,5 +1,6 @@
 #pragma once
 
+#include <bit>
 #include <cstdint>
 #include <vector>
 #include <memory>
@@ -7,11 +8,31 @@
 
 namespace Aurora::RHI {
 
-enum class ShaderStage : uint8_t { Vertex, Fragment };
+enum class ShaderStage : uint8_t { Vertex, Fragment, Compute };
+
+// Constante de especialização (layout(constant_id = N) no GLSL compilado para SPIR-V).
+// No fallback GLSL vira "#define AURORA_SPEC_<id> <valor>" logo após o #version.
+struct SpecializationConstant {
+    enum class Type : uint8_t { Bool, Int, UInt, Float };
+    uint32_t id{0};
+    Type type{Type::UInt};
+    uint32_t bits{0}; // valor reinterpretado em 32 bits
+
+    static SpecializationConstant fromBool(uint32_t id, bool v) { return {id, Type::Bool, v ? 1u : 0u}; }
+    static SpecializationConstant fromInt(uint32_t id, int32_t v) { return {id, Type::Int, std::bit_cast<uint32_t>(v)}; }
+    static SpecializationConstant fromUInt(uint32_t id, uint32_t v) { return {id, Type::UInt, v}; }
+    static SpecializationConstant fromFloat(uint32_t id, float v) { return {id, Type::Float, std::bit_cast<uint32_t>(v)}; }
+    bool operator==(const SpecializationConstant&) const = default;
+};
 
 struct ShaderModuleDesc {
     ShaderStage stage{ShaderStage::Vertex};
     const char* source{nullptr};
+    // SPIR-V opcional (obrigatório no Vulkan); tamanho em bytes. No OpenGL é usado quando
+    // Capabilities::supportsSpirv, com fallback para source se o driver rejeitar o módulo.
+    const uint32_t* spirv{nullptr};
+    size_t spirvSize{0};
+    std::vector<SpecializationConstant> specializationConstants;
 };
 
 class IShaderModule {
@@ -20,7 +41,11 @@ public:
     virtual ShaderStage getStage() const = 0;
 };
 
-enum class BufferUsage : uint8_t { Vertex, Index, Uniform };
+// Storage: SSBO lido/escrito por compute (também aceito como vertex/index e argumentos de dispatch indireto)
+enum class BufferUsage : uint8_t { Vertex, Index, Uniform, Storage };
+// Frequência de reescrita pela CPU. Stream: conteúdo inteiro reescrito a cada frame (vértices de sprites,
+// instâncias, debug draw); Dynamic: atualizações parciais ocasionais. Ignorado para Storage.
+enum class BufferUpdate : uint8_t { Static, Dynamic, Stream };
 enum class IndexType : uint8_t { Uint16, Uint32 };
 
 class IBuffer {
@@ -39,6 +64,9 @@ struct VertexAttribute {
 struct VertexLayoutDesc {
     uint32_t stride{0};
     std::vector<VertexAttribute> attributes;
+    // Atributos por instância: lidos do buffer de setInstanceBuffer, avançam uma vez por instância
+    uint32_t instanceStride{0};
+    std::vector<VertexAttribute> instanceAttributes;
 };
 
 // Textures e Samplers
@@ -50,8 +78,36 @@ struct TextureDesc {
     TextureFormat format{TextureFormat::RGBA8};
     TextureUsage usage{TextureUsage::Sampled};
     uint32_t mipLevels{1};
+
+    bool operator==(const TextureDesc&) const = default;
 };
 
+// Bytes por pixel do formato (estimativa; depth24stencil8 conta como 4)
+inline uint32_t getTextureFormatSize(TextureFormat format) {
+    switch (format) {
+        case TextureFormat::RGBA8: return 4;
+        case TextureFormat::RGB8: return 3;
+        case TextureFormat::R8: return 1;
+        case TextureFormat::RGBA16F: return 8;
+        case TextureFormat::R16F: return 2;
+        case TextureFormat::Depth24Stencil8: return 4;
+        case TextureFormat::Depth32F: return 4;
+    }
+    return 4;
+}
+
+// Memória estimada da textura incluindo a cadeia de mips
+inline uint64_t estimateTextureBytes(const TextureDesc& desc) {
+    uint64_t total = 0;
+    uint32_t w = desc.width, h = desc.height;
+    for (uint32_t mip = 0; mip < (desc.mipLevels ? desc.mipLevels : 1); ++mip) {
+        total += static_cast<uint64_t>(w) * h * getTextureFormatSize(desc.format);
+        w = w > 1 ? w / 2 : 1;
+        h = h > 1 ? h / 2 : 1;
+    }
+    return total;
+}
+
 class ITexture {
 public:
     virtual ~ITexture() = default;
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "Aurora/RHI/RHI.hpp"
+
+#include <memory>
+
+// Despacho estático opcional: com AURORA_RHI_STATIC_BACKEND=OpenGL|Vulkan|Null no CMake só um backend existe
+// e Backend::Device/CommandList são as classes final concretas. Chamadas feitas por esses tipos não passam
+// pela vtable e os métodos inline (ex.: gravação do GLCommandList) são expandidos no chamador.
+// Sem a opção os aliases são IDevice/ICommandList e o mesmo código funciona com qualquer backend.
+#if defined(AURORA_RHI_STATIC_BACKEND_OPENGL)
+#include "OpenGL/GLDevice.hpp"
+#include "OpenGL/GLCommandList.hpp"
+#elif defined(AURORA_RHI_STATIC_BACKEND_VULKAN)
+#include "Vulkan/VulkanDevice.hpp"
+#include "Vulkan/VulkanCommandList.hpp"
+#elif defined(AURORA_RHI_STATIC_BACKEND_NULL)
+#include "Null/NullDevice.hpp"
+#endif
+
+namespace Aurora::RHI::Backend {
+
+#if defined(AURORA_RHI_STATIC_BACKEND_OPENGL)
+using Device = GLDevice;
+using CommandList = GLCommandList;
+inline constexpr BackendType kType = BackendType::OpenGL;
+#elif defined(AURORA_RHI_STATIC_BACKEND_VULKAN)
+using Device = VulkanDevice;
+using CommandList = VulkanCommandList;
+inline constexpr BackendType kType = BackendType::Vulkan;
+#elif defined(AURORA_RHI_STATIC_BACKEND_NULL)
+using Device = NullDevice;
+using CommandList = NullCommandList;
+inline constexpr BackendType kType = BackendType::Null;
+#else
+using Device = IDevice;
+using CommandList = ICommandList;
+#endif
+
+#ifdef AURORA_RHI_STATIC_BACKEND
+inline constexpr bool kStatic = true;
+#else
+inline constexpr bool kStatic = false;
+#endif
+
+// Com backend estático todo device/command list vem do único backend compilado, então o downcast é seguro
+inline Device& cast(IDevice& device) { return static_cast<Device&>(device); }
+inline CommandList& cast(ICommandList& list) { return static_cast<CommandList&>(list); }
+
+// Como RHI::createDevice, mas devolvendo o tipo concreto. Com backend estático um tipo diferente de kType
+// é ignorado (warning) e falha de inicialização retorna nullptr em vez de cair no NullDevice.
+std::unique_ptr<Device> createDevice(BackendType type);
+
+}
@@ -0,0 +1,127 @@
+#include "CommandBundle.hpp"
+#include "Aurora/Core/Log.hpp"
+
+#include <algorithm>
+
+namespace Aurora::RHI {
+
+void RecordedCommandBundle::begin() {
+    recorded_.clear();
+    ops_.clear();
+    dynamicOffsets_.clear();
+    recordedCount_ = 0;
+    recording_ = true;
+    valid_ = false;
+}
+
+void RecordedCommandBundle::record(Op::Kind kind, void* object) {
+    if (!recording_) { Core::log(Core::LogLevel::Warn, "CommandBundle: comando fora de begin/end"); return; }
+    Op op{};
+    op.kind = kind;
+    op.object = object;
+    recorded_.push_back(op);
+}
+
+void RecordedCommandBundle::bindDescriptorSet(IDescriptorSet* set, std::span<const uint32_t> dynamicOffsets) {
+    if (!recording_) { Core::log(Core::LogLevel::Warn, "CommandBundle: comando fora de begin/end"); return; }
+    Op op{};
+    op.kind = Op::Kind::DescriptorSet;
+    op.object = set;
+    op.first = static_cast<uint32_t>(dynamicOffsets_.size());
+    op.count = static_cast<uint32_t>(dynamicOffsets.size());
+    dynamicOffsets_.insert(dynamicOffsets_.end(), dynamicOffsets.begin(), dynamicOffsets.end());
+    recorded_.push_back(op);
+}
+
+bool RecordedCommandBundle::sameDescriptorBinding(const Op* a, const Op* b) const {
+    if (!a || !b) return a == b;
+    if (a->object != b->object || a->count != b->count) return false;
+    auto oa = getDynamicOffsets(*a);
+    auto ob = getDynamicOffsets(*b);
+    return std::equal(oa.begin(), oa.end(), ob.begin());
+}
+
+void RecordedCommandBundle::draw(uint32_t vertexCount, uint32_t firstVertex) {
+    if (!recording_) { Core::log(Core::LogLevel::Warn, "CommandBundle: comando fora de begin/end"); return; }
+    Op op{};
+    op.kind = Op::Kind::Draw;
+    op.count = vertexCount;
+    op.first = firstVertex;
+    recorded_.push_back(op);
+}
+
+void RecordedCommandBundle::drawIndexed(uint32_t indexCount, uint32_t firstIndex, IndexType indexType) {
+    if (!recording_) { Core::log(Core::LogLevel::Warn, "CommandBundle: comando fora de begin/end"); return; }
+    Op op{};
+    op.kind = Op::Kind::DrawIndexed;
+    op.count = indexCount;
+    op.first = firstIndex;
+    op.indexType = indexType;
+    recorded_.push_back(op);
+}
+
+void RecordedCommandBundle::end() {
+    if (!recording_) return;
+    recording_ = false;
+    recordedCount_ = static_cast<uint32_t>(recorded_.size());
+    valid_ = true;
+
+    // Estado desejado (último bind gravado) vs. estado já emitido no stream compactado.
+    // Trocar de pipeline invalida VBO/IBO/set emitidos: no GL o VAO e os bindings de bloco são por programa.
+    // Sets são comparados junto com os offsets dinâmicos (mesmo set com outro offset não é redundante).
+    void* wantPipeline = nullptr; void* wantVB = nullptr; void* wantIB = nullptr; const Op* wantSet = nullptr;
+    void* hasPipeline = nullptr; void* hasVB = nullptr; void* hasIB = nullptr; const Op* hasSet = nullptr;
+    auto emit = [this](Op::Kind kind, void* object) { Op op{}; op.kind = kind; op.object = object; ops_.push_back(op); };
+
+    for (const Op& op : recorded_) {
+        switch (op.kind) {
+            case Op::Kind::Pipeline: wantPipeline = op.object; break;
+            case Op::Kind::VertexBuffer: wantVB = op.object; break;
+            case Op::Kind::IndexBuffer: wantIB = op.object; break;
+            case Op::Kind::DescriptorSet: wantSet = op.object ? &op : nullptr; break;
+            case Op::Kind::Draw:
+            case Op::Kind::DrawIndexed: {
+                if (op.count == 0) break; // draw vazio: descartado
+                if (!wantPipeline) {
+                    Core::log(Core::LogLevel::Error, "CommandBundle: draw sem pipeline");
+                    valid_ = false;
+                    break;
+                }
+                if (op.kind == Op::Kind::DrawIndexed && !wantIB) {
+                    Core::log(Core::LogLevel::Error, "CommandBundle: drawIndexed sem index buffer");
+                    valid_ = false;
+                    break;
+                }
+                if (wantPipeline != hasPipeline) {
+                    emit(Op::Kind::Pipeline, wantPipeline);
+                    hasPipeline = wantPipeline;
+                    hasVB = hasIB = nullptr;
+                    hasSet = nullptr;
+                }
+                if (wantVB && wantVB != hasVB) { emit(Op::Kind::VertexBuffer, wantVB); hasVB = wantVB; }
+                if (op.kind == Op::Kind::DrawIndexed && wantIB != hasIB) { emit(Op::Kind::IndexBuffer, wantIB); hasIB = wantIB; }
+                if (wantSet && !sameDescriptorBinding(wantSet, hasSet)) { ops_.push_back(*wantSet); hasSet = wantSet; }
+                ops_.push_back(op);
+                break;
+            }
+        }
+    }
+    recorded_.clear();
+    recorded_.shrink_to_fit();
+    if (!valid_) ops_.clear();
+}
+
+void RecordedCommandBundle::replay(ICommandList& cmd) const {
+    for (const Op& op : ops_) {
+        switch (op.kind) {
+            case Op::Kind::Pipeline: cmd.setGraphicsPipeline(static_cast<IGraphicsPipeline*>(op.object)); break;
+            case Op::Kind::VertexBuffer: cmd.setVertexBuffer(static_cast<IBuffer*>(op.object)); break;
+            case Op::Kind::IndexBuffer: cmd.setIndexBuffer(static_cast<IBuffer*>(op.object)); break;
+            case Op::Kind::DescriptorSet: cmd.bindDescriptorSet(static_cast<IDescriptorSet*>(op.object), getDynamicOffsets(op)); break;
+            case Op::Kind::Draw: cmd.draw(op.count, op.first); break;
+            case Op::Kind::DrawIndexed: cmd.drawIndexed(op.count, op.first, op.indexType); break;
+        }
+    }
+}
+
+}
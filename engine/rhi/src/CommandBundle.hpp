@@ -0,0 +1,52 @@
+#pragma once
+
+#include "Aurora/RHI/RHI.hpp"
+#include <vector>
+
+namespace Aurora::RHI {
+
+// Base comum dos bundles: grava comandos em CPU e, no end(), valida e compacta o stream removendo
+// binds redundantes (binds sem draw seguinte, repetições e binds sobrescritos antes do draw).
+// Backends especializam a execução (GL pré-resolve chamadas; Vulkan reproduz na command list).
+class RecordedCommandBundle : public ICommandBundle {
+public:
+    struct Op {
+        enum class Kind : uint8_t { Pipeline, VertexBuffer, IndexBuffer, DescriptorSet, Draw, DrawIndexed };
+        Kind kind{Kind::Draw};
+        void* object{nullptr};
+        uint32_t count{0};      // draws: vértices/índices; DescriptorSet: nº de offsets dinâmicos
+        uint32_t first{0};      // draws: primeiro vértice/índice; DescriptorSet: início em dynamicOffsets_
+        IndexType indexType{IndexType::Uint32};
+    };
+
+    void begin() override;
+    void end() override;
+    void setGraphicsPipeline(IGraphicsPipeline* pipeline) override { record(Op::Kind::Pipeline, pipeline); }
+    void setVertexBuffer(IBuffer* buffer) override { record(Op::Kind::VertexBuffer, buffer); }
+    void setIndexBuffer(IBuffer* buffer) override { record(Op::Kind::IndexBuffer, buffer); }
+    void bindDescriptorSet(IDescriptorSet* set, std::span<const uint32_t> dynamicOffsets) override;
+    void draw(uint32_t vertexCount, uint32_t firstVertex) override;
+    void drawIndexed(uint32_t indexCount, uint32_t firstIndex, IndexType indexType) override;
+    bool isValid() const override { return valid_ && !recording_; }
+
+    // Stream compactado (válido após end())
+    const std::vector<Op>& ops() const { return ops_; }
+    uint32_t getRecordedCount() const { return recordedCount_; }
+    std::span<const uint32_t> getDynamicOffsets(const Op& op) const { return {dynamicOffsets_.data() + op.first, op.count}; }
+
+    // Reproduz o stream compactado numa command list (backends sem execução nativa)
+    void replay(ICommandList& cmd) const;
+
+private:
+    void record(Op::Kind kind, void* object);
+    bool sameDescriptorBinding(const Op* a, const Op* b) const;
+
+    std::vector<Op> recorded_{};
+    std::vector<Op> ops_{};
+    std::vector<uint32_t> dynamicOffsets_{};
+    uint32_t recordedCount_{0};
+    bool recording_{false};
+    bool valid_{false};
+};
+
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "Aurora/RHI/Resources.hpp"
+#include "Aurora/Core/MemoryTracking.hpp"
+
+namespace Aurora::RHI {
+
+// Estimativas de memória de GPU para o rastreamento de memória do core: os backends registram na criação
+// e descontam no destrutor do recurso, com o mesmo tamanho pedido (sem alinhamento nem padding do driver)
+inline Core::GpuMemoryKind getGpuMemoryKind(const TextureDesc& desc) {
+    return (desc.usage == TextureUsage::RenderTarget || desc.usage == TextureUsage::DepthStencil)
+        ? Core::GpuMemoryKind::RenderTarget : Core::GpuMemoryKind::Texture;
+}
+
+inline void trackBufferMemory(size_t bytes) { Core::trackGpuAllocation(Core::GpuMemoryKind::Buffer, bytes); }
+inline void untrackBufferMemory(size_t bytes) { Core::trackGpuFree(Core::GpuMemoryKind::Buffer, bytes); }
+inline void trackTextureMemory(const TextureDesc& desc) { Core::trackGpuAllocation(getGpuMemoryKind(desc), estimateTextureBytes(desc)); }
+inline void untrackTextureMemory(const TextureDesc& desc) { Core::trackGpuFree(getGpuMemoryKind(desc), estimateTextureBytes(desc)); }
+
+}
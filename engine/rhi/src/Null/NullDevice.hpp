@@ -4,30 +4,66 @@
 
 namespace Aurora::RHI {
 
+// Grava nada: permite exercitar o front end (RenderGraph, benchmarks) sem GPU
+class NullCommandList final : public ICommandList {
+public:
+    void begin() override {}
+    void end() override {}
+    void beginRenderPass(IRenderPass*, ISwapchain*) override {}
+    void endRenderPass() override {}
+    void setGraphicsPipeline(IGraphicsPipeline*) override {}
+    void setVertexBuffer(IBuffer*) override {}
+    void setIndexBuffer(IBuffer*) override {}
+    void bindDescriptorSet(IDescriptorSet*, std::span<const uint32_t> = {}) override {}
+    void draw(uint32_t, uint32_t) override {}
+    void drawIndexed(uint32_t, uint32_t, IndexType) override {}
+    void setInstanceBuffer(IBuffer*) override {}
+    void drawInstanced(uint32_t, uint32_t, uint32_t, uint32_t) override {}
+    void drawIndexedInstanced(uint32_t, uint32_t, IndexType, uint32_t, uint32_t) override {}
+    void setComputePipeline(IComputePipeline*) override {}
+    void dispatch(uint32_t, uint32_t, uint32_t) override {}
+    void dispatchIndirect(IBuffer*, size_t) override {}
+    void memoryBarrier(uint32_t) override {}
+    void executeBundle(ICommandBundle*) override {}
+    void setDebugWireframe(bool) override {}
+};
+
 class NullDevice final : public IDevice {
 public:
     const char* getName() const override { return "NullDevice"; }
     void beginFrame() override {}
     void endFrame() override {}
+    float getGpuFrameTimeMs() const override { return 0.0f; }
+    uint32_t getFramesInFlight() const override { return 1; }
+    uint32_t getFrameSlot() const override { return 0; }
     std::unique_ptr<ISwapchain> createSwapchain(const SwapchainDesc&) override { return nullptr; }
     std::unique_ptr<IRenderPass> createRenderPass(const RenderPassDesc&) override { return nullptr; }
     void beginRenderPass(IRenderPass*, ISwapchain*) override {}
     void endRenderPass() override {}
     std::unique_ptr<IShaderModule> createShaderModule(const ShaderModuleDesc&) override { return nullptr; }
-    std::unique_ptr<IBuffer> createBuffer(const void*, size_t, BufferUsage) override { return nullptr; }
+    std::unique_ptr<IBuffer> createBuffer(const void*, size_t, BufferUsage, BufferUpdate = BufferUpdate::Static) override { return nullptr; }
     std::unique_ptr<IGraphicsPipeline> createGraphicsPipeline(const GraphicsPipelineDesc&) override { return nullptr; }
+    std::unique_ptr<IComputePipeline> createComputePipeline(const ComputePipelineDesc&) override { return nullptr; }
     std::unique_ptr<IDescriptorSet> createDescriptorSet(const DescriptorSetDesc&) override { return nullptr; }
-    void updateBuffer(IBuffer*, const void*, size_t, size_t) override {}
+    void updateBuffer(IBuffer*, const void*, size_t, size_t = 0) override {}
     std::unique_ptr<ITexture> createTexture(const TextureDesc&, const void*) override { return nullptr; }
     std::unique_ptr<ISampler> createSampler(const SamplerDesc&) override { return nullptr; }
     void setGraphicsPipeline(IGraphicsPipeline*) override {}
     void setVertexBuffer(IBuffer*) override {}
     void setIndexBuffer(IBuffer*) override {}
-    void bindDescriptorSet(IDescriptorSet*) override {}
+    void bindDescriptorSet(IDescriptorSet*, std::span<const uint32_t> = {}) override {}
     void draw(uint32_t, uint32_t) override {}
     void drawIndexed(uint32_t, uint32_t, IndexType) override {}
+    void setInstanceBuffer(IBuffer*) override {}
+    void drawInstanced(uint32_t, uint32_t, uint32_t, uint32_t) override {}
+    void drawIndexedInstanced(uint32_t, uint32_t, IndexType, uint32_t, uint32_t) override {}
+    void setComputePipeline(IComputePipeline*) override {}
+    void dispatch(uint32_t, uint32_t, uint32_t) override {}
+    void dispatchIndirect(IBuffer*, size_t) override {}
+    void memoryBarrier(uint32_t) override {}
     void setDebugWireframe(bool) override {}
-    std::unique_ptr<ICommandList> createCommandList() override { return nullptr; }
+    std::unique_ptr<ICommandList> createCommandList() override { return std::make_unique<NullCommandList>(); }
+    std::unique_ptr<ICommandBundle> createCommandBundle() override { return nullptr; }
     void submit(ICommandList*) override {}
     Capabilities getCapabilities() const override { return {}; }
 };
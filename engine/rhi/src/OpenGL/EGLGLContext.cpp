@@ -0,0 +1,175 @@
+#include "EGLGLContext.hpp"
+#ifdef AURORA_RHI_HAS_EGL
+
+#include "Aurora/Core/Log.hpp"
+#include <glad/glad.h>
+#include "GLState.hpp"
+
+// Evita que eglplatform.h puxe Xlib (macros como None/Bool/Status)
+#ifndef EGL_NO_X11
+#define EGL_NO_X11
+#endif
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+
+#include <cstring>
+#include <string>
+
+#ifndef GL_DEBUG_OUTPUT
+#define GL_DEBUG_OUTPUT 0x92E0
+#endif
+#ifndef GL_DEBUG_SEVERITY_NOTIFICATION
+#define GL_DEBUG_SEVERITY_NOTIFICATION 0x826B
+#endif
+
+namespace Aurora::RHI {
+
+static void APIENTRY eglGlDebugCallback(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar* message, const void* user) {
+    (void)source; (void)type; (void)id; (void)length; (void)user;
+    if (severity == GL_DEBUG_SEVERITY_NOTIFICATION) return; // ignore spam
+    Core::log(Core::LogLevel::Warn, std::string("GL Debug: ") + message);
+}
+
+static bool hasExtension(const char* list, const char* name) {
+    if (!list) return false;
+    const size_t len = std::strlen(name);
+    for (const char* p = std::strstr(list, name); p; p = std::strstr(p + len, name)) {
+        const bool startOk = (p == list) || p[-1] == ' ';
+        const bool endOk = p[len] == ' ' || p[len] == '\0';
+        if (startOk && endOk) return true;
+    }
+    return false;
+}
+
+// Headless: surfaceless da Mesa (llvmpipe/render nodes) > primeiro EGL device > display padrão
+static EGLDisplay openHeadlessDisplay() {
+    const char* clientExts = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+    if (!hasExtension(clientExts, "EGL_EXT_platform_base")) return eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    auto getPlatformDisplay = reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>(eglGetProcAddress("eglGetPlatformDisplayEXT"));
+    if (!getPlatformDisplay) return eglGetDisplay(EGL_DEFAULT_DISPLAY);
+
+    if (hasExtension(clientExts, "EGL_MESA_platform_surfaceless")) {
+        EGLDisplay dpy = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+        if (dpy != EGL_NO_DISPLAY) return dpy;
+    }
+    if (hasExtension(clientExts, "EGL_EXT_platform_device")) {
+        auto queryDevices = reinterpret_cast<PFNEGLQUERYDEVICESEXTPROC>(eglGetProcAddress("eglQueryDevicesEXT"));
+        EGLDeviceEXT device = nullptr;
+        EGLint count = 0;
+        if (queryDevices && queryDevices(1, &device, &count) && count > 0) {
+            EGLDisplay dpy = getPlatformDisplay(EGL_PLATFORM_DEVICE_EXT, device, nullptr);
+            if (dpy != EGL_NO_DISPLAY) return dpy;
+        }
+    }
+    return eglGetDisplay(EGL_DEFAULT_DISPLAY);
+}
+
+bool EGLGLContext::initialize(void* nativeWindow, bool vsync) {
+    headless = (nativeWindow == nullptr);
+    EGLDisplay dpy = headless ? openHeadlessDisplay() : eglGetDisplay(EGL_DEFAULT_DISPLAY);
+    if (dpy == EGL_NO_DISPLAY) { Core::log(Core::LogLevel::Error, "EGL: nenhum display disponível"); return false; }
+    EGLint major = 0, minor = 0;
+    if (!eglInitialize(dpy, &major, &minor)) { Core::log(Core::LogLevel::Error, "EGL: eglInitialize falhou"); return false; }
+    display = dpy;
+    if (!eglBindAPI(EGL_OPENGL_API)) { Core::log(Core::LogLevel::Error, "EGL: OpenGL desktop não suportado"); return false; }
+
+    const char* displayExts = eglQueryString(dpy, EGL_EXTENSIONS);
+    const bool surfaceless = headless && hasExtension(displayExts, "EGL_KHR_surfaceless_context");
+
+    // Config: janela, pbuffer (fallback headless) ou qualquer uma (surfaceless)
+    EGLint surfaceType = EGL_WINDOW_BIT;
+    if (headless) surfaceType = surfaceless ? 0 : EGL_PBUFFER_BIT;
+    const EGLint configAttribs[] = {
+        EGL_SURFACE_TYPE, surfaceType,
+        EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT,
+        EGL_RED_SIZE, 8, EGL_GREEN_SIZE, 8, EGL_BLUE_SIZE, 8, EGL_ALPHA_SIZE, 8,
+        EGL_DEPTH_SIZE, headless ? 0 : 24,
+        EGL_STENCIL_SIZE, headless ? 0 : 8,
+        EGL_NONE
+    };
+    EGLConfig config = nullptr;
+    EGLint numConfigs = 0;
+    if (!eglChooseConfig(dpy, configAttribs, &config, 1, &numConfigs) || numConfigs == 0) {
+        // Alguns drivers surfaceless só expõem configs sem bits de superfície: aceita config nula
+        if (!surfaceless || !hasExtension(displayExts, "EGL_KHR_no_config_context")) {
+            Core::log(Core::LogLevel::Error, "EGL: nenhuma config compatível");
+            return false;
+        }
+        config = EGL_NO_CONFIG_KHR;
+    }
+
+    // Tenta 4.5 core (como o WGL), depois 4.3 e 3.3
+    const EGLint versions[][2] = { {4, 5}, {4, 3}, {3, 3} };
+    EGLContext ctx = EGL_NO_CONTEXT;
+    for (const auto& v : versions) {
+        const EGLint ctxAttribs[] = {
+            EGL_CONTEXT_MAJOR_VERSION, v[0],
+            EGL_CONTEXT_MINOR_VERSION, v[1],
+            EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+#ifdef AURORA_DEBUG
+            EGL_CONTEXT_OPENGL_DEBUG, EGL_TRUE,
+#endif
+            EGL_NONE
+        };
+        ctx = eglCreateContext(dpy, config, EGL_NO_CONTEXT, ctxAttribs);
+        if (ctx != EGL_NO_CONTEXT) break;
+    }
+    if (ctx == EGL_NO_CONTEXT) { Core::log(Core::LogLevel::Error, "EGL: falha ao criar contexto OpenGL core"); return false; }
+    context = ctx;
+
+    EGLSurface surf = EGL_NO_SURFACE;
+    if (!headless) {
+        surf = eglCreateWindowSurface(dpy, config, reinterpret_cast<EGLNativeWindowType>(nativeWindow), nullptr);
+    } else if (!surfaceless) {
+        // Sem surfaceless_context: pbuffer 1x1 só para tornar o contexto corrente; o backbuffer real é um FBO
+        const EGLint pbufferAttribs[] = { EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE };
+        surf = eglCreatePbufferSurface(dpy, config, pbufferAttribs);
+    }
+    if (!surfaceless && surf == EGL_NO_SURFACE) { Core::log(Core::LogLevel::Error, "EGL: falha ao criar surface"); return false; }
+    surface = surf;
+
+    if (!eglMakeCurrent(dpy, surf, surf, ctx)) { Core::log(Core::LogLevel::Error, "EGL: eglMakeCurrent falhou"); return false; }
+
+    // Load GL functions
+    if (!gladLoadGLLoader(reinterpret_cast<GLADloadproc>(eglGetProcAddress))) {
+        Core::log(Core::LogLevel::Error, "gladLoadGLLoader falhou");
+        return false;
+    }
+    GLState::resetCache();
+
+    if (glDebugMessageCallback) {
+        glEnable(GL_DEBUG_OUTPUT);
+        glDebugMessageCallback(eglGlDebugCallback, nullptr);
+    }
+
+    const auto* renderer = reinterpret_cast<const char*>(glGetString(GL_RENDERER));
+    Core::log(Core::LogLevel::Info, std::string("EGL ") + std::to_string(major) + "." + std::to_string(minor)
+        + (headless ? (surfaceless ? " (surfaceless)" : " (pbuffer)") : "") + ": " + (renderer ? renderer : "?"));
+
+    setVsync(vsync);
+    return true;
+}
+
+void EGLGLContext::swapBuffers() {
+    // Offscreen não tem front buffer: apenas garante que o trabalho foi enviado
+    if (headless) { glFlush(); return; }
+    if (display && surface) eglSwapBuffers(static_cast<EGLDisplay>(display), static_cast<EGLSurface>(surface));
+}
+
+void EGLGLContext::shutdown() {
+    if (!display) return;
+    EGLDisplay dpy = static_cast<EGLDisplay>(display);
+    eglMakeCurrent(dpy, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+    if (surface) { eglDestroySurface(dpy, static_cast<EGLSurface>(surface)); surface = nullptr; }
+    if (context) { eglDestroyContext(dpy, static_cast<EGLContext>(context)); context = nullptr; }
+    // eglTerminate omitido: o display EGL é compartilhado pelo processo
+    display = nullptr;
+}
+
+void EGLGLContext::setVsync(bool enabled) {
+    if (display && surface && !headless) eglSwapInterval(static_cast<EGLDisplay>(display), enabled ? 1 : 0);
+}
+
+}
+
+#endif
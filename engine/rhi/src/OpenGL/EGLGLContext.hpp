@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstdint>
+
+#ifdef AURORA_RHI_HAS_EGL
+
+namespace Aurora::RHI {
+
+// Contexto OpenGL via EGL (Linux). Sem janela nativa cria um contexto headless: plataforma
+// surfaceless da Mesa (ou EGL device) + EGL_KHR_surfaceless_context; se indisponível, usa um pbuffer 1x1.
+// Handles EGL guardados como void* para não vazar headers EGL/X11 para o resto do backend.
+struct EGLGLContext {
+    void* display{nullptr};
+    void* context{nullptr};
+    void* surface{nullptr};  // EGL_NO_SURFACE no modo surfaceless
+    bool headless{false};
+
+    bool initialize(void* nativeWindow, bool vsync);
+    void swapBuffers();
+    void shutdown();
+    void setVsync(bool enabled);
+};
+
+}
+
+#endif
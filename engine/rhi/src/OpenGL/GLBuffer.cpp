@@ -1,10 +1,12 @@
 #include "GLBuffer.hpp"
-#include <glad/glad.h>
+#include "GLFrameSync.hpp"
+#include "../GpuMemoryTracking.hpp"
 
 namespace Aurora::RHI {
 
 GLBuffer::~GLBuffer() {
-    if (id_) glDeleteBuffers(1, &id_);
+    untrackBufferMemory(size_);
+    GLFrameSync::deferDelete(GLFrameSync::ObjectType::Buffer, id_);
 }
 
 }
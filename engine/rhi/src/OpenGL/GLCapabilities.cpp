@@ -10,6 +10,19 @@ Caps query() {
     // Glad expõe booleanos GLAD_GL_ARB_shading_language_420pack quando habilitado no generator.
     // Como fallback, marcar false e usar a versão como fonte de verdade.
     c.hasShadingLanguage420Pack = false;
+    c.hasInvalidateFramebuffer = GLAD_GL_VERSION_4_3 != 0 || GLAD_GL_ARB_invalidate_subdata != 0;
+    c.supportsCompute = GLAD_GL_VERSION_4_3 != 0
+        || (GLAD_GL_ARB_compute_shader != 0 && GLAD_GL_ARB_shader_storage_buffer_object != 0);
+    c.supportsSpirv = GLAD_GL_VERSION_4_6 != 0 || GLAD_GL_ARB_gl_spirv != 0;
+    c.supportsTimerQuery = GLAD_GL_VERSION_3_3 != 0 || GLAD_GL_ARB_timer_query != 0;
+    GLint uboAlignment = 0;
+    glGetIntegerv(0x8A34 /*GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT*/, &uboAlignment);
+    if (uboAlignment > 0) c.uniformBufferOffsetAlignment = static_cast<uint32_t>(uboAlignment);
+    if (c.supportsCompute) {
+        GLint ssboAlignment = 0;
+        glGetIntegerv(0x90DF /*GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT*/, &ssboAlignment);
+        if (ssboAlignment > 0) c.storageBufferOffsetAlignment = static_cast<uint32_t>(ssboAlignment);
+    }
     return c;
 }
 
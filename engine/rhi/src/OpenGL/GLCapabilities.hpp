@@ -1,10 +1,18 @@
 #pragma once
 
+#include <cstdint>
+
 namespace Aurora::RHI::GLCapabilities {
 
 struct Caps {
     bool supportsGLSL420{false};
     bool hasShadingLanguage420Pack{false};
+    uint32_t uniformBufferOffsetAlignment{256};
+    bool hasInvalidateFramebuffer{false}; // GL 4.3 / ARB_invalidate_subdata
+    bool supportsCompute{false};          // GL 4.3 / ARB_compute_shader + ARB_shader_storage_buffer_object
+    uint32_t storageBufferOffsetAlignment{256};
+    bool supportsSpirv{false};            // GL 4.6 / ARB_gl_spirv
+    bool supportsTimerQuery{false};       // GL 3.3 / ARB_timer_query
 };
 
 // Preenche capacidades usando o contexto GL atual (glad já carregado)
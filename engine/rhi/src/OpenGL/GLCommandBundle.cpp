@@ -0,0 +1,127 @@
+#include "GLCommandBundle.hpp"
+#include "GLDevice.hpp"
+#include "GLBuffer.hpp"
+#include "GLGraphicsPipeline.hpp"
+#include "GLDescriptorSet.hpp"
+#include "GLTexture.hpp"
+#include "GLSampler.hpp"
+#include "GLConversions.hpp"
+#include "Aurora/Core/Log.hpp"
+
+namespace Aurora::RHI {
+
+void GLCommandBundle::resolve(GLDevice& device) {
+    resolvedOps_.clear();
+    lastPipeline_ = nullptr;
+    lastVertexBuffer_ = nullptr;
+    lastIndexBuffer_ = nullptr;
+
+    using Kind = ResolvedOp::Kind;
+    for (const auto& op : ops()) {
+        switch (op.kind) {
+            case Op::Kind::Pipeline: {
+                lastPipeline_ = static_cast<GLGraphicsPipeline*>(op.object);
+                ResolvedOp r{};
+                r.kind = Kind::Pipeline;
+                r.pipeline = lastPipeline_;
+                r.program = lastPipeline_->program_;
+                r.id = lastPipeline_->vao_;
+                resolvedOps_.push_back(r);
+                break;
+            }
+            case Op::Kind::VertexBuffer: {
+                lastVertexBuffer_ = static_cast<GLBuffer*>(op.object);
+                ResolvedOp r{};
+                r.kind = Kind::VertexBuffer;
+                r.pipeline = lastPipeline_;
+                r.id = lastVertexBuffer_->id_;
+                resolvedOps_.push_back(r);
+                break;
+            }
+            case Op::Kind::IndexBuffer: {
+                lastIndexBuffer_ = static_cast<GLBuffer*>(op.object);
+                ResolvedOp r{};
+                r.kind = Kind::IndexBuffer;
+                r.id = lastIndexBuffer_->id_;
+                resolvedOps_.push_back(r);
+                break;
+            }
+            case Op::Kind::DescriptorSet: {
+                // Expande o set em binds individuais com índices de bloco/locations já consultados
+                const auto* set = static_cast<GLDescriptorSet*>(op.object);
+                const unsigned int program = lastPipeline_ ? lastPipeline_->program_ : 0;
+                const auto dynamicOffsets = getDynamicOffsets(op);
+                if (dynamicOffsets.size() != set->dynamicCount) {
+                    Core::log(Core::LogLevel::Error, "CommandBundle: número de offsets dinâmicos incompatível com o set");
+                    continue;
+                }
+                for (size_t i = 0; i < set->desc.uniformBuffers.size(); ++i) {
+                    const auto& ub = set->desc.uniformBuffers[i];
+                    const auto* buf = static_cast<GLBuffer*>(ub.buffer);
+                    ResolvedOp r{};
+                    r.kind = Kind::UniformBuffer;
+                    r.program = program;
+                    r.id = buf->id_;
+                    r.byteOffset = set->getUniformOffset(i, dynamicOffsets);
+                    if (r.byteOffset || ub.size) r.rangeSize = ub.size ? ub.size : buf->getSize() - r.byteOffset;
+                    r.binding = ub.binding;
+                    if (program) r.location = device.getUniformBlockIndex(program, ub.blockName ? ub.blockName : "Globals");
+                    resolvedOps_.push_back(r);
+                }
+                for (const auto& st : set->desc.sampledTextures) {
+                    if (!st.texture || !st.sampler) continue;
+                    ResolvedOp r{};
+                    r.kind = Kind::SampledTexture;
+                    r.program = program;
+                    r.id = static_cast<GLTexture*>(st.texture)->id_;
+                    r.sampler = static_cast<GLSampler*>(st.sampler)->id_;
+                    r.binding = st.binding;
+                    if (program && st.uniformName) r.location = device.getUniformLocation(program, st.uniformName);
+                    resolvedOps_.push_back(r);
+                }
+                for (const auto& sb : set->desc.storageBuffers) {
+                    const auto* buf = static_cast<GLBuffer*>(sb.buffer);
+                    ResolvedOp r{};
+                    r.kind = Kind::StorageBuffer;
+                    r.id = buf->id_;
+                    r.binding = sb.binding;
+                    r.byteOffset = sb.offset;
+                    if (sb.offset || sb.size) r.rangeSize = sb.size ? sb.size : buf->getSize() - sb.offset;
+                    resolvedOps_.push_back(r);
+                }
+                for (const auto& st : set->desc.storageTextures) {
+                    ResolvedOp r{};
+                    r.kind = Kind::StorageImage;
+                    r.id = static_cast<GLTexture*>(st.texture)->id_;
+                    r.binding = st.binding;
+                    r.first = st.mipLevel;
+                    r.glType = static_cast<unsigned int>(GLConversions::toGLImageAccess(st.access));
+                    r.format = static_cast<unsigned int>(GLConversions::toGLImageFormat(st.texture->getDesc().format));
+                    resolvedOps_.push_back(r);
+                }
+                break;
+            }
+            case Op::Kind::Draw: {
+                ResolvedOp r{};
+                r.kind = Kind::DrawArrays;
+                r.count = op.count;
+                r.first = op.first;
+                resolvedOps_.push_back(r);
+                break;
+            }
+            case Op::Kind::DrawIndexed: {
+                const bool u16 = (op.indexType == IndexType::Uint16);
+                ResolvedOp r{};
+                r.kind = Kind::DrawElements;
+                r.count = op.count;
+                r.glType = u16 ? 0x1403 /*GL_UNSIGNED_SHORT*/ : 0x1405 /*GL_UNSIGNED_INT*/;
+                r.byteOffset = static_cast<uintptr_t>(op.first) * (u16 ? 2u : 4u);
+                resolvedOps_.push_back(r);
+                break;
+            }
+        }
+    }
+    resolved_ = true;
+}
+
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "../CommandBundle.hpp"
+#include <cstdint>
+#include <vector>
+
+namespace Aurora::RHI {
+
+class GLDevice;
+class GLGraphicsPipeline;
+class GLBuffer;
+
+// Bundle GL: o stream compactado é pré-resolvido (na primeira execução, na thread do contexto) em
+// chamadas GL com ids, índices de bloco/locations e offsets já calculados.
+class GLCommandBundle final : public RecordedCommandBundle {
+public:
+    void begin() override { RecordedCommandBundle::begin(); resolvedOps_.clear(); resolved_ = false; }
+
+private:
+    friend class GLDevice;
+
+    struct ResolvedOp {
+        enum class Kind : uint8_t { Pipeline, VertexBuffer, IndexBuffer, UniformBuffer, SampledTexture, StorageBuffer, StorageImage, DrawArrays, DrawElements };
+        Kind kind{Kind::DrawArrays};
+        const GLGraphicsPipeline* pipeline{nullptr}; // Pipeline/VertexBuffer (layout de atributos)
+        unsigned int program{0};
+        unsigned int id{0};        // buffer/textura
+        unsigned int sampler{0};
+        unsigned int binding{0};   // binding UBO ou unidade de textura
+        int location{-1};          // índice de bloco ou location do sampler
+        unsigned int glType{0};    // tipo de índice ou acesso da imagem
+        unsigned int format{0};    // formato da imagem de storage
+        uint32_t count{0};
+        uint32_t first{0};         // primeiro vértice ou mip da imagem
+        uintptr_t byteOffset{0};   // índices (DrawElements) ou início do range de UBO/SSBO
+        size_t rangeSize{0};       // UBO/SSBO: 0 = buffer inteiro
+    };
+
+    void resolve(GLDevice& device);
+
+    std::vector<ResolvedOp> resolvedOps_{};
+    bool resolved_{false};
+    GLGraphicsPipeline* lastPipeline_{nullptr};
+    GLBuffer* lastVertexBuffer_{nullptr};
+    GLBuffer* lastIndexBuffer_{nullptr};
+};
+
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "GLDevice.hpp"
+#include "Aurora/Core/Memory.hpp"
+
+#include <algorithm>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Aurora::RHI {
+
+// Gravação diferida: cada comando vira uma operação que o GLDevice::submit executa em ordem.
+// Métodos inline de propósito: com AURORA_RHI_STATIC_BACKEND=OpenGL (Aurora/RHI/StaticBackend.hpp)
+// o chamador enxerga o tipo final e a gravação é expandida sem passar pela vtable.
+// As closures ficam numa arena linear descartada no begin(): depois do primeiro frame, regravar a lista
+// não aloca (o vetor de operações e a arena mantêm a capacidade).
+class GLCommandList final : public ICommandList {
+public:
+    explicit GLCommandList(GLDevice& dev) : device_(dev) {}
+    void begin() override { operations_.clear(); arena_.reset(); recording_ = true; }
+    void end() override { recording_ = false; }
+    void beginRenderPass(IRenderPass* renderPass, ISwapchain* target) override {
+        record([this, renderPass, target]{ device_.beginRenderPass(renderPass, target); });
+    }
+    void endRenderPass() override { record([this]{ device_.endRenderPass(); }); }
+    void setGraphicsPipeline(IGraphicsPipeline* pipeline) override { record([this, pipeline]{ device_.setGraphicsPipeline(pipeline); }); }
+    void setVertexBuffer(IBuffer* buffer) override { record([this, buffer]{ device_.setVertexBuffer(buffer); }); }
+    void setIndexBuffer(IBuffer* buffer) override { record([this, buffer]{ device_.setIndexBuffer(buffer); }); }
+    void bindDescriptorSet(IDescriptorSet* set, std::span<const uint32_t> dynamicOffsets = {}) override {
+        uint32_t* offsets = nullptr;
+        if (!dynamicOffsets.empty()) {
+            offsets = arena_.allocateArray<uint32_t>(dynamicOffsets.size());
+            if (!offsets) return;
+            std::copy(dynamicOffsets.begin(), dynamicOffsets.end(), offsets);
+        }
+        const size_t count = dynamicOffsets.size();
+        record([this, set, offsets, count]{ device_.bindDescriptorSet(set, std::span<const uint32_t>(offsets, count)); });
+    }
+    void draw(uint32_t vertexCount, uint32_t firstVertex) override { record([this, vertexCount, firstVertex]{ device_.draw(vertexCount, firstVertex); }); }
+    void drawIndexed(uint32_t indexCount, uint32_t firstIndex, IndexType indexType) override { record([this, indexCount, firstIndex, indexType]{ device_.drawIndexed(indexCount, firstIndex, indexType); }); }
+    void setInstanceBuffer(IBuffer* buffer) override { record([this, buffer]{ device_.setInstanceBuffer(buffer); }); }
+    void drawInstanced(uint32_t vertexCount, uint32_t firstVertex, uint32_t instanceCount, uint32_t firstInstance) override {
+        record([this, vertexCount, firstVertex, instanceCount, firstInstance]{ device_.drawInstanced(vertexCount, firstVertex, instanceCount, firstInstance); });
+    }
+    void drawIndexedInstanced(uint32_t indexCount, uint32_t firstIndex, IndexType indexType, uint32_t instanceCount, uint32_t firstInstance) override {
+        record([this, indexCount, firstIndex, indexType, instanceCount, firstInstance]{ device_.drawIndexedInstanced(indexCount, firstIndex, indexType, instanceCount, firstInstance); });
+    }
+    void setComputePipeline(IComputePipeline* pipeline) override { record([this, pipeline]{ device_.setComputePipeline(pipeline); }); }
+    void dispatch(uint32_t groupsX, uint32_t groupsY, uint32_t groupsZ) override { record([this, groupsX, groupsY, groupsZ]{ device_.dispatch(groupsX, groupsY, groupsZ); }); }
+    void dispatchIndirect(IBuffer* buffer, size_t offset) override { record([this, buffer, offset]{ device_.dispatchIndirect(buffer, offset); }); }
+    void memoryBarrier(uint32_t barriers) override { record([this, barriers]{ device_.memoryBarrier(barriers); }); }
+    void executeBundle(ICommandBundle* bundle) override { record([this, bundle]{ device_.executeBundle(static_cast<GLCommandBundle*>(bundle)); }); }
+    void setDebugWireframe(bool enable) override { record([this, enable]{ device_.setDebugWireframe(enable); }); }
+private:
+    struct Operation {
+        void (*invoke)(const void* closure);
+        const void* closure;
+    };
+
+    // Copia a closure para a arena; nunca é destruída, então só capturas triviais (ponteiros, valores)
+    template <typename Fn>
+    void record(Fn&& fn) {
+        using Closure = std::decay_t<Fn>;
+        static_assert(std::is_trivially_destructible_v<Closure>, "GLCommandList: closure com captura não trivial");
+        void* storage = arena_.allocate(sizeof(Closure), alignof(Closure));
+        if (!storage) return;
+        const auto* closure = new (storage) Closure(std::forward<Fn>(fn));
+        operations_.push_back({[](const void* c) { (*static_cast<const Closure*>(c))(); }, closure});
+    }
+
+    GLDevice& device_;
+    std::vector<Operation> operations_{};
+    Core::LinearArena arena_{16 * 1024};
+    bool recording_{false};
+
+    friend class GLDevice;
+};
+
+}
@@ -0,0 +1,10 @@
+#include "GLComputePipeline.hpp"
+#include "GLFrameSync.hpp"
+
+namespace Aurora::RHI {
+
+GLComputePipeline::~GLComputePipeline() {
+    GLFrameSync::deferDelete(GLFrameSync::ObjectType::Program, program_);
+}
+
+}
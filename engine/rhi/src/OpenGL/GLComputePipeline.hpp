@@ -0,0 +1,14 @@
+#pragma once
+
+#include "Aurora/RHI/RHI.hpp"
+
+namespace Aurora::RHI {
+
+class GLComputePipeline final : public IComputePipeline {
+public:
+    explicit GLComputePipeline(unsigned int program) : program_(program) {}
+    ~GLComputePipeline() override;
+    unsigned int program_{0};
+};
+
+}
@@ -59,6 +59,38 @@ int toGLTextureType(TextureFormat fmt) {
     return 0x1401;
 }
 
+int toGLImageFormat(TextureFormat fmt) {
+    switch (fmt) {
+        case TextureFormat::RGBA8: return 0x8058; // GL_RGBA8
+        case TextureFormat::R8: return 0x8229; // GL_R8
+        case TextureFormat::RGBA16F: return 0x881A; // GL_RGBA16F
+        case TextureFormat::R16F: return 0x822D; // GL_R16F
+        case TextureFormat::RGB8:
+        case TextureFormat::Depth24Stencil8:
+        case TextureFormat::Depth32F:
+            return 0;
+    }
+    return 0;
+}
+
+int toGLImageAccess(StorageAccess access) {
+    switch (access) {
+        case StorageAccess::ReadOnly: return 0x88B8; // GL_READ_ONLY
+        case StorageAccess::WriteOnly: return 0x88B9; // GL_WRITE_ONLY
+        case StorageAccess::ReadWrite: return 0x88BA; // GL_READ_WRITE
+    }
+    return 0x88BA;
 }
 
+unsigned int toGLMemoryBarrierBits(uint32_t barriers) {
+    unsigned int bits = 0;
+    if (barriers & Barrier_StorageBuffer) bits |= 0x2000; // GL_SHADER_STORAGE_BARRIER_BIT
+    if (barriers & Barrier_StorageTexture) bits |= 0x20; // GL_SHADER_IMAGE_ACCESS_BARRIER_BIT
+    if (barriers & Barrier_VertexIndex) bits |= 0x1 | 0x2; // GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT | GL_ELEMENT_ARRAY_BARRIER_BIT
+    if (barriers & Barrier_Indirect) bits |= 0x40; // GL_COMMAND_BARRIER_BIT
+    if (barriers & Barrier_Uniform) bits |= 0x4; // GL_UNIFORM_BARRIER_BIT
+    if (barriers & Barrier_Sampled) bits |= 0x8; // GL_TEXTURE_FETCH_BARRIER_BIT
+    return bits;
+}
 
+}
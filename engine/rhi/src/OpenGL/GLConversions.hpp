@@ -9,6 +9,11 @@ int toGLTextureTarget(TextureUsage usage);
 int toGLTextureInternalFormat(TextureFormat fmt);
 int toGLTextureFormat(TextureFormat fmt);
 int toGLTextureType(TextureFormat fmt);
+// Formato de imagem para glBindImageTexture; 0 se o formato não pode ser usado como storage (RGB8, depth)
+int toGLImageFormat(TextureFormat fmt);
+int toGLImageAccess(StorageAccess access);
+// BarrierFlags -> bits de glMemoryBarrier
+unsigned int toGLMemoryBarrierBits(uint32_t barriers);
 
 }
 
@@ -2,14 +2,35 @@
 
 #include "Aurora/RHI/RHI.hpp"
 
+#include <algorithm>
+#include <vector>
+
 namespace Aurora::RHI {
 
 class GLDescriptorSet final : public IDescriptorSet {
 public:
-    explicit GLDescriptorSet(const DescriptorSetDesc& d) : desc(d) {}
+    explicit GLDescriptorSet(const DescriptorSetDesc& d) : desc(d), dynamicSlot(d.uniformBuffers.size(), -1) {
+        // Offsets dinâmicos são consumidos em ordem crescente de binding (mesma regra do Vulkan)
+        std::vector<size_t> dynamicIndices;
+        for (size_t i = 0; i < desc.uniformBuffers.size(); ++i) {
+            if (desc.uniformBuffers[i].dynamic) dynamicIndices.push_back(i);
+        }
+        std::stable_sort(dynamicIndices.begin(), dynamicIndices.end(), [this](size_t a, size_t b) {
+            return desc.uniformBuffers[a].binding < desc.uniformBuffers[b].binding;
+        });
+        for (size_t slot = 0; slot < dynamicIndices.size(); ++slot) dynamicSlot[dynamicIndices[slot]] = static_cast<int>(slot);
+        dynamicCount = static_cast<uint32_t>(dynamicIndices.size());
+    }
+
+    // Offset final do UBO i: offset estático + offset dinâmico correspondente (se houver)
+    size_t getUniformOffset(size_t i, std::span<const uint32_t> dynamicOffsets) const {
+        const int slot = dynamicSlot[i];
+        return desc.uniformBuffers[i].offset + (slot >= 0 ? dynamicOffsets[static_cast<size_t>(slot)] : 0);
+    }
+
     DescriptorSetDesc desc;
+    std::vector<int> dynamicSlot; // por UBO: índice em dynamicOffsets ou -1
+    uint32_t dynamicCount{0};
 };
 
 }
-
-
@@ -1,4 +1,5 @@
 #include "GLDevice.hpp"
+#include "GLCommandList.hpp"
 #include "Aurora/Core/Log.hpp"
 #include "GLState.hpp"
 #include "GLRenderPass.hpp"
@@ -6,13 +7,22 @@
 #include "GLShaderModule.hpp"
 #include "GLBuffer.hpp"
 #include "GLGraphicsPipeline.hpp"
+#include "GLComputePipeline.hpp"
 #include "GLDescriptorSet.hpp"
 #include "GLTexture.hpp"
 #include "GLSampler.hpp"
 #include "GLCapabilities.hpp"
+#include "GLConversions.hpp"
+#include "GLFrameSync.hpp"
+#include "../GpuMemoryTracking.hpp"
 
 #include <glad/glad.h>
 
+#include <algorithm>
+#include <bit>
+#include <cstdio>
+#include <cstring>
+
 namespace Aurora::RHI {
 
 #ifdef AURORA_DEBUG
@@ -39,20 +49,34 @@ std::unique_ptr<ISwapchain> GLDevice::createSwapchain(const SwapchainDesc& desc)
         Core::log(Core::LogLevel::Error, "Falha ao inicializar contexto WGL");
         return nullptr;
     }
+#elif defined(AURORA_RHI_HAS_EGL)
+    if (!sc->context_.initialize(desc.windowHandle, desc.vsync)) {
+        Core::log(Core::LogLevel::Error, "Falha ao inicializar contexto EGL");
+        return nullptr;
+    }
+    // Headless (surfaceless/pbuffer): renderiza num backbuffer FBO do tamanho pedido
+    if (sc->context_.headless && !sc->createOffscreenTargets()) {
+        return nullptr;
+    }
+#else
+    Core::log(Core::LogLevel::Error, "Nenhum contexto GL disponível nesta plataforma");
+    return nullptr;
+#endif
+    GLFrameSync::setFramesInFlight(desc.framesInFlight);
     // Detect capabilities após criação de contexto e carregamento do glad
     auto glcaps = GLCapabilities::query();
     caps_.supportsGLSL420 = glcaps.supportsGLSL420;
     caps_.hasShadingLanguage420Pack = glcaps.hasShadingLanguage420Pack;
-#endif
+    caps_.uniformBufferOffsetAlignment = glcaps.uniformBufferOffsetAlignment;
+    caps_.supportsCompute = glcaps.supportsCompute;
+    caps_.storageBufferOffsetAlignment = glcaps.storageBufferOffsetAlignment;
+    caps_.supportsSpirv = glcaps.supportsSpirv;
+    caps_.supportsGpuTiming = glcaps.supportsTimerQuery;
+    GLFrameSync::setGpuTimingEnabled(glcaps.supportsTimerQuery);
+    hasInvalidateFramebuffer_ = glcaps.hasInvalidateFramebuffer;
     return sc;
 }
 
-void GLSwapchain::present() {
-#ifdef _WIN32
-    context_.swapBuffers();
-#endif
-}
-
 // Define missing tokens for modern GL when using legacy headers
 #ifndef GL_LINK_STATUS
 #define GL_LINK_STATUS 0x8B82
@@ -92,29 +116,63 @@ void GLSwapchain::present() {
 #define GL_FRAMEBUFFER_COMPLETE 0x8CD5
 #endif
 
+static GLenum toGLPrimitiveMode(PrimitiveTopology topology) {
+    return topology == PrimitiveTopology::LineList ? GL_LINES : GL_TRIANGLES;
+}
+
+// Attachment GL de um depth/stencil
+static unsigned int depthAttachmentPoint(const RenderPassDesc::Attachment& a) {
+    auto* gltex = static_cast<GLTexture*>(a.texture);
+    return (gltex->getDesc().format == TextureFormat::Depth24Stencil8) ? GL_DEPTH_STENCIL_ATTACHMENT : GL_DEPTH_ATTACHMENT;
+}
+
+// Pontos de attachment de um pass (draw buffers, invalidação) na pilha, sem alocação por pass: cabe o
+// mínimo garantido de color attachments do GL (8) mais depth/stencil com folga; excedentes são ignorados
+struct AttachmentList {
+    static constexpr uint32_t kCapacity = 16;
+    unsigned int items[kCapacity];
+    uint32_t count{0};
+    void push_back(unsigned int attachment) { if (count < kCapacity) items[count++] = attachment; }
+    bool empty() const { return count == 0; }
+};
+
+// Attachments do backbuffer: o framebuffer padrão usa GL_COLOR/GL_DEPTH, o FBO offscreen usa os pontos de attachment
+static void backbufferAttachments(const RenderPassDesc& d, bool offscreen, bool forLoad, AttachmentList& out) {
+    const bool color = forLoad ? d.swapchainColorLoad == LoadAction::DontCare : d.swapchainColorStore == StoreAction::DontCare;
+    const bool depth = forLoad ? d.swapchainDepthLoad == LoadAction::DontCare : d.swapchainDepthStore == StoreAction::DontCare;
+    if (color) out.push_back(offscreen ? GL_COLOR_ATTACHMENT0 : 0x1800 /*GL_COLOR*/);
+    if (depth) {
+        if (offscreen) out.push_back(GL_DEPTH_STENCIL_ATTACHMENT);
+        else { out.push_back(0x1801 /*GL_DEPTH*/); out.push_back(0x1802 /*GL_STENCIL*/); }
+    }
+}
+
 void GLDevice::beginRenderPass(IRenderPass* renderPass, ISwapchain* target) {
     auto* rp = static_cast<GLRenderPass*>(renderPass);
+    const auto& d = rp->desc_;
 
     // Se attachments foram especificados, configuramos um FBO temporário (MVP)
-    bool useFBO = false;
     unsigned int viewportW = target ? target->getWidth() : 0;
     unsigned int viewportH = target ? target->getHeight() : 0;
+    const bool useFBO = !d.colorAttachments.empty() || d.depthAttachment.texture;
+    // Attachments cujo conteúdo anterior não interessa (LoadAction::DontCare)
+    AttachmentList discard;
 
-    if (!rp->desc_.colorAttachments.empty() || rp->desc_.depthAttachment.texture) {
+    if (useFBO) {
         glGenFramebuffers(1, &currentFBO_);
         glBindFramebuffer(GL_FRAMEBUFFER, currentFBO_);
         tempFBOCreated_ = true;
-        useFBO = true;
 
         // Attach colors
-        std::vector<unsigned int> drawBuffers;
-        drawBuffers.reserve(rp->desc_.colorAttachments.size());
-        for (size_t i = 0; i < rp->desc_.colorAttachments.size(); ++i) {
-            const auto& a = rp->desc_.colorAttachments[i];
+        AttachmentList drawBuffers;
+        for (size_t i = 0; i < d.colorAttachments.size(); ++i) {
+            const auto& a = d.colorAttachments[i];
             if (!a.texture) continue;
             auto* gltex = static_cast<GLTexture*>(a.texture);
-            glFramebufferTexture2D(GL_FRAMEBUFFER, static_cast<unsigned int>(GL_COLOR_ATTACHMENT0 + i), 0x0DE1 /*GL_TEXTURE_2D*/, gltex->id_, static_cast<int>(a.mipLevel));
-            drawBuffers.push_back(static_cast<unsigned int>(GL_COLOR_ATTACHMENT0 + i));
+            const auto point = static_cast<unsigned int>(GL_COLOR_ATTACHMENT0 + i);
+            glFramebufferTexture2D(GL_FRAMEBUFFER, point, 0x0DE1 /*GL_TEXTURE_2D*/, gltex->id_, static_cast<int>(a.mipLevel));
+            drawBuffers.push_back(point);
+            if (a.load == LoadAction::DontCare) discard.push_back(point);
             if (viewportW == 0 || viewportH == 0) {
                 auto td = gltex->getDesc();
                 viewportW = td.width >> a.mipLevel; if (viewportW == 0) viewportW = 1;
@@ -122,21 +180,22 @@ void GLDevice::beginRenderPass(IRenderPass* renderPass, ISwapchain* target) {
             }
         }
         if (!drawBuffers.empty()) {
-            glDrawBuffers(static_cast<int>(drawBuffers.size()), reinterpret_cast<const unsigned int*>(drawBuffers.data()));
+            glDrawBuffers(static_cast<int>(drawBuffers.count), drawBuffers.items);
         } else {
             // depth-only: desabilita draw buffers
             glDrawBuffer(0);
         }
 
         // Attach depth
-        if (rp->desc_.depthAttachment.texture) {
-            auto* gltex = static_cast<GLTexture*>(rp->desc_.depthAttachment.texture);
+        if (d.depthAttachment.texture) {
+            auto* gltex = static_cast<GLTexture*>(d.depthAttachment.texture);
             auto td = gltex->getDesc();
-            unsigned int attachment = (td.format == TextureFormat::Depth24Stencil8) ? GL_DEPTH_STENCIL_ATTACHMENT : GL_DEPTH_ATTACHMENT;
-            glFramebufferTexture2D(GL_FRAMEBUFFER, attachment, 0x0DE1 /*GL_TEXTURE_2D*/, gltex->id_, static_cast<int>(rp->desc_.depthAttachment.mipLevel));
+            const unsigned int attachment = depthAttachmentPoint(d.depthAttachment);
+            glFramebufferTexture2D(GL_FRAMEBUFFER, attachment, 0x0DE1 /*GL_TEXTURE_2D*/, gltex->id_, static_cast<int>(d.depthAttachment.mipLevel));
+            if (d.depthAttachment.load == LoadAction::DontCare) discard.push_back(attachment);
             if (viewportW == 0 || viewportH == 0) {
-                viewportW = td.width >> rp->desc_.depthAttachment.mipLevel; if (viewportW == 0) viewportW = 1;
-                viewportH = td.height >> rp->desc_.depthAttachment.mipLevel; if (viewportH == 0) viewportH = 1;
+                viewportW = td.width >> d.depthAttachment.mipLevel; if (viewportW == 0) viewportW = 1;
+                viewportH = td.height >> d.depthAttachment.mipLevel; if (viewportH == 0) viewportH = 1;
             }
         }
 
@@ -145,7 +204,11 @@ void GLDevice::beginRenderPass(IRenderPass* renderPass, ISwapchain* target) {
             Core::log(Core::LogLevel::Error, "FBO incompleto");
         }
     } else {
-        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        // Backbuffer do swapchain (0 na janela; FBO próprio no modo offscreen)
+        const unsigned int fbo = target ? static_cast<GLSwapchain*>(target)->framebuffer() : 0;
+        glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+        activeOffscreenBackbuffer_ = fbo != 0;
+        backbufferAttachments(d, activeOffscreenBackbuffer_, true, discard);
     }
 
     // Viewport
@@ -154,29 +217,105 @@ void GLDevice::beginRenderPass(IRenderPass* renderPass, ISwapchain* target) {
         viewportH = target ? target->getHeight() : 0;
     }
     glViewport(0, 0, static_cast<GLsizei>(viewportW), static_cast<GLsizei>(viewportH));
-    // Sempre garantir estado de limpeza consistente: habilita teste de depth e mascara
-    glEnable(0x0B71 /*GL_DEPTH_TEST*/);
-    glDepthMask(1);
-    if (rp->desc_.clearColorEnabled || rp->desc_.clearDepthEnabled) {
-        GLbitfield mask = 0;
-        if (rp->desc_.clearColorEnabled) {
-            glClearColor(rp->desc_.clearColor[0], rp->desc_.clearColor[1], rp->desc_.clearColor[2], rp->desc_.clearColor[3]);
-            mask |= GL_COLOR_BUFFER_BIT;
+    activePass_ = rp;
+    activeWidth_ = viewportW;
+    activeHeight_ = viewportH;
+
+    // DontCare: o driver não precisa carregar o conteúdo (tilers pulam o load da memória)
+    if (!discard.empty() && hasInvalidateFramebuffer_) {
+        glInvalidateFramebuffer(GL_FRAMEBUFFER, static_cast<GLsizei>(discard.count), discard.items);
+    }
+
+    // Clears: glClear no backbuffer; por attachment (glClearBuffer*) no FBO, onde load actions podem diferir
+    if (useFBO) {
+        bool clearColor = false;
+        for (const auto& a : d.colorAttachments) clearColor |= (a.texture && a.load == LoadAction::Clear);
+        const bool clearDepth = d.depthAttachment.texture && d.depthAttachment.load == LoadAction::Clear;
+        GLState::enableClearWrites(clearColor, clearDepth);
+        GLint drawBuffer = 0;
+        for (const auto& a : d.colorAttachments) {
+            if (!a.texture) continue;
+            if (a.load == LoadAction::Clear) glClearBufferfv(0x1800 /*GL_COLOR*/, drawBuffer, d.clearColor);
+            ++drawBuffer;
         }
-        if (rp->desc_.clearDepthEnabled) {
-            glClearDepth(rp->desc_.clearDepth);
-            mask |= GL_DEPTH_BUFFER_BIT;
+        if (clearDepth) {
+            if (depthAttachmentPoint(d.depthAttachment) == GL_DEPTH_STENCIL_ATTACHMENT) glClearBufferfi(0x84F9 /*GL_DEPTH_STENCIL*/, 0, d.clearDepth, 0);
+            else glClearBufferfv(0x1801 /*GL_DEPTH*/, 0, &d.clearDepth);
+        }
+    } else {
+        const bool clearColor = d.swapchainColorLoad == LoadAction::Clear;
+        const bool clearDepth = d.swapchainDepthLoad == LoadAction::Clear;
+        if (clearColor || clearDepth) {
+            GLState::enableClearWrites(clearColor, clearDepth);
+            GLbitfield mask = 0;
+            if (clearColor) {
+                glClearColor(d.clearColor[0], d.clearColor[1], d.clearColor[2], d.clearColor[3]);
+                mask |= GL_COLOR_BUFFER_BIT;
+            }
+            if (clearDepth) {
+                glClearDepth(d.clearDepth);
+                mask |= GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT;
+            }
+            glClear(mask);
         }
-        glClear(mask);
     }
 
     // render pass não emite draw por conta própria (feito via draw())
 }
 
+void GLDevice::resolveAttachment(const RenderPassDesc::Attachment& a, unsigned int sourcePoint, bool depth) {
+    auto* dst = static_cast<GLTexture*>(a.resolveTarget);
+    if (!dst) { Core::log(Core::LogLevel::Warn, "StoreAction::Resolve sem resolveTarget; conteúdo descartado"); return; }
+    unsigned int resolveFBO = 0;
+    glGenFramebuffers(1, &resolveFBO);
+    glBindFramebuffer(0x8CA9 /*GL_DRAW_FRAMEBUFFER*/, resolveFBO);
+    if (depth) {
+        const unsigned int point = (dst->getDesc().format == TextureFormat::Depth24Stencil8) ? GL_DEPTH_STENCIL_ATTACHMENT : GL_DEPTH_ATTACHMENT;
+        glFramebufferTexture2D(0x8CA9 /*GL_DRAW_FRAMEBUFFER*/, point, 0x0DE1 /*GL_TEXTURE_2D*/, dst->id_, 0);
+        glDrawBuffer(0);
+    } else {
+        glFramebufferTexture2D(0x8CA9 /*GL_DRAW_FRAMEBUFFER*/, GL_COLOR_ATTACHMENT0, 0x0DE1 /*GL_TEXTURE_2D*/, dst->id_, 0);
+        glDrawBuffer(GL_COLOR_ATTACHMENT0);
+        glReadBuffer(sourcePoint);
+    }
+    const auto dw = static_cast<GLint>(std::max(1u, dst->getDesc().width));
+    const auto dh = static_cast<GLint>(std::max(1u, dst->getDesc().height));
+    glBlitFramebuffer(0, 0, static_cast<GLint>(activeWidth_), static_cast<GLint>(activeHeight_), 0, 0, dw, dh,
+                      depth ? GL_DEPTH_BUFFER_BIT : GL_COLOR_BUFFER_BIT, GL_NEAREST);
+    glBindFramebuffer(0x8CA9 /*GL_DRAW_FRAMEBUFFER*/, currentFBO_);
+    GLFrameSync::deferDelete(GLFrameSync::ObjectType::Framebuffer, resolveFBO);
+}
+
 void GLDevice::endRenderPass() {
+    if (activePass_) {
+        const auto& d = activePass_->desc_;
+        AttachmentList discard;
+        if (tempFBOCreated_) {
+            for (size_t i = 0; i < d.colorAttachments.size(); ++i) {
+                const auto& a = d.colorAttachments[i];
+                if (!a.texture) continue;
+                const auto point = static_cast<unsigned int>(GL_COLOR_ATTACHMENT0 + i);
+                if (a.store == StoreAction::Resolve) resolveAttachment(a, point, false);
+                if (a.store != StoreAction::Store) discard.push_back(point);
+            }
+            if (d.depthAttachment.texture) {
+                const unsigned int point = depthAttachmentPoint(d.depthAttachment);
+                if (d.depthAttachment.store == StoreAction::Resolve) resolveAttachment(d.depthAttachment, point, true);
+                if (d.depthAttachment.store != StoreAction::Store) discard.push_back(point);
+            }
+        } else {
+            backbufferAttachments(d, activeOffscreenBackbuffer_, false, discard);
+        }
+        // Store DontCare/Resolve: o conteúdo não precisa voltar à memória
+        if (!discard.empty() && hasInvalidateFramebuffer_) {
+            glInvalidateFramebuffer(GL_FRAMEBUFFER, static_cast<GLsizei>(discard.count), discard.items);
+        }
+        activePass_ = nullptr;
+        activeOffscreenBackbuffer_ = false;
+    }
     if (tempFBOCreated_) {
         glBindFramebuffer(GL_FRAMEBUFFER, 0);
-        glDeleteFramebuffers(1, &currentFBO_);
+        GLFrameSync::deferDelete(GLFrameSync::ObjectType::Framebuffer, currentFBO_);
         currentFBO_ = 0;
         tempFBOCreated_ = false;
     }
@@ -196,22 +335,162 @@ static GLuint compile(GLenum type, const char* src) {
     return s;
 }
 
+// Fallback GLSL das constantes de especialização: #define AURORA_SPEC_<id> após a linha #version
+static std::string injectSpecializationDefines(const char* src, const std::vector<SpecializationConstant>& constants) {
+    std::string out(src);
+    if (constants.empty()) return out;
+    std::string defines;
+    for (const auto& c : constants) {
+        defines += "#define AURORA_SPEC_" + std::to_string(c.id) + " ";
+        switch (c.type) {
+            case SpecializationConstant::Type::Bool: defines += c.bits ? "true" : "false"; break;
+            case SpecializationConstant::Type::Int: defines += std::to_string(std::bit_cast<int32_t>(c.bits)); break;
+            case SpecializationConstant::Type::UInt: defines += std::to_string(c.bits) + "u"; break;
+            case SpecializationConstant::Type::Float: {
+                char buf[32];
+                std::snprintf(buf, sizeof(buf), "%.9g", static_cast<double>(std::bit_cast<float>(c.bits)));
+                defines += buf;
+                if (!std::strpbrk(buf, ".eEn")) defines += ".0"; // literal inteiro viraria int
+                break;
+            }
+        }
+        defines += "\n";
+    }
+    size_t insertAt = 0;
+    const size_t version = out.find("#version");
+    if (version != std::string::npos) {
+        const size_t eol = out.find('\n', version);
+        insertAt = eol == std::string::npos ? out.size() : eol + 1;
+        if (eol == std::string::npos) defines.insert(0, "\n");
+    }
+    out.insert(insertAt, defines);
+    return out;
+}
+
+// Módulo SPIR-V via ARB_gl_spirv; 0 se o driver rejeitar (o chamador cai para GLSL)
+static GLuint loadSpirv(GLenum type, const ShaderModuleDesc& desc) {
+    GLuint s = glCreateShader(type);
+    glShaderBinary(1, &s, 0x9551 /*GL_SHADER_BINARY_FORMAT_SPIR_V*/, desc.spirv, static_cast<GLsizei>(desc.spirvSize));
+    std::vector<GLuint> indices, values;
+    indices.reserve(desc.specializationConstants.size());
+    values.reserve(desc.specializationConstants.size());
+    for (const auto& c : desc.specializationConstants) { indices.push_back(c.id); values.push_back(c.bits); }
+    const auto count = static_cast<GLuint>(indices.size());
+    if (GLAD_GL_VERSION_4_6) glSpecializeShader(s, "main", count, indices.data(), values.data());
+    else glSpecializeShaderARB(s, "main", count, indices.data(), values.data());
+    GLint ok = 0;
+    glGetShaderiv(s, GL_COMPILE_STATUS, &ok);
+    if (!ok) {
+        char log[1024]; GLsizei len = 0; glGetShaderInfoLog(s, 1024, &len, log);
+        Core::log(Core::LogLevel::Warn, std::string("GL SPIR-V rejeitado, usando GLSL: ") + log);
+        glDeleteShader(s);
+        return 0;
+    }
+    return s;
+}
+
 std::unique_ptr<IShaderModule> GLDevice::createShaderModule(const ShaderModuleDesc& desc) {
     GLenum type = (desc.stage == ShaderStage::Vertex) ? GL_VERTEX_SHADER : GL_FRAGMENT_SHADER;
-    GLuint id = compile(type, desc.source);
+    if (desc.stage == ShaderStage::Compute) {
+        if (!caps_.supportsCompute) {
+            Core::log(Core::LogLevel::Error, "createShaderModule: compute shaders exigem GL 4.3");
+            return nullptr;
+        }
+        type = 0x91B9 /*GL_COMPUTE_SHADER*/;
+    }
+    if (desc.spirv && desc.spirvSize && caps_.supportsSpirv) {
+        if (GLuint id = loadSpirv(type, desc)) return std::make_unique<GLShaderModule>(desc.stage, id);
+    }
+    if (!desc.source) {
+        Core::log(Core::LogLevel::Error, "createShaderModule: sem GLSL para fallback");
+        return nullptr;
+    }
+    const std::string source = injectSpecializationDefines(desc.source, desc.specializationConstants);
+    GLuint id = compile(type, source.c_str());
     return std::make_unique<GLShaderModule>(desc.stage, id);
 }
 
-std::unique_ptr<IBuffer> GLDevice::createBuffer(const void* data, size_t bytes, BufferUsage usage) {
+std::unique_ptr<IBuffer> GLDevice::createBuffer(const void* data, size_t bytes, BufferUsage usage, BufferUpdate update) {
     unsigned int id = 0;
     glGenBuffers(1, &id);
     GLenum target = GL_ARRAY_BUFFER;
+    GLenum hint = GL_STATIC_DRAW;
+    if (update == BufferUpdate::Dynamic) hint = 0x88E8 /*GL_DYNAMIC_DRAW*/;
+    if (update == BufferUpdate::Stream) hint = 0x88E0 /*GL_STREAM_DRAW*/;
     if (usage == BufferUsage::Index) target = 0x8893 /*GL_ELEMENT_ARRAY_BUFFER*/;
+    if (usage == BufferUsage::Storage) {
+        // Conteúdo produzido e consumido pela GPU (compute)
+        target = 0x90D2 /*GL_SHADER_STORAGE_BUFFER*/;
+        hint = 0x88EA /*GL_DYNAMIC_COPY*/;
+    }
     glBindBuffer(target, id);
-    glBufferData(target, static_cast<ptrdiff_t>(bytes), data, GL_STATIC_DRAW);
+    glBufferData(target, static_cast<ptrdiff_t>(bytes), data, hint);
+    trackBufferMemory(bytes);
     return std::make_unique<GLBuffer>(bytes, usage, id);
 }
 
+// Compara os offsets refletidos de cada bloco com o layout da struct C++ (apenas avisa; o pipeline é criado)
+static void verifyUniformBlockLayouts(GLuint program, const std::vector<UniformBlockLayoutCheck>& checks) {
+    if (checks.empty()) return;
+    GLint blockCount = 0;
+    glGetProgramiv(program, GL_ACTIVE_UNIFORM_BLOCKS, &blockCount);
+    for (const auto& check : checks) {
+        const std::string label = check.blockName ? std::string(check.blockName) : "binding " + std::to_string(check.binding);
+        if (check.layout.layout != BlockLayout::Std140) {
+            Core::log(Core::LogLevel::Warn, "Layout do bloco " + label + ": uniform blocks usam std140");
+        }
+        GLint block = -1;
+        if (check.blockName) {
+            const GLuint index = glGetUniformBlockIndex(program, check.blockName);
+            if (index != GL_INVALID_INDEX) block = static_cast<GLint>(index);
+        }
+        for (GLint b = 0; block < 0 && b < blockCount; ++b) {
+            GLint binding = -1;
+            glGetActiveUniformBlockiv(program, static_cast<GLuint>(b), GL_UNIFORM_BLOCK_BINDING, &binding);
+            if (binding == static_cast<GLint>(check.binding)) block = b;
+        }
+        if (block < 0) {
+            Core::log(Core::LogLevel::Warn, "Layout do bloco " + label + ": bloco não encontrado no programa");
+            continue;
+        }
+
+        GLint dataSize = 0, uniformCount = 0;
+        glGetActiveUniformBlockiv(program, static_cast<GLuint>(block), GL_UNIFORM_BLOCK_DATA_SIZE, &dataSize);
+        glGetActiveUniformBlockiv(program, static_cast<GLuint>(block), GL_UNIFORM_BLOCK_ACTIVE_UNIFORMS, &uniformCount);
+        std::vector<GLint> indices(static_cast<size_t>(uniformCount));
+        std::vector<GLint> offsets(static_cast<size_t>(uniformCount));
+        if (uniformCount > 0) {
+            glGetActiveUniformBlockiv(program, static_cast<GLuint>(block), GL_UNIFORM_BLOCK_ACTIVE_UNIFORM_INDICES, indices.data());
+            glGetActiveUniformsiv(program, uniformCount, reinterpret_cast<const GLuint*>(indices.data()), GL_UNIFORM_OFFSET, offsets.data());
+        }
+        std::sort(offsets.begin(), offsets.end());
+
+        // Arrays e matrizes aparecem como um único uniform ativo (offset do primeiro elemento)
+        std::vector<GLint> expected;
+        uint32_t cursor = 0;
+        for (const auto& f : check.layout.fields) {
+            const BlockMemberLayout m = layoutBlockMember(check.layout.layout, f.type, f.arrayCount, cursor);
+            expected.push_back(static_cast<GLint>(m.offset));
+            cursor = m.offset + m.size;
+        }
+        std::sort(expected.begin(), expected.end());
+
+        if (offsets != expected) {
+            auto join = [](const std::vector<GLint>& v) {
+                std::string out;
+                for (GLint o : v) out += (out.empty() ? "" : ",") + std::to_string(o);
+                return out;
+            };
+            Core::log(Core::LogLevel::Warn, "Layout do bloco " + label + " diverge da struct C++: offsets GL [" + join(offsets)
+                + "] vs C++ [" + join(expected) + "]");
+        }
+        if (static_cast<size_t>(dataSize) > check.layout.cppSize) {
+            Core::log(Core::LogLevel::Warn, "Layout do bloco " + label + ": bloco tem " + std::to_string(dataSize)
+                + " bytes e a struct C++ " + std::to_string(check.layout.cppSize));
+        }
+    }
+}
+
 std::unique_ptr<IGraphicsPipeline> GLDevice::createGraphicsPipeline(const GraphicsPipelineDesc& desc) {
     GLuint program = glCreateProgram();
     auto* vs = static_cast<GLShaderModule*>(desc.vertexShader);
@@ -223,6 +502,8 @@ std::unique_ptr<IGraphicsPipeline> GLDevice::createGraphicsPipeline(const Graphi
     if (!linked) {
         char logBuf[1024]; GLsizei len = 0; glGetProgramInfoLog(program, 1024, &len, logBuf);
         Core::log(Core::LogLevel::Error, std::string("GL link error: ") + logBuf);
+    } else {
+        verifyUniformBlockLayouts(program, desc.uniformBlockLayouts);
     }
     GLuint vao = 0;
     glGenVertexArrays(1, &vao);
@@ -231,13 +512,42 @@ std::unique_ptr<IGraphicsPipeline> GLDevice::createGraphicsPipeline(const Graphi
         glVertexAttribPointer(a.location, a.components, GL_FLOAT, GL_FALSE, static_cast<GLsizei>(desc.vertexLayout.stride), reinterpret_cast<const void*>(static_cast<uintptr_t>(a.offset)));
         glEnableVertexAttribArray(a.location);
     }
+    // Divisor faz parte do VAO; os ponteiros são aplicados no draw (dependem do buffer e de firstInstance)
+    for (const auto& a : desc.vertexLayout.instanceAttributes) glVertexAttribDivisor(a.location, 1);
     return std::make_unique<GLGraphicsPipeline>(program, vao, desc.vertexLayout, desc.state);
 }
 
+std::unique_ptr<IComputePipeline> GLDevice::createComputePipeline(const ComputePipelineDesc& desc) {
+    if (!caps_.supportsCompute) {
+        Core::log(Core::LogLevel::Error, "createComputePipeline: compute shaders exigem GL 4.3");
+        return nullptr;
+    }
+    auto* cs = static_cast<GLShaderModule*>(desc.computeShader);
+    if (!cs || cs->getStage() != ShaderStage::Compute) {
+        Core::log(Core::LogLevel::Error, "createComputePipeline: computeShader ausente ou de outro estágio");
+        return nullptr;
+    }
+    GLuint program = glCreateProgram();
+    glAttachShader(program, cs->id_);
+    glLinkProgram(program);
+    GLint linked = 0; glGetProgramiv(program, GL_LINK_STATUS, &linked);
+    if (!linked) {
+        char logBuf[1024]; GLsizei len = 0; glGetProgramInfoLog(program, 1024, &len, logBuf);
+        Core::log(Core::LogLevel::Error, std::string("GL link error (compute): ") + logBuf);
+        glDeleteProgram(program);
+        return nullptr;
+    }
+    verifyUniformBlockLayouts(program, desc.uniformBlockLayouts);
+    return std::make_unique<GLComputePipeline>(program);
+}
+
 void GLDevice::setGraphicsPipeline(IGraphicsPipeline* pipeline) {
     currentPipeline_ = static_cast<GLGraphicsPipeline*>(pipeline);
+    currentProgram_ = currentPipeline_->program_;
     glUseProgram(currentPipeline_->program_);
     glBindVertexArray(currentPipeline_->vao_);
+    primitiveMode_ = toGLPrimitiveMode(currentPipeline_->state_.topology);
+    appliedFirstInstance_ = kInstanceAttributesDirty;
     // Aplicar estado de raster/blend/depth do pipeline atual
     applyPipelineState(currentPipeline_->state_);
 }
@@ -256,10 +566,94 @@ void GLDevice::setVertexBuffer(IBuffer* buffer) {
 }
 
 void GLDevice::draw(uint32_t vertexCount, uint32_t firstVertex) {
-    glDrawArrays(GL_TRIANGLES, static_cast<GLint>(firstVertex), static_cast<GLsizei>(vertexCount));
+    glDrawArrays(primitiveMode_, static_cast<GLint>(firstVertex), static_cast<GLsizei>(vertexCount));
+}
+
+void GLDevice::setInstanceBuffer(IBuffer* buffer) {
+    currentInstanceBuffer_ = static_cast<GLBuffer*>(buffer);
+    appliedFirstInstance_ = kInstanceAttributesDirty;
+}
+
+bool GLDevice::applyInstanceAttributes(uint32_t firstInstance) {
+    if (!currentPipeline_) return false;
+    const auto& layout = currentPipeline_->layout_;
+    if (layout.instanceAttributes.empty()) return true;
+    if (!currentInstanceBuffer_) {
+        Core::log(Core::LogLevel::Error, "drawInstanced: pipeline com atributos por instância sem setInstanceBuffer");
+        return false;
+    }
+    if (appliedFirstInstance_ == firstInstance) return true;
+    // Sem base instance (GL 4.2) firstInstance vira offset nos ponteiros; o VBO corrente é restaurado depois
+    glBindBuffer(GL_ARRAY_BUFFER, currentInstanceBuffer_->id_);
+    const uintptr_t base = static_cast<uintptr_t>(firstInstance) * layout.instanceStride;
+    for (const auto& a : layout.instanceAttributes) {
+        glVertexAttribPointer(a.location, a.components, GL_FLOAT, GL_FALSE, static_cast<GLsizei>(layout.instanceStride), reinterpret_cast<const void*>(base + a.offset));
+        glEnableVertexAttribArray(a.location);
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, currentVertexBuffer_ ? currentVertexBuffer_->id_ : 0);
+    appliedFirstInstance_ = firstInstance;
+    return true;
+}
+
+void GLDevice::drawInstanced(uint32_t vertexCount, uint32_t firstVertex, uint32_t instanceCount, uint32_t firstInstance) {
+    if (!applyInstanceAttributes(firstInstance)) return;
+    glDrawArraysInstanced(primitiveMode_, static_cast<GLint>(firstVertex), static_cast<GLsizei>(vertexCount), static_cast<GLsizei>(instanceCount));
+}
+
+void GLDevice::setComputePipeline(IComputePipeline* pipeline) {
+    auto* cp = static_cast<GLComputePipeline*>(pipeline);
+    currentProgram_ = cp->program_;
+    glUseProgram(cp->program_);
+}
+
+void GLDevice::dispatch(uint32_t groupsX, uint32_t groupsY, uint32_t groupsZ) {
+    if (activePass_) Core::log(Core::LogLevel::Warn, "dispatch: chamado dentro de um render pass");
+    glDispatchCompute(groupsX, groupsY, groupsZ);
+}
+
+void GLDevice::dispatchIndirect(IBuffer* buffer, size_t offset) {
+    auto* glb = static_cast<GLBuffer*>(buffer);
+    if (activePass_) Core::log(Core::LogLevel::Warn, "dispatchIndirect: chamado dentro de um render pass");
+    glBindBuffer(0x90EE /*GL_DISPATCH_INDIRECT_BUFFER*/, glb->id_);
+    glDispatchComputeIndirect(static_cast<GLintptr>(offset));
+}
+
+void GLDevice::memoryBarrier(uint32_t barriers) {
+    const GLbitfield bits = GLConversions::toGLMemoryBarrierBits(barriers);
+    if (bits) glMemoryBarrier(bits);
 }
 
 std::unique_ptr<IDescriptorSet> GLDevice::createDescriptorSet(const DescriptorSetDesc& desc) {
+    for (const auto& ub : desc.uniformBuffers) {
+        if (!ub.buffer) { Core::log(Core::LogLevel::Error, "createDescriptorSet: UniformBinding sem buffer"); return nullptr; }
+        if (ub.dynamic && ub.size == 0) { Core::log(Core::LogLevel::Error, "createDescriptorSet: UniformBinding dinâmico exige size"); return nullptr; }
+        if (ub.offset % caps_.uniformBufferOffsetAlignment != 0) {
+            Core::log(Core::LogLevel::Warn, "createDescriptorSet: offset de UBO não alinhado a " + std::to_string(caps_.uniformBufferOffsetAlignment));
+        }
+    }
+    if ((!desc.storageBuffers.empty() || !desc.storageTextures.empty()) && !caps_.supportsCompute) {
+        Core::log(Core::LogLevel::Error, "createDescriptorSet: bindings de storage exigem GL 4.3");
+        return nullptr;
+    }
+    for (const auto& sb : desc.storageBuffers) {
+        if (!sb.buffer || sb.buffer->getUsage() != BufferUsage::Storage) {
+            Core::log(Core::LogLevel::Error, "createDescriptorSet: StorageBufferBinding exige buffer com BufferUsage::Storage");
+            return nullptr;
+        }
+        if (sb.offset % caps_.storageBufferOffsetAlignment != 0) {
+            Core::log(Core::LogLevel::Warn, "createDescriptorSet: offset de SSBO não alinhado a " + std::to_string(caps_.storageBufferOffsetAlignment));
+        }
+    }
+    for (const auto& st : desc.storageTextures) {
+        if (!st.texture || st.texture->getDesc().usage != TextureUsage::Storage) {
+            Core::log(Core::LogLevel::Error, "createDescriptorSet: StorageTextureBinding exige textura com TextureUsage::Storage");
+            return nullptr;
+        }
+        if (GLConversions::toGLImageFormat(st.texture->getDesc().format) == 0) {
+            Core::log(Core::LogLevel::Error, "createDescriptorSet: formato de textura não suportado como imagem de storage");
+            return nullptr;
+        }
+    }
     return std::make_unique<GLDescriptorSet>(desc);
 }
 
@@ -271,39 +665,83 @@ void GLDevice::setIndexBuffer(IBuffer* buffer) {
 }
 
 void GLDevice::drawIndexed(uint32_t indexCount, uint32_t firstIndex, IndexType indexType) {
-    (void)firstIndex; // not supporting offset for now
-    GLenum glType = (indexType == IndexType::Uint16) ? 0x1403 /*GL_UNSIGNED_SHORT*/ : 0x1405 /*GL_UNSIGNED_INT*/;
-    glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(indexCount), glType, nullptr);
+    const bool u16 = (indexType == IndexType::Uint16);
+    GLenum glType = u16 ? 0x1403 /*GL_UNSIGNED_SHORT*/ : 0x1405 /*GL_UNSIGNED_INT*/;
+    const uintptr_t byteOffset = static_cast<uintptr_t>(firstIndex) * (u16 ? 2u : 4u);
+    glDrawElements(primitiveMode_, static_cast<GLsizei>(indexCount), glType, reinterpret_cast<const void*>(byteOffset));
+}
+
+void GLDevice::drawIndexedInstanced(uint32_t indexCount, uint32_t firstIndex, IndexType indexType, uint32_t instanceCount, uint32_t firstInstance) {
+    if (!applyInstanceAttributes(firstInstance)) return;
+    const bool u16 = (indexType == IndexType::Uint16);
+    GLenum glType = u16 ? 0x1403 /*GL_UNSIGNED_SHORT*/ : 0x1405 /*GL_UNSIGNED_INT*/;
+    const uintptr_t byteOffset = static_cast<uintptr_t>(firstIndex) * (u16 ? 2u : 4u);
+    glDrawElementsInstanced(primitiveMode_, static_cast<GLsizei>(indexCount), glType, reinterpret_cast<const void*>(byteOffset), static_cast<GLsizei>(instanceCount));
+}
+
+int GLDevice::getUniformBlockIndex(unsigned int program, const char* blockName) {
+    auto& blockMap = programToUniformBlockIndexCache_[program];
+    auto it = blockMap.find(blockName);
+    if (it != blockMap.end()) return it->second;
+    GLint blockIndex = static_cast<GLint>(glGetUniformBlockIndex(program, blockName));
+    blockMap[blockName] = blockIndex;
+    return blockIndex;
+}
+
+int GLDevice::getUniformLocation(unsigned int program, const char* name) {
+    auto& locMap = programToUniformSamplerLocationCache_[program];
+    auto it = locMap.find(name);
+    if (it != locMap.end()) return it->second;
+    int loc = glGetUniformLocation(program, name);
+    locMap[name] = loc;
+    return loc;
 }
 
-void GLDevice::bindDescriptorSet(IDescriptorSet* set) {
+void GLDevice::ensureUniformBlockBinding(unsigned int program, int blockIndex, unsigned int binding) {
+    if (!program || blockIndex < 0) return;
+    unsigned long long key = (static_cast<unsigned long long>(program) << 32) | static_cast<unsigned long long>(blockIndex);
+    auto itApplied = uniformBlockBindingApplied_.find(key);
+    if (itApplied == uniformBlockBindingApplied_.end() || itApplied->second != binding) {
+        glUniformBlockBinding(program, static_cast<GLuint>(blockIndex), binding);
+        uniformBlockBindingApplied_[key] = binding;
+    }
+}
+
+void GLDevice::ensureSamplerUnit(unsigned int program, int location, int unit) {
+    // glUniform1i atua no programa corrente (o do pipeline bindado)
+    if (!program || location < 0) return;
+    unsigned long long key = (static_cast<unsigned long long>(program) << 32) | static_cast<unsigned long long>(location);
+    auto itSet = samplerUniformApplied_.find(key);
+    if (itSet == samplerUniformApplied_.end() || itSet->second != unit) {
+        glUniform1i(location, unit);
+        samplerUniformApplied_[key] = unit;
+    }
+}
+
+void GLDevice::bindDescriptorSet(IDescriptorSet* set, std::span<const uint32_t> dynamicOffsets) {
     auto* glset = static_cast<GLDescriptorSet*>(set);
-    for (const auto& ub : glset->desc.uniformBuffers) {
+    if (dynamicOffsets.size() != glset->dynamicCount) {
+        Core::log(Core::LogLevel::Error, "bindDescriptorSet: esperado(s) " + std::to_string(glset->dynamicCount)
+            + " offset(s) dinâmico(s), recebido(s) " + std::to_string(dynamicOffsets.size()));
+        return;
+    }
+    GLuint program = currentProgram_;
+    for (size_t i = 0; i < glset->desc.uniformBuffers.size(); ++i) {
+        const auto& ub = glset->desc.uniformBuffers[i];
         auto* buf = static_cast<GLBuffer*>(ub.buffer);
         // Se o shader não especifica layout(binding), associamos bloco ao binding com glUniformBlockBinding
-        GLuint program = currentPipeline_ ? currentPipeline_->program_ : 0;
         if (program) {
             const char* blockName = ub.blockName ? ub.blockName : "Globals";
-            // Cache lookup para blockIndex
-            GLint blockIndex = -1;
-            auto& blockMap = programToUniformBlockIndexCache_[program];
-            auto itBlock = blockMap.find(blockName);
-            if (itBlock != blockMap.end()) {
-                blockIndex = itBlock->second;
-            } else {
-                blockIndex = glGetUniformBlockIndex(program, blockName);
-                blockMap[blockName] = blockIndex;
-            }
-            if (blockIndex >= 0) {
-                unsigned long long key = (static_cast<unsigned long long>(program) << 32) | static_cast<unsigned long long>(blockIndex);
-                auto itApplied = uniformBlockBindingApplied_.find(key);
-                if (itApplied == uniformBlockBindingApplied_.end() || itApplied->second != ub.binding) {
-                    glUniformBlockBinding(program, static_cast<GLuint>(blockIndex), ub.binding);
-                    uniformBlockBindingApplied_[key] = ub.binding;
-                }
-            }
+            ensureUniformBlockBinding(program, getUniformBlockIndex(program, blockName), ub.binding);
+        }
+        // Range quando há offset/size (constantes por draw num buffer grande); senão o buffer inteiro
+        const size_t offset = glset->getUniformOffset(i, dynamicOffsets);
+        if (offset == 0 && ub.size == 0) {
+            glBindBufferBase(0x8A11 /*GL_UNIFORM_BUFFER*/, ub.binding, buf->id_);
+        } else {
+            const size_t size = ub.size ? ub.size : buf->getSize() - offset;
+            glBindBufferRange(0x8A11 /*GL_UNIFORM_BUFFER*/, ub.binding, buf->id_, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size));
         }
-        glBindBufferBase(0x8A11 /*GL_UNIFORM_BUFFER*/, ub.binding, buf->id_);
     }
 
     // Bind sampled textures
@@ -312,31 +750,102 @@ void GLDevice::bindDescriptorSet(IDescriptorSet* set) {
         auto* smp = static_cast<GLSampler*>(st.sampler);
         if (!tex || !smp) continue;
         // Resolve uniform sampler location if a name is provided
-        if (currentPipeline_ && st.uniformName) {
-            unsigned int program = currentPipeline_->program_;
-            auto& locMap = programToUniformSamplerLocationCache_[program];
-            int loc = -1;
-            auto itLoc = locMap.find(st.uniformName);
-            if (itLoc != locMap.end()) loc = itLoc->second; else { loc = glGetUniformLocation(program, st.uniformName); locMap[st.uniformName] = loc; }
-            if (loc >= 0) {
-                unsigned long long key = (static_cast<unsigned long long>(program) << 32) | static_cast<unsigned long long>(loc);
-                auto itSet = samplerUniformApplied_.find(key);
-                if (itSet == samplerUniformApplied_.end() || itSet->second != static_cast<int>(st.binding)) {
-                    glUniform1i(loc, static_cast<int>(st.binding));
-                    samplerUniformApplied_[key] = static_cast<int>(st.binding);
-                }
-            }
+        if (program && st.uniformName) {
+            ensureSamplerUnit(program, getUniformLocation(program, st.uniformName), static_cast<int>(st.binding));
         }
         // Activate texture unit == binding, bind texture and sampler
         glActiveTexture(0x84C0 /*GL_TEXTURE0*/ + st.binding);
         glBindTexture(0x0DE1 /*GL_TEXTURE_2D*/, tex->id_);
         glBindSampler(st.binding, smp->id_);
     }
+
+    // SSBOs e imagens de storage usam layout(binding) do shader (GL 4.3)
+    for (const auto& sb : glset->desc.storageBuffers) {
+        auto* buf = static_cast<GLBuffer*>(sb.buffer);
+        if (sb.offset == 0 && sb.size == 0) {
+            glBindBufferBase(0x90D2 /*GL_SHADER_STORAGE_BUFFER*/, sb.binding, buf->id_);
+        } else {
+            const size_t size = sb.size ? sb.size : buf->getSize() - sb.offset;
+            glBindBufferRange(0x90D2 /*GL_SHADER_STORAGE_BUFFER*/, sb.binding, buf->id_, static_cast<GLintptr>(sb.offset), static_cast<GLsizeiptr>(size));
+        }
+    }
+    for (const auto& st : glset->desc.storageTextures) {
+        auto* tex = static_cast<GLTexture*>(st.texture);
+        glBindImageTexture(st.binding, tex->id_, static_cast<GLint>(st.mipLevel), GL_FALSE, 0,
+            static_cast<GLenum>(GLConversions::toGLImageAccess(st.access)),
+            static_cast<GLenum>(GLConversions::toGLImageFormat(tex->getDesc().format)));
+    }
+}
+
+void GLDevice::executeBundle(GLCommandBundle* bundle) {
+    if (!bundle || !bundle->isValid()) return;
+    if (!bundle->resolved_) bundle->resolve(*this);
+
+    using Kind = GLCommandBundle::ResolvedOp::Kind;
+    for (const auto& op : bundle->resolvedOps_) {
+        switch (op.kind) {
+            case Kind::Pipeline:
+                glUseProgram(op.program);
+                glBindVertexArray(op.id);
+                primitiveMode_ = toGLPrimitiveMode(op.pipeline->state_.topology);
+                applyPipelineState(op.pipeline->state_);
+                break;
+            case Kind::VertexBuffer:
+                glBindBuffer(GL_ARRAY_BUFFER, op.id);
+                for (const auto& a : op.pipeline->layout_.attributes) {
+                    glVertexAttribPointer(a.location, a.components, GL_FLOAT, GL_FALSE, static_cast<GLsizei>(op.pipeline->layout_.stride), reinterpret_cast<const void*>(static_cast<uintptr_t>(a.offset)));
+                    glEnableVertexAttribArray(a.location);
+                }
+                break;
+            case Kind::IndexBuffer:
+                glBindBuffer(0x8893 /*GL_ELEMENT_ARRAY_BUFFER*/, op.id);
+                break;
+            case Kind::UniformBuffer:
+                ensureUniformBlockBinding(op.program, op.location, op.binding);
+                if (op.rangeSize) glBindBufferRange(0x8A11 /*GL_UNIFORM_BUFFER*/, op.binding, op.id, static_cast<GLintptr>(op.byteOffset), static_cast<GLsizeiptr>(op.rangeSize));
+                else glBindBufferBase(0x8A11 /*GL_UNIFORM_BUFFER*/, op.binding, op.id);
+                break;
+            case Kind::SampledTexture:
+                ensureSamplerUnit(op.program, op.location, static_cast<int>(op.binding));
+                glActiveTexture(0x84C0 /*GL_TEXTURE0*/ + op.binding);
+                glBindTexture(0x0DE1 /*GL_TEXTURE_2D*/, op.id);
+                glBindSampler(op.binding, op.sampler);
+                break;
+            case Kind::StorageBuffer:
+                if (op.rangeSize) glBindBufferRange(0x90D2 /*GL_SHADER_STORAGE_BUFFER*/, op.binding, op.id, static_cast<GLintptr>(op.byteOffset), static_cast<GLsizeiptr>(op.rangeSize));
+                else glBindBufferBase(0x90D2 /*GL_SHADER_STORAGE_BUFFER*/, op.binding, op.id);
+                break;
+            case Kind::StorageImage:
+                glBindImageTexture(op.binding, op.id, static_cast<GLint>(op.first), GL_FALSE, 0, op.glType, op.format);
+                break;
+            case Kind::DrawArrays:
+                glDrawArrays(primitiveMode_, static_cast<GLint>(op.first), static_cast<GLsizei>(op.count));
+                break;
+            case Kind::DrawElements:
+                glDrawElements(primitiveMode_, static_cast<GLsizei>(op.count), op.glType, reinterpret_cast<const void*>(op.byteOffset));
+                break;
+        }
+    }
+
+    // Estado bindado ao fim do bundle vale para os comandos seguintes
+    if (bundle->lastPipeline_) {
+        currentPipeline_ = bundle->lastPipeline_;
+        currentProgram_ = currentPipeline_->program_;
+        appliedFirstInstance_ = kInstanceAttributesDirty;
+    }
+    if (bundle->lastVertexBuffer_) currentVertexBuffer_ = bundle->lastVertexBuffer_;
+    if (bundle->lastIndexBuffer_) currentIndexBuffer_ = bundle->lastIndexBuffer_;
 }
 
 void GLDevice::updateBuffer(IBuffer* buffer, const void* data, size_t bytes, size_t dstOffset) {
     auto* glb = static_cast<GLBuffer*>(buffer);
-    GLenum target = (glb->getUsage() == BufferUsage::Index) ? 0x8893 /*GL_ELEMENT_ARRAY_BUFFER*/ : (glb->getUsage() == BufferUsage::Uniform ? 0x8A11 /*GL_UNIFORM_BUFFER*/ : GL_ARRAY_BUFFER);
+    GLenum target = GL_ARRAY_BUFFER;
+    switch (glb->getUsage()) {
+        case BufferUsage::Index: target = 0x8893 /*GL_ELEMENT_ARRAY_BUFFER*/; break;
+        case BufferUsage::Uniform: target = 0x8A11 /*GL_UNIFORM_BUFFER*/; break;
+        case BufferUsage::Storage: target = 0x90D2 /*GL_SHADER_STORAGE_BUFFER*/; break;
+        case BufferUsage::Vertex: break;
+    }
     glBindBuffer(target, glb->id_);
     glBufferSubData(target, static_cast<GLintptr>(dstOffset), static_cast<GLsizeiptr>(bytes), data);
 }
@@ -349,7 +858,7 @@ std::unique_ptr<ICommandList> GLDevice::createCommandList() {
 
 void GLDevice::submit(ICommandList* list) {
     auto* gl = static_cast<GLCommandList*>(list);
-    for (auto& op : gl->operations_) op();
+    for (const auto& op : gl->operations_) op.invoke(op.closure);
 }
 
 std::unique_ptr<ITexture> GLDevice::createTexture(const TextureDesc& desc, const void* initialPixelsRGBA8) {
@@ -438,6 +947,7 @@ std::unique_ptr<ITexture> GLDevice::createTexture(const TextureDesc& desc, const
     if (desc.mipLevels > 1 && (desc.format == TextureFormat::RGBA8 || desc.format == TextureFormat::RGB8 || desc.format == TextureFormat::R8 || desc.format == TextureFormat::RGBA16F || desc.format == TextureFormat::R16F)) {
         glGenerateMipmap(GL_TEXTURE_2D);
     }
+    trackTextureMemory(desc);
     return std::make_unique<GLTexture>(desc, id);
 }
 
@@ -11,17 +11,25 @@
 #include "GLShaderModule.hpp"
 #include "GLBuffer.hpp"
 #include "GLGraphicsPipeline.hpp"
+#include "GLComputePipeline.hpp"
 #include "GLDescriptorSet.hpp"
 #include "GLTexture.hpp"
 #include "GLSampler.hpp"
+#include "GLFrameSync.hpp"
+#include "GLCommandBundle.hpp"
 
 namespace Aurora::RHI {
 
+class GLCommandList;
+
 class GLDevice final : public IDevice {
 public:
     const char* getName() const override { return "OpenGL"; }
-    void beginFrame() override {}
-    void endFrame() override {}
+    void beginFrame() override { GLFrameSync::beginFrame(); }
+    void endFrame() override { GLFrameSync::endFrame(); }
+    float getGpuFrameTimeMs() const override { return GLFrameSync::getGpuFrameTimeMs(); }
+    uint32_t getFramesInFlight() const override { return GLFrameSync::getFramesInFlight(); }
+    uint32_t getFrameSlot() const override { return GLFrameSync::getFrameSlot(); }
     std::unique_ptr<ISwapchain> createSwapchain(const SwapchainDesc& desc) override;
     std::unique_ptr<IRenderPass> createRenderPass(const RenderPassDesc& desc) override {
         return std::make_unique<GLRenderPass>(desc);
@@ -34,18 +42,34 @@ private:
 
 public:
     std::unique_ptr<IShaderModule> createShaderModule(const ShaderModuleDesc& desc) override;
-    std::unique_ptr<IBuffer> createBuffer(const void* data, size_t bytes, BufferUsage usage) override;
+    std::unique_ptr<IBuffer> createBuffer(const void* data, size_t bytes, BufferUsage usage, BufferUpdate update = BufferUpdate::Static) override;
     std::unique_ptr<IGraphicsPipeline> createGraphicsPipeline(const GraphicsPipelineDesc& desc) override;
+    std::unique_ptr<IComputePipeline> createComputePipeline(const ComputePipelineDesc& desc) override;
     std::unique_ptr<IDescriptorSet> createDescriptorSet(const DescriptorSetDesc& desc) override;
     void updateBuffer(IBuffer* buffer, const void* data, size_t bytes, size_t dstOffset = 0) override;
     void setGraphicsPipeline(IGraphicsPipeline* pipeline) override;
     void setVertexBuffer(IBuffer* buffer) override;
     void setIndexBuffer(IBuffer* buffer) override;
-    void bindDescriptorSet(IDescriptorSet* set) override;
+    void bindDescriptorSet(IDescriptorSet* set, std::span<const uint32_t> dynamicOffsets = {}) override;
     void draw(uint32_t vertexCount, uint32_t firstVertex) override;
     void drawIndexed(uint32_t indexCount, uint32_t firstIndex, IndexType indexType) override;
+    void setInstanceBuffer(IBuffer* buffer) override;
+    void drawInstanced(uint32_t vertexCount, uint32_t firstVertex, uint32_t instanceCount, uint32_t firstInstance) override;
+    void drawIndexedInstanced(uint32_t indexCount, uint32_t firstIndex, IndexType indexType, uint32_t instanceCount, uint32_t firstInstance) override;
+    void setComputePipeline(IComputePipeline* pipeline) override;
+    void dispatch(uint32_t groupsX, uint32_t groupsY, uint32_t groupsZ) override;
+    void dispatchIndirect(IBuffer* buffer, size_t offset) override;
+    void memoryBarrier(uint32_t barriers) override;
     std::unique_ptr<ICommandList> createCommandList() override;
+    std::unique_ptr<ICommandBundle> createCommandBundle() override { return std::make_unique<GLCommandBundle>(); }
     void submit(ICommandList* list) override;
+    void executeBundle(GLCommandBundle* bundle);
+
+    // Resolução cacheada de blocos/uniforms por programa (compartilhada com GLCommandBundle)
+    int getUniformBlockIndex(unsigned int program, const char* blockName);
+    int getUniformLocation(unsigned int program, const char* name);
+    void ensureUniformBlockBinding(unsigned int program, int blockIndex, unsigned int binding);
+    void ensureSamplerUnit(unsigned int program, int location, int unit);
     Capabilities getCapabilities() const override { return caps_; }
 
     // Textures/samplers
@@ -54,13 +78,30 @@ public:
     void setDebugWireframe(bool enable) override;
 
     private:
+    void resolveAttachment(const RenderPassDesc::Attachment& attachment, unsigned int sourcePoint, bool depth);
+    bool applyInstanceAttributes(uint32_t firstInstance);
+
     GLGraphicsPipeline* currentPipeline_{nullptr};
+    // Programa em uso (gráfico ou compute): alvo das associações de bloco/sampler do bindDescriptorSet
+    unsigned int currentProgram_{0};
     GLBuffer* currentVertexBuffer_{nullptr};
     GLBuffer* currentIndexBuffer_{nullptr};
+    GLBuffer* currentInstanceBuffer_{nullptr};
+    // Modo de glDraw* do pipeline atual (PipelineStateDesc::topology)
+    unsigned int primitiveMode_{0x0004 /*GL_TRIANGLES*/};
+    // firstInstance já aplicado aos ponteiros de atributo por instância do VAO atual (sem base instance no GL 3.3)
+    static constexpr uint32_t kInstanceAttributesDirty = 0xFFFFFFFFu;
+    uint32_t appliedFirstInstance_{kInstanceAttributesDirty};
     Capabilities caps_{};
     // Framebuffer atual quando usando attachments (criamos e destruímos por render pass, MVP)
     unsigned int currentFBO_{0};
     bool tempFBOCreated_{false};
+    // Pass aberto: ações de store (invalidate/resolve) são aplicadas no endRenderPass
+    GLRenderPass* activePass_{nullptr};
+    unsigned int activeWidth_{0};
+    unsigned int activeHeight_{0};
+    bool activeOffscreenBackbuffer_{false};
+    bool hasInvalidateFramebuffer_{false};
 
         // Caches simples para reduzir chamadas GL caras
         // Cache: program -> (blockName -> blockIndex)
@@ -71,30 +112,6 @@ public:
         std::unordered_map<unsigned long long, unsigned int> uniformBlockBindingApplied_{};
         // Último valor aplicado para (program, uniformLocation) => sampler unit
         std::unordered_map<unsigned long long, int> samplerUniformApplied_{};
-
-    class GLCommandList final : public ICommandList {
-    public:
-        explicit GLCommandList(GLDevice& dev) : device_(dev) {}
-        void begin() override { operations_.clear(); recording_ = true; }
-        void end() override { recording_ = false; }
-        void beginRenderPass(IRenderPass* renderPass, ISwapchain* target) override {
-            operations_.emplace_back([this, renderPass, target]{ device_.beginRenderPass(renderPass, target); });
-        }
-        void endRenderPass() override { operations_.emplace_back([this]{ device_.endRenderPass(); }); }
-        void setGraphicsPipeline(IGraphicsPipeline* pipeline) override { operations_.emplace_back([this, pipeline]{ device_.setGraphicsPipeline(pipeline); }); }
-        void setVertexBuffer(IBuffer* buffer) override { operations_.emplace_back([this, buffer]{ device_.setVertexBuffer(buffer); }); }
-        void setIndexBuffer(IBuffer* buffer) override { operations_.emplace_back([this, buffer]{ device_.setIndexBuffer(buffer); }); }
-        void bindDescriptorSet(IDescriptorSet* set) override { operations_.emplace_back([this, set]{ device_.bindDescriptorSet(set); }); }
-        void draw(uint32_t vertexCount, uint32_t firstVertex) override { operations_.emplace_back([this, vertexCount, firstVertex]{ device_.draw(vertexCount, firstVertex); }); }
-        void drawIndexed(uint32_t indexCount, uint32_t firstIndex, IndexType indexType) override { operations_.emplace_back([this, indexCount, firstIndex, indexType]{ device_.drawIndexed(indexCount, firstIndex, indexType); }); }
-        void setDebugWireframe(bool enable) override { operations_.emplace_back([this, enable]{ device_.setDebugWireframe(enable); }); }
-    private:
-        GLDevice& device_;
-        std::vector<std::function<void()>> operations_{};
-        bool recording_{false};
-
-        friend class GLDevice;
-    };
 };
 
 }
@@ -0,0 +1,210 @@
+#include "GLFrameSync.hpp"
+#include "Aurora/Core/Log.hpp"
+#include <glad/glad.h>
+
+#include <array>
+#include <chrono>
+#include <mutex>
+#include <vector>
+
+#ifndef GL_SYNC_GPU_COMMANDS_COMPLETE
+#define GL_SYNC_GPU_COMMANDS_COMPLETE 0x9117
+#endif
+#ifndef GL_SYNC_FLUSH_COMMANDS_BIT
+#define GL_SYNC_FLUSH_COMMANDS_BIT 0x00000001
+#endif
+#ifndef GL_TIMEOUT_EXPIRED
+#define GL_TIMEOUT_EXPIRED 0x911B
+#endif
+#ifndef GL_WAIT_FAILED
+#define GL_WAIT_FAILED 0x911D
+#endif
+#ifndef GL_TIME_ELAPSED
+#define GL_TIME_ELAPSED 0x88BF
+#endif
+#ifndef GL_QUERY_RESULT
+#define GL_QUERY_RESULT 0x8866
+#endif
+#ifndef GL_QUERY_RESULT_AVAILABLE
+#define GL_QUERY_RESULT_AVAILABLE 0x8867
+#endif
+
+namespace Aurora::RHI::GLFrameSync {
+
+namespace {
+    struct PendingObject {
+        ObjectType type;
+        unsigned int id;
+    };
+
+    struct FrameSlot {
+        GLsync fence{nullptr};
+        std::vector<PendingObject> deletions;
+        GLuint timerQuery{0};
+        bool timerPending{false};  // query encerrada no endFrame, resultado ainda não lido
+    };
+
+    struct State {
+        // deferDelete e getStats podem vir de qualquer thread: protege pending, slots[].deletions e stats
+        std::mutex mutex;
+        std::vector<PendingObject> pending;
+        std::vector<PendingObject> retiring;  // só na thread GL: deletions do slot sendo aposentado
+        std::array<FrameSlot, kMaxFramesInFlight> slots{};
+        uint32_t framesInFlight{2};
+        uint32_t requestedFramesInFlight{2};
+        uint64_t frameIndex{0};
+        Stats stats{};
+        bool gpuTiming{false};
+        bool timerActive{false};   // GL_TIME_ELAPSED aberta entre beginFrame e endFrame
+        float gpuFrameMs{0.0f};
+    };
+
+    State& state() {
+        static State s;
+        return s;
+    }
+
+    void destroyObject(const PendingObject& o) {
+        switch (o.type) {
+            case ObjectType::Buffer: glDeleteBuffers(1, &o.id); break;
+            case ObjectType::Texture: glDeleteTextures(1, &o.id); break;
+            case ObjectType::Sampler: glDeleteSamplers(1, &o.id); break;
+            case ObjectType::Program: glDeleteProgram(o.id); break;
+            case ObjectType::Shader: glDeleteShader(o.id); break;
+            case ObjectType::VertexArray: glDeleteVertexArrays(1, &o.id); break;
+            case ObjectType::Framebuffer: glDeleteFramebuffers(1, &o.id); break;
+            case ObjectType::Renderbuffer: glDeleteRenderbuffers(1, &o.id); break;
+        }
+    }
+
+    void retireSlot(State& s, FrameSlot& slot) {
+        if (slot.fence) {
+            GLenum r = glClientWaitSync(slot.fence, 0, 0);
+            if (r == GL_TIMEOUT_EXPIRED) {
+                // GPU atrasada: bloqueia (flush garante que a fence chegue ao driver)
+                auto t0 = std::chrono::steady_clock::now();
+                do {
+                    r = glClientWaitSync(slot.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1'000'000'000ull);
+                } while (r == GL_TIMEOUT_EXPIRED);
+                const double waited = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+                std::scoped_lock lock(s.mutex);
+                ++s.stats.fenceWaits;
+                s.stats.fenceWaitSeconds += waited;
+            }
+            if (r == GL_WAIT_FAILED) Core::log(Core::LogLevel::Warn, "GL: glClientWaitSync falhou");
+            glDeleteSync(slot.fence);
+            slot.fence = nullptr;
+        }
+        if (slot.timerPending) {
+            // Fence sinalizada: o resultado já deveria estar pronto; se não estiver, descarta em vez de bloquear
+            GLuint available = 0;
+            glGetQueryObjectuiv(slot.timerQuery, GL_QUERY_RESULT_AVAILABLE, &available);
+            if (available) {
+                GLuint64 elapsedNs = 0;
+                glGetQueryObjectui64v(slot.timerQuery, GL_QUERY_RESULT, &elapsedNs);
+                s.gpuFrameMs = static_cast<float>(static_cast<double>(elapsedNs) * 1e-6);
+            }
+            slot.timerPending = false;
+        }
+        {
+            // Troca sob o lock e destrói fora dele (glDelete* não segura deferDelete de outras threads)
+            std::scoped_lock lock(s.mutex);
+            s.retiring.swap(slot.deletions);
+            s.stats.deferredDeletes += s.retiring.size();
+        }
+        for (const auto& o : s.retiring) destroyObject(o);
+        s.retiring.clear();
+    }
+}
+
+void setFramesInFlight(uint32_t count) {
+    if (count < 1) count = 1;
+    if (count > kMaxFramesInFlight) count = kMaxFramesInFlight;
+    state().requestedFramesInFlight = count;
+}
+
+uint32_t getFramesInFlight() { return state().framesInFlight; }
+
+uint32_t getFrameSlot() {
+    auto& s = state();
+    return static_cast<uint32_t>(s.frameIndex % s.framesInFlight);
+}
+
+uint64_t getFrameIndex() { return state().frameIndex; }
+
+void beginFrame() {
+    auto& s = state();
+    if (s.requestedFramesInFlight != s.framesInFlight) {
+        // Troca de N: aposenta todos os slots para recomeçar a rotação do zero
+        for (auto& slot : s.slots) retireSlot(s, slot);
+        s.framesInFlight = s.requestedFramesInFlight;
+    }
+    auto& slot = s.slots[getFrameSlot()];
+    retireSlot(s, slot);
+    if (s.gpuTiming && !s.timerActive) {
+        if (!slot.timerQuery) glGenQueries(1, &slot.timerQuery);
+        glBeginQuery(GL_TIME_ELAPSED, slot.timerQuery);
+        s.timerActive = true;
+    }
+}
+
+void endFrame() {
+    auto& s = state();
+    auto& slot = s.slots[getFrameSlot()];
+    if (s.timerActive) {
+        glEndQuery(GL_TIME_ELAPSED);
+        slot.timerPending = true;
+        s.timerActive = false;
+    }
+    if (slot.fence) glDeleteSync(slot.fence); // endFrame sem beginFrame correspondente
+    slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    {
+        std::scoped_lock lock(s.mutex);
+        slot.deletions.insert(slot.deletions.end(), s.pending.begin(), s.pending.end());
+        s.pending.clear();
+    }
+    ++s.frameIndex;
+}
+
+void deferDelete(ObjectType type, unsigned int id) {
+    if (!id) return;
+    auto& s = state();
+    std::scoped_lock lock(s.mutex);
+    s.pending.push_back(PendingObject{type, id});
+}
+
+void flushAll() {
+    auto& s = state();
+    if (s.timerActive) {
+        glEndQuery(GL_TIME_ELAPSED);
+        s.timerActive = false;
+    }
+    glFinish();
+    for (auto& slot : s.slots) {
+        retireSlot(s, slot);
+        if (slot.timerQuery) glDeleteQueries(1, &slot.timerQuery);
+        slot.timerQuery = 0;
+    }
+    std::vector<PendingObject> pending;
+    {
+        std::scoped_lock lock(s.mutex);
+        pending.swap(s.pending);
+        s.stats.deferredDeletes += pending.size();
+    }
+    for (const auto& o : pending) destroyObject(o);
+}
+
+void setGpuTimingEnabled(bool enabled) { state().gpuTiming = enabled; }
+
+float getGpuFrameTimeMs() { return state().gpuFrameMs; }
+
+Stats getStats() {
+    auto& s = state();
+    std::scoped_lock lock(s.mutex);
+    Stats out = s.stats;
+    out.pendingDeletes = static_cast<uint32_t>(s.pending.size());
+    for (const auto& slot : s.slots) out.pendingDeletes += static_cast<uint32_t>(slot.deletions.size());
+    return out;
+}
+
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+
+namespace Aurora::RHI::GLFrameSync {
+
+// Limite de frames em voo (CPU gravando à frente da GPU)
+inline constexpr uint32_t kMaxFramesInFlight = 3;
+
+enum class ObjectType : uint8_t { Buffer, Texture, Sampler, Program, Shader, VertexArray, Framebuffer, Renderbuffer };
+
+struct Stats {
+    uint64_t fenceWaits{0};        // beginFrame que precisaram bloquear na fence
+    double fenceWaitSeconds{0.0};  // tempo total bloqueado
+    uint64_t deferredDeletes{0};   // objetos destruídos via fila
+    uint32_t pendingDeletes{0};    // objetos aguardando fence
+};
+
+// Timer query GL_TIME_ELAPSED envolvendo cada frame (GL 3.3 / ARB_timer_query); ligado pelo GLDevice
+// após detectar as capacidades do contexto
+void setGpuTimingEnabled(bool enabled);
+// Tempo de GPU do último frame cujo slot foi aposentado (ms); 0 sem timer query ou antes do primeiro resultado
+float getGpuFrameTimeMs();
+
+// 1..kMaxFramesInFlight (padrão 2); aplicado a partir do próximo beginFrame
+void setFramesInFlight(uint32_t count);
+uint32_t getFramesInFlight();
+// Slot do frame corrente em [0, framesInFlight): índice para ring buffers por frame
+uint32_t getFrameSlot();
+uint64_t getFrameIndex();
+
+// Espera a fence do slot (frame N - framesInFlight) e destrói os objetos retidos por ele
+void beginFrame();
+// Insere a fence do frame e associa a ela as destruições pedidas desde o último endFrame
+void endFrame();
+
+// Agenda a destruição de um objeto GL; executada quando a GPU terminar os frames que podem referenciá-lo
+void deferDelete(ObjectType type, unsigned int id);
+
+// glFinish + destrói tudo imediatamente (antes de destruir o contexto)
+void flushAll();
+
+Stats getStats();
+
+}
@@ -1,11 +1,11 @@
 #include "GLGraphicsPipeline.hpp"
-#include <glad/glad.h>
+#include "GLFrameSync.hpp"
 
 namespace Aurora::RHI {
 
 GLGraphicsPipeline::~GLGraphicsPipeline() {
-    if (vao_) glDeleteVertexArrays(1, &vao_);
-    if (program_) glDeleteProgram(program_);
+    GLFrameSync::deferDelete(GLFrameSync::ObjectType::VertexArray, vao_);
+    GLFrameSync::deferDelete(GLFrameSync::ObjectType::Program, program_);
 }
 
 }
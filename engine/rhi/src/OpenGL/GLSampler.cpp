@@ -1,10 +1,10 @@
 #include "GLSampler.hpp"
-#include <glad/glad.h>
+#include "GLFrameSync.hpp"
 
 namespace Aurora::RHI {
 
 GLSampler::~GLSampler() {
-    if (id_) glDeleteSamplers(1, &id_);
+    GLFrameSync::deferDelete(GLFrameSync::ObjectType::Sampler, id_);
 }
 
 }
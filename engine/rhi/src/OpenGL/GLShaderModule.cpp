@@ -1,10 +1,10 @@
 #include "GLShaderModule.hpp"
-#include <glad/glad.h>
+#include "GLFrameSync.hpp"
 
 namespace Aurora::RHI {
 
 GLShaderModule::~GLShaderModule() {
-    if (id_) glDeleteShader(id_);
+    GLFrameSync::deferDelete(GLFrameSync::ObjectType::Shader, id_);
 }
 
 }
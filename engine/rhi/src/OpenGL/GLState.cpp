@@ -105,6 +105,17 @@ void applyPipelineState(const PipelineStateDesc& state) {
     g_cached.initialized = true;
 }
 
+void enableClearWrites(bool color, bool depth) {
+    if (depth && (!g_cached.initialized || !g_cached.depthWriteEnable)) {
+        glDepthMask(GL_TRUE);
+        g_cached.depthWriteEnable = true;
+    }
+    if (color && (!g_cached.initialized || g_cached.colorWriteMask != ColorWrite_All)) {
+        glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+        g_cached.colorWriteMask = ColorWrite_All;
+    }
+}
+
 void resetCache() {
     g_cached = CachedState{};
 }
@@ -28,6 +28,9 @@ int toGLBlendOp(BlendOp op);
 // Aplica estado com cache (shadowing) para reduzir chamadas redundantes
 void applyPipelineState(const PipelineStateDesc& state);
 
+// Clears respeitam as máscaras de escrita: reabilita as necessárias mantendo o cache coerente
+void enableClearWrites(bool color, bool depth);
+
 // Reseta cache (por troca de contexto, etc.)
 void resetCache();
 
@@ -0,0 +1,65 @@
+#include "GLSwapchain.hpp"
+#include "GLFrameSync.hpp"
+#include "Aurora/Core/Log.hpp"
+#include <glad/glad.h>
+
+namespace Aurora::RHI {
+
+GLSwapchain::~GLSwapchain() {
+    destroyOffscreenTargets();
+    // Contexto vai ser destruído: espera a GPU e executa todas as destruições pendentes
+    GLFrameSync::flushAll();
+#ifdef AURORA_RHI_HAS_EGL
+    context_.shutdown();
+#endif
+}
+
+void GLSwapchain::present() {
+#if defined(_WIN32) || defined(AURORA_RHI_HAS_EGL)
+    context_.swapBuffers();
+#endif
+}
+
+void GLSwapchain::resize(uint32_t width, uint32_t height) {
+    if (width == width_ && height == height_) return;
+    width_ = width;
+    height_ = height;
+    if (offscreenFBO_) {
+        destroyOffscreenTargets();
+        createOffscreenTargets();
+    }
+}
+
+bool GLSwapchain::createOffscreenTargets() {
+    const int w = static_cast<int>(width_ ? width_ : 1);
+    const int h = static_cast<int>(height_ ? height_ : 1);
+    glGenRenderbuffers(1, &colorRB_);
+    glBindRenderbuffer(0x8D41 /*GL_RENDERBUFFER*/, colorRB_);
+    glRenderbufferStorage(0x8D41 /*GL_RENDERBUFFER*/, 0x8058 /*GL_RGBA8*/, w, h);
+    glGenRenderbuffers(1, &depthRB_);
+    glBindRenderbuffer(0x8D41 /*GL_RENDERBUFFER*/, depthRB_);
+    glRenderbufferStorage(0x8D41 /*GL_RENDERBUFFER*/, 0x88F0 /*GL_DEPTH24_STENCIL8*/, w, h);
+    glBindRenderbuffer(0x8D41 /*GL_RENDERBUFFER*/, 0);
+
+    glGenFramebuffers(1, &offscreenFBO_);
+    glBindFramebuffer(0x8D40 /*GL_FRAMEBUFFER*/, offscreenFBO_);
+    glFramebufferRenderbuffer(0x8D40 /*GL_FRAMEBUFFER*/, 0x8CE0 /*GL_COLOR_ATTACHMENT0*/, 0x8D41 /*GL_RENDERBUFFER*/, colorRB_);
+    glFramebufferRenderbuffer(0x8D40 /*GL_FRAMEBUFFER*/, 0x821A /*GL_DEPTH_STENCIL_ATTACHMENT*/, 0x8D41 /*GL_RENDERBUFFER*/, depthRB_);
+    const unsigned int status = glCheckFramebufferStatus(0x8D40 /*GL_FRAMEBUFFER*/);
+    glBindFramebuffer(0x8D40 /*GL_FRAMEBUFFER*/, 0);
+    if (status != 0x8CD5 /*GL_FRAMEBUFFER_COMPLETE*/) {
+        Core::log(Core::LogLevel::Error, "Backbuffer offscreen incompleto");
+        destroyOffscreenTargets();
+        return false;
+    }
+    return true;
+}
+
+void GLSwapchain::destroyOffscreenTargets() {
+    // Frames em voo ainda podem apresentar a partir destes objetos (resize)
+    GLFrameSync::deferDelete(GLFrameSync::ObjectType::Framebuffer, offscreenFBO_); offscreenFBO_ = 0;
+    GLFrameSync::deferDelete(GLFrameSync::ObjectType::Renderbuffer, colorRB_); colorRB_ = 0;
+    GLFrameSync::deferDelete(GLFrameSync::ObjectType::Renderbuffer, depthRB_); depthRB_ = 0;
+}
+
+}
@@ -3,33 +3,47 @@
 #include "Aurora/RHI/RHI.hpp"
 #ifdef _WIN32
 #  include "WGLContext.hpp"
+#elif defined(AURORA_RHI_HAS_EGL)
+#  include "EGLGLContext.hpp"
 #endif
 
 namespace Aurora::RHI {
 
+// Swapchain GL. Sem janela nativa (EGL headless) o backbuffer é um FBO próprio (cor RGBA8 + depth24/stencil8)
 class GLSwapchain final : public ISwapchain {
 public:
     explicit GLSwapchain(uint32_t w, uint32_t h) : width_(w), height_(h) {}
+    ~GLSwapchain() override;
     void present() override;
-    void resize(uint32_t width, uint32_t height) override { width_ = width; height_ = height; }
+    void resize(uint32_t width, uint32_t height) override;
     uint32_t getWidth() const override { return width_; }
     uint32_t getHeight() const override { return height_; }
     void setVsync(bool enabled) override {
-#ifdef _WIN32
+#if defined(_WIN32) || defined(AURORA_RHI_HAS_EGL)
         context_.setVsync(enabled);
 #else
         (void)enabled;
 #endif
     }
 
+    // Cria o backbuffer offscreen (contexto já corrente)
+    bool createOffscreenTargets();
+    // FBO do backbuffer: 0 = framebuffer padrão da janela
+    unsigned int framebuffer() const { return offscreenFBO_; }
+
 #ifdef _WIN32
     WGLContext context_{};
+#elif defined(AURORA_RHI_HAS_EGL)
+    EGLGLContext context_{};
 #endif
 private:
+    void destroyOffscreenTargets();
+
     uint32_t width_{0};
     uint32_t height_{0};
+    unsigned int offscreenFBO_{0};
+    unsigned int colorRB_{0};
+    unsigned int depthRB_{0};
 };
 
 }
-
-
@@ -1,10 +1,12 @@
 #include "GLTexture.hpp"
-#include <glad/glad.h>
+#include "GLFrameSync.hpp"
+#include "../GpuMemoryTracking.hpp"
 
 namespace Aurora::RHI {
 
 GLTexture::~GLTexture() {
-    if (id_) glDeleteTextures(1, &id_);
+    untrackTextureMemory(desc_);
+    GLFrameSync::deferDelete(GLFrameSync::ObjectType::Texture, id_);
 }
 
 }
@@ -1,21 +1,63 @@
 #include "Aurora/RHI/RHI.hpp"
+#include "Aurora/RHI/StaticBackend.hpp"
 
 #include "Null/NullDevice.hpp"
 #include "OpenGL/GLDevice.hpp"
+#include "Aurora/Core/Log.hpp"
+#include "Aurora/Core/MemoryTracking.hpp"
+#ifdef AURORA_RHI_HAS_VULKAN
+#include "Vulkan/VulkanDevice.hpp"
+#endif
 
 namespace Aurora::RHI {
 
+#ifdef AURORA_RHI_STATIC_BACKEND
+
+std::unique_ptr<Backend::Device> Backend::createDevice(BackendType type) {
+    Core::MemoryTagScope memoryTag(Core::MemoryTag::RHI);
+    if (type != kType) Core::log(Core::LogLevel::Warn, "RHI compilado com backend estático; tipo solicitado ignorado");
+#if defined(AURORA_RHI_STATIC_BACKEND_VULKAN)
+    auto device = std::make_unique<VulkanDevice>();
+    if (device->initialize()) return device;
+    Core::log(Core::LogLevel::Error, "Falha ao inicializar Vulkan (backend estático, sem fallback)");
+    return nullptr;
+#else
+    return std::make_unique<Device>();
+#endif
+}
+
 std::unique_ptr<IDevice> createDevice(BackendType type) {
+    return Backend::createDevice(type);
+}
+
+#else
+
+std::unique_ptr<IDevice> createDevice(BackendType type) {
+    Core::MemoryTagScope memoryTag(Core::MemoryTag::RHI);
     switch (type) {
         case BackendType::Null:
             return std::make_unique<NullDevice>();
         case BackendType::OpenGL:
             return std::make_unique<GLDevice>();
+        case BackendType::Vulkan: {
+#ifdef AURORA_RHI_HAS_VULKAN
+            auto device = std::make_unique<VulkanDevice>();
+            if (device->initialize()) return device;
+            Core::log(Core::LogLevel::Error, "Falha ao inicializar Vulkan; usando NullDevice");
+#else
+            Core::log(Core::LogLevel::Error, "Backend Vulkan não compilado (AURORA_RHI_VULKAN=OFF); usando NullDevice");
+#endif
+            return std::make_unique<NullDevice>();
+        }
         default:
             return std::make_unique<NullDevice>();
     }
 }
 
+std::unique_ptr<Backend::Device> Backend::createDevice(BackendType type) {
+    return RHI::createDevice(type);
 }
 
+#endif
 
+}
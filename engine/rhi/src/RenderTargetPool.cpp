@@ -0,0 +1,95 @@
+#include "Aurora/RHI/RenderTargetPool.hpp"
+#include "Aurora/RHI/Device.hpp"
+#include "Aurora/Core/Log.hpp"
+
+#include <string>
+
+namespace Aurora::RHI {
+
+ITexture* RenderTargetPool::acquire(const TextureDesc& desc) {
+    ++stats_.acquireCount;
+    auto& bucket = buckets_[desc];
+    // Prefere a entrada livre usada mais recentemente: as antigas envelhecem e são liberadas
+    Entry* best = nullptr;
+    for (auto& e : bucket) {
+        if (!e.inUse && (!best || e.lastUsedFrame > best->lastUsedFrame)) best = &e;
+    }
+    if (best) {
+        ++stats_.reuseCount;
+    } else {
+        auto texture = device_.createTexture(desc, nullptr);
+        if (!texture) {
+            Core::log(Core::LogLevel::Error, "RenderTargetPool: falha ao criar textura " + std::to_string(desc.width) + "x" + std::to_string(desc.height));
+            return nullptr;
+        }
+        ++stats_.allocationCount;
+        ++stats_.textureCount;
+        stats_.pooledBytes += estimateTextureBytes(desc);
+        bucket.push_back(Entry{std::move(texture), frame_, false});
+        best = &bucket.back();
+    }
+    best->inUse = true;
+    best->lastUsedFrame = frame_;
+    ++stats_.inUseCount;
+    stats_.inUseBytes += estimateTextureBytes(desc);
+    inUse_[best->texture.get()] = desc;
+    return best->texture.get();
+}
+
+void RenderTargetPool::release(ITexture* texture) {
+    if (!texture) return;
+    auto it = inUse_.find(texture);
+    if (it == inUse_.end()) {
+        Core::log(Core::LogLevel::Warn, "RenderTargetPool: release de textura que não está em uso");
+        return;
+    }
+    auto& bucket = buckets_[it->second];
+    for (auto& e : bucket) {
+        if (e.texture.get() != texture) continue;
+        e.inUse = false;
+        e.lastUsedFrame = frame_;
+        break;
+    }
+    --stats_.inUseCount;
+    stats_.inUseBytes -= estimateTextureBytes(it->second);
+    inUse_.erase(it);
+}
+
+void RenderTargetPool::endFrame() {
+    ++frame_;
+    evict(true);
+}
+
+void RenderTargetPool::trim() {
+    evict(false);
+}
+
+void RenderTargetPool::clear() {
+    if (!inUse_.empty()) {
+        Core::log(Core::LogLevel::Warn, "RenderTargetPool: clear com " + std::to_string(inUse_.size()) + " texturas em uso");
+    }
+    evict(false);
+}
+
+void RenderTargetPool::evict(bool onlyStale) {
+    for (auto it = buckets_.begin(); it != buckets_.end();) {
+        auto& bucket = it->second;
+        const uint64_t bytes = estimateTextureBytes(it->first);
+        for (size_t i = 0; i < bucket.size();) {
+            const Entry& e = bucket[i];
+            const bool stale = frame_ - e.lastUsedFrame > maxUnusedFrames_;
+            if (!e.inUse && (!onlyStale || stale)) {
+                bucket[i] = std::move(bucket.back());
+                bucket.pop_back();
+                ++stats_.evictionCount;
+                --stats_.textureCount;
+                stats_.pooledBytes -= bytes;
+                continue;
+            }
+            ++i;
+        }
+        it = bucket.empty() ? buckets_.erase(it) : std::next(it);
+    }
+}
+
+}
@@ -0,0 +1,227 @@
+#include "Aurora/RHI/ResourceRegistry.hpp"
+#include "Aurora/RHI/Device.hpp"
+#include "Aurora/Core/Log.hpp"
+
+#include <cstdio>
+#include <string>
+
+namespace Aurora::RHI {
+
+// Handle nulo é "sem recurso" (como nullptr) e não conta como acesso velho
+void ResourceRegistry::reportStale(const char* kind, uint32_t handleValue) const {
+    if (handleValue == 0) return;
+    ++staleAccessCount_;
+#ifdef AURORA_DEBUG
+    char text[96];
+    std::snprintf(text, sizeof(text), "ResourceRegistry: handle de %s velho (0x%08X)", kind, handleValue);
+    Core::log(Core::LogLevel::Warn, text);
+#else
+    (void)kind;
+#endif
+}
+
+// Criação
+
+BufferHandle ResourceRegistry::createBuffer(const void* data, size_t bytes, BufferUsage usage, BufferUpdate update) {
+    return adopt(device_.createBuffer(data, bytes, usage, update));
+}
+
+TextureHandle ResourceRegistry::createTexture(const TextureDesc& desc, const void* initialPixelsRGBA8) {
+    return adopt(device_.createTexture(desc, initialPixelsRGBA8));
+}
+
+SamplerHandle ResourceRegistry::createSampler(const SamplerDesc& desc) {
+    return adopt(device_.createSampler(desc));
+}
+
+ShaderModuleHandle ResourceRegistry::createShaderModule(const ShaderModuleDesc& desc) {
+    return adopt(device_.createShaderModule(desc));
+}
+
+GraphicsPipelineHandle ResourceRegistry::createGraphicsPipeline(const GraphicsPipelineDesc& desc) {
+    return adopt(device_.createGraphicsPipeline(desc));
+}
+
+ComputePipelineHandle ResourceRegistry::createComputePipeline(const ComputePipelineDesc& desc) {
+    return adopt(device_.createComputePipeline(desc));
+}
+
+DescriptorSetHandle ResourceRegistry::createDescriptorSet(const DescriptorSetDesc& desc) {
+    return adopt(device_.createDescriptorSet(desc));
+}
+
+// Adoção: o device já logou a falha quando o objeto é nulo
+
+BufferHandle ResourceRegistry::adopt(std::unique_ptr<IBuffer> buffer) {
+    if (!buffer) return {};
+    const size_t size = buffer->getSize();
+    const BufferUsage usage = buffer->getUsage();
+    return buffers_.create(std::move(buffer), size, usage);
+}
+
+TextureHandle ResourceRegistry::adopt(std::unique_ptr<ITexture> texture) {
+    if (!texture) return {};
+    const TextureDesc desc = texture->getDesc();
+    return textures_.create(std::move(texture), desc);
+}
+
+SamplerHandle ResourceRegistry::adopt(std::unique_ptr<ISampler> sampler) {
+    if (!sampler) return {};
+    return samplers_.create(std::move(sampler));
+}
+
+ShaderModuleHandle ResourceRegistry::adopt(std::unique_ptr<IShaderModule> module) {
+    if (!module) return {};
+    const ShaderStage stage = module->getStage();
+    return shaderModules_.create(std::move(module), stage);
+}
+
+GraphicsPipelineHandle ResourceRegistry::adopt(std::unique_ptr<IGraphicsPipeline> pipeline) {
+    if (!pipeline) return {};
+    return graphicsPipelines_.create(std::move(pipeline));
+}
+
+ComputePipelineHandle ResourceRegistry::adopt(std::unique_ptr<IComputePipeline> pipeline) {
+    if (!pipeline) return {};
+    return computePipelines_.create(std::move(pipeline));
+}
+
+DescriptorSetHandle ResourceRegistry::adopt(std::unique_ptr<IDescriptorSet> set) {
+    if (!set) return {};
+    return descriptorSets_.create(std::move(set));
+}
+
+// Resolução
+
+IBuffer* ResourceRegistry::get(BufferHandle handle) const {
+    if (auto* slot = buffers_.get<0>(handle)) return slot->get();
+    reportStale("buffer", handle.value);
+    return nullptr;
+}
+
+ITexture* ResourceRegistry::get(TextureHandle handle) const {
+    if (auto* slot = textures_.get<0>(handle)) return slot->get();
+    reportStale("textura", handle.value);
+    return nullptr;
+}
+
+ISampler* ResourceRegistry::get(SamplerHandle handle) const {
+    if (auto* slot = samplers_.get<0>(handle)) return slot->get();
+    reportStale("sampler", handle.value);
+    return nullptr;
+}
+
+IShaderModule* ResourceRegistry::get(ShaderModuleHandle handle) const {
+    if (auto* slot = shaderModules_.get<0>(handle)) return slot->get();
+    reportStale("shader", handle.value);
+    return nullptr;
+}
+
+IGraphicsPipeline* ResourceRegistry::get(GraphicsPipelineHandle handle) const {
+    if (auto* slot = graphicsPipelines_.get<0>(handle)) return slot->get();
+    reportStale("pipeline gráfico", handle.value);
+    return nullptr;
+}
+
+IComputePipeline* ResourceRegistry::get(ComputePipelineHandle handle) const {
+    if (auto* slot = computePipelines_.get<0>(handle)) return slot->get();
+    reportStale("pipeline compute", handle.value);
+    return nullptr;
+}
+
+IDescriptorSet* ResourceRegistry::get(DescriptorSetHandle handle) const {
+    if (auto* slot = descriptorSets_.get<0>(handle)) return slot->get();
+    reportStale("descriptor set", handle.value);
+    return nullptr;
+}
+
+size_t ResourceRegistry::getBufferSize(BufferHandle handle) const {
+    const size_t* size = buffers_.get<1>(handle);
+    return size ? *size : 0;
+}
+
+const TextureDesc* ResourceRegistry::getTextureDesc(TextureHandle handle) const {
+    return textures_.get<1>(handle);
+}
+
+bool ResourceRegistry::updateBuffer(BufferHandle handle, const void* data, size_t bytes, size_t dstOffset) {
+    IBuffer* buffer = get(handle);
+    if (!buffer) return false;
+    const size_t size = *buffers_.get<1>(handle);
+    if (dstOffset > size || bytes > size - dstOffset) {
+        Core::log(Core::LogLevel::Error, "ResourceRegistry::updateBuffer: escrita fora do buffer ("
+            + std::to_string(dstOffset) + "+" + std::to_string(bytes) + " > " + std::to_string(size) + ")");
+        return false;
+    }
+    device_.updateBuffer(buffer, data, bytes, dstOffset);
+    return true;
+}
+
+// Destruição
+
+bool ResourceRegistry::destroy(BufferHandle handle) {
+    if (buffers_.destroy(handle)) return true;
+    reportStale("buffer", handle.value);
+    return false;
+}
+
+bool ResourceRegistry::destroy(TextureHandle handle) {
+    if (textures_.destroy(handle)) return true;
+    reportStale("textura", handle.value);
+    return false;
+}
+
+bool ResourceRegistry::destroy(SamplerHandle handle) {
+    if (samplers_.destroy(handle)) return true;
+    reportStale("sampler", handle.value);
+    return false;
+}
+
+bool ResourceRegistry::destroy(ShaderModuleHandle handle) {
+    if (shaderModules_.destroy(handle)) return true;
+    reportStale("shader", handle.value);
+    return false;
+}
+
+bool ResourceRegistry::destroy(GraphicsPipelineHandle handle) {
+    if (graphicsPipelines_.destroy(handle)) return true;
+    reportStale("pipeline gráfico", handle.value);
+    return false;
+}
+
+bool ResourceRegistry::destroy(ComputePipelineHandle handle) {
+    if (computePipelines_.destroy(handle)) return true;
+    reportStale("pipeline compute", handle.value);
+    return false;
+}
+
+bool ResourceRegistry::destroy(DescriptorSetHandle handle) {
+    if (descriptorSets_.destroy(handle)) return true;
+    reportStale("descriptor set", handle.value);
+    return false;
+}
+
+void ResourceRegistry::clear() {
+    // Dependentes primeiro: sets referenciam buffers/texturas/samplers, pipelines referenciam shaders
+    descriptorSets_.clear();
+    computePipelines_.clear();
+    graphicsPipelines_.clear();
+    shaderModules_.clear();
+    samplers_.clear();
+    textures_.clear();
+    buffers_.clear();
+}
+
+ResourceRegistryStats ResourceRegistry::getStats() const {
+    ResourceRegistryStats s{};
+    s.bufferCount = buffers_.size();
+    s.textureCount = textures_.size();
+    s.samplerCount = samplers_.size();
+    s.shaderModuleCount = shaderModules_.size();
+    s.pipelineCount = graphicsPipelines_.size() + computePipelines_.size();
+    s.descriptorSetCount = descriptorSets_.size();
+    s.staleAccessCount = staleAccessCount_;
+    return s;
+}
+
+}
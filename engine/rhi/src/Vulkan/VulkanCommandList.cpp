@@ -0,0 +1,410 @@
+#include "VulkanCommandList.hpp"
+#include "VulkanDevice.hpp"
+#include "VulkanResources.hpp"
+#include "VulkanSwapchain.hpp"
+#include "VulkanConversions.hpp"
+#include "../CommandBundle.hpp"
+#include "Aurora/Core/Log.hpp"
+
+#include <algorithm>
+#include <vector>
+
+namespace Aurora::RHI {
+
+VulkanCommandList::VulkanCommandList(VulkanDevice& device) : device_(device), wireframe_(device.defaultWireframe()) {}
+
+void VulkanCommandList::begin() {
+    cmd_ = device_.acquireCommandBuffer();
+    if (!cmd_) return;
+    VkCommandBufferBeginInfo bi{VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO};
+    bi.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    vkCheck(vkBeginCommandBuffer(cmd_, &bi), "vkBeginCommandBuffer");
+    recording_ = true;
+    pipeline_ = nullptr;
+    computePipeline_ = nullptr;
+    descriptorSet_ = nullptr;
+    indexBuffer_ = nullptr;
+    stateDirty_ = true;
+    activeRenderPass_ = VK_NULL_HANDLE;
+    activeColorCount_ = 0;
+    boundPipeline_ = VK_NULL_HANDLE;
+    boundSet_ = VK_NULL_HANDLE;
+    boundIndexBuffer_ = VK_NULL_HANDLE;
+    boundComputePipeline_ = VK_NULL_HANDLE;
+    boundComputeSet_ = VK_NULL_HANDLE;
+}
+
+void VulkanCommandList::end() {
+    if (!recording_) return;
+    if (activeRenderPass_) {
+        Core::log(Core::LogLevel::Warn, "Vulkan: end() com render pass aberto; encerrando");
+        endRenderPass();
+    }
+    vkCheck(vkEndCommandBuffer(cmd_), "vkEndCommandBuffer");
+    recording_ = false;
+}
+
+void VulkanCommandList::beginRenderPass(IRenderPass* renderPass, ISwapchain* target) {
+    if (!recording_ || !renderPass) return;
+    if (activeRenderPass_) endRenderPass();
+    const auto& d = static_cast<VulkanRenderPass*>(renderPass)->desc_;
+    VkDevice dev = device_.vkDevice();
+
+    VulkanRenderPassKey key{};
+    std::vector<VkImageView> views;
+    pendingResolves_.clear();
+    VkExtent2D extent{0, 0};
+
+    if (!d.colorAttachments.empty() || d.depthAttachment.texture) {
+        key.colorFinalLayout = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        auto attachView = [&](const RenderPassDesc::Attachment& a, bool depth) {
+            auto* tex = static_cast<VulkanTexture*>(a.texture);
+            auto td = tex->getDesc();
+            VkImageView view = tex->view_;
+            // Framebuffers exigem views de um único mip (e com depth+stencil juntos); a view_ da textura
+            // é a de amostragem, então criamos uma view transitória quando necessário
+            const bool stencil = depth && VulkanConversions::hasStencil(td.format);
+            if (td.mipLevels > 1 || stencil) {
+                VkImageViewCreateInfo vi{VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO};
+                vi.image = tex->image_;
+                vi.viewType = VK_IMAGE_VIEW_TYPE_2D;
+                vi.format = tex->format_;
+                vi.subresourceRange.aspectMask = depth ? VK_IMAGE_ASPECT_DEPTH_BIT : VK_IMAGE_ASPECT_COLOR_BIT;
+                if (stencil) vi.subresourceRange.aspectMask |= VK_IMAGE_ASPECT_STENCIL_BIT;
+                vi.subresourceRange.baseMipLevel = a.mipLevel;
+                vi.subresourceRange.levelCount = 1;
+                vi.subresourceRange.layerCount = 1;
+                if (vkCheck(vkCreateImageView(dev, &vi, nullptr, &view), "vkCreateImageView(mip)")) {
+                    device_.deferDestroy([dev, view] { vkDestroyImageView(dev, view, nullptr); });
+                }
+            }
+            views.push_back(view);
+            if (extent.width == 0) {
+                extent.width = td.width >> a.mipLevel; if (extent.width == 0) extent.width = 1;
+                extent.height = td.height >> a.mipLevel; if (extent.height == 0) extent.height = 1;
+            }
+            return tex->format_;
+        };
+        // Resolve vira uma cópia após o pass (não há origem multisample no RHI)
+        auto queueResolve = [&](const RenderPassDesc::Attachment& a, bool depth) {
+            if (a.store != StoreAction::Resolve) return;
+            if (!a.resolveTarget) { Core::log(Core::LogLevel::Warn, "Vulkan: StoreAction::Resolve sem resolveTarget"); return; }
+            pendingResolves_.push_back({static_cast<VulkanTexture*>(a.texture), a.mipLevel, static_cast<VulkanTexture*>(a.resolveTarget), depth});
+        };
+        for (const auto& a : d.colorAttachments) {
+            if (!a.texture) continue;
+            key.colorFormats.push_back(attachView(a, false));
+            key.colorLoads.push_back(VulkanConversions::toVkLoadOp(a.load));
+            key.colorStores.push_back(VulkanConversions::toVkStoreOp(a.store));
+            queueResolve(a, false);
+        }
+        if (d.depthAttachment.texture) {
+            key.depthFormat = attachView(d.depthAttachment, true);
+            key.depthLoad = VulkanConversions::toVkLoadOp(d.depthAttachment.load);
+            key.depthStore = VulkanConversions::toVkStoreOp(d.depthAttachment.store);
+            queueResolve(d.depthAttachment, true);
+        }
+    } else if (target) {
+        auto* sc = static_cast<VulkanSwapchain*>(target);
+        if (!sc->acquire()) return; // janela minimizada ou swapchain indisponível
+        device_.registerSwapchainUse(sc);
+        if (d.swapchainColorLoad == LoadAction::Load) sc->prepareColorForLoad(cmd_);
+        key.colorFormats.push_back(sc->colorFormat());
+        key.colorLoads.push_back(VulkanConversions::toVkLoadOp(d.swapchainColorLoad));
+        key.colorStores.push_back(VulkanConversions::toVkStoreOp(d.swapchainColorStore));
+        key.depthFormat = sc->depthFormat();
+        key.depthLoad = VulkanConversions::toVkLoadOp(d.swapchainDepthLoad);
+        key.depthStore = VulkanConversions::toVkStoreOp(d.swapchainDepthStore);
+        key.colorFinalLayout = sc->finalLayout();
+        key.depthFinalLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+        views.push_back(sc->currentView());
+        views.push_back(sc->depthView());
+        extent = sc->extent();
+    } else {
+        Core::log(Core::LogLevel::Error, "Vulkan: render pass sem attachments e sem swapchain");
+        return;
+    }
+
+    VkRenderPass pass = device_.getOrCreateRenderPass(key);
+    if (!pass) return;
+
+    // Framebuffer transitório por pass (como o FBO do backend GL), destruído após o frame
+    VkFramebufferCreateInfo fi{VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO};
+    fi.renderPass = pass;
+    fi.attachmentCount = static_cast<uint32_t>(views.size());
+    fi.pAttachments = views.data();
+    fi.width = extent.width;
+    fi.height = extent.height;
+    fi.layers = 1;
+    VkFramebuffer framebuffer = VK_NULL_HANDLE;
+    if (!vkCheck(vkCreateFramebuffer(dev, &fi, nullptr, &framebuffer), "vkCreateFramebuffer")) return;
+    device_.deferDestroy([dev, framebuffer] { vkDestroyFramebuffer(dev, framebuffer, nullptr); });
+
+    std::vector<VkClearValue> clears(views.size());
+    for (size_t i = 0; i < key.colorFormats.size(); ++i) {
+        for (int c = 0; c < 4; ++c) clears[i].color.float32[c] = d.clearColor[c];
+    }
+    if (key.depthFormat != VK_FORMAT_UNDEFINED) {
+        clears.back().depthStencil = {d.clearDepth, 0};
+    }
+
+    VkRenderPassBeginInfo bi{VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO};
+    bi.renderPass = pass;
+    bi.framebuffer = framebuffer;
+    bi.renderArea.extent = extent;
+    bi.clearValueCount = static_cast<uint32_t>(clears.size());
+    bi.pClearValues = clears.data();
+    vkCmdBeginRenderPass(cmd_, &bi, VK_SUBPASS_CONTENTS_INLINE);
+
+    // Y invertido (altura negativa) para manter a convenção de NDC do backend GL
+    VkViewport vp{};
+    vp.x = 0.0f;
+    vp.y = static_cast<float>(extent.height);
+    vp.width = static_cast<float>(extent.width);
+    vp.height = -static_cast<float>(extent.height);
+    vp.minDepth = 0.0f;
+    vp.maxDepth = 1.0f;
+    vkCmdSetViewport(cmd_, 0, 1, &vp);
+    VkRect2D scissor{{0, 0}, extent};
+    vkCmdSetScissor(cmd_, 0, 1, &scissor);
+
+    activeRenderPass_ = pass;
+    activeColorCount_ = static_cast<uint32_t>(key.colorFormats.size());
+    boundPipeline_ = VK_NULL_HANDLE;
+    boundSet_ = VK_NULL_HANDLE;
+    stateDirty_ = true;
+}
+
+void VulkanCommandList::endRenderPass() {
+    if (!recording_ || !activeRenderPass_) return;
+    vkCmdEndRenderPass(cmd_);
+    activeRenderPass_ = VK_NULL_HANDLE;
+    activeColorCount_ = 0;
+    for (const auto& r : pendingResolves_) resolveBlit(r);
+    pendingResolves_.clear();
+}
+
+void VulkanCommandList::resolveBlit(const PendingResolve& r) {
+    // Origem sai do pass no layout final do render pass; destino é sobrescrito por inteiro
+    const VkImageLayout srcLayout = r.depth ? VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL : VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    VkImageAspectFlags aspect = r.depth ? VK_IMAGE_ASPECT_DEPTH_BIT : VK_IMAGE_ASPECT_COLOR_BIT;
+    if (r.depth && VulkanConversions::hasStencil(r.src->getDesc().format)) aspect |= VK_IMAGE_ASPECT_STENCIL_BIT;
+
+    VkImageMemoryBarrier b[2]{};
+    for (auto& x : b) {
+        x.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
+        x.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        x.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    }
+    b[0].image = r.src->image_;
+    b[0].oldLayout = srcLayout;
+    b[0].newLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+    b[0].srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+    b[0].dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+    b[0].subresourceRange = {aspect, r.srcMip, 1, 0, 1};
+    b[1].image = r.dst->image_;
+    b[1].oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    b[1].newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    b[1].dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    b[1].subresourceRange = {aspect, 0, 1, 0, 1};
+    vkCmdPipelineBarrier(cmd_, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+                         VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 0, nullptr, 0, nullptr, 2, b);
+
+    const auto sd = r.src->getDesc();
+    const auto dd = r.dst->getDesc();
+    VkImageBlit blit{};
+    blit.srcSubresource = {aspect, r.srcMip, 0, 1};
+    blit.srcOffsets[1] = {static_cast<int32_t>(std::max(1u, sd.width >> r.srcMip)), static_cast<int32_t>(std::max(1u, sd.height >> r.srcMip)), 1};
+    blit.dstSubresource = {aspect, 0, 0, 1};
+    blit.dstOffsets[1] = {static_cast<int32_t>(dd.width), static_cast<int32_t>(dd.height), 1};
+    vkCmdBlitImage(cmd_, r.src->image_, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, r.dst->image_, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &blit, VK_FILTER_NEAREST);
+
+    b[0].oldLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+    b[0].newLayout = srcLayout;
+    b[0].srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+    b[0].dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+    b[1].oldLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+    b[1].newLayout = r.dst->restingLayout_;
+    b[1].srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    b[1].dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+    vkCmdPipelineBarrier(cmd_, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT, 0, 0, nullptr, 0, nullptr, 2, b);
+}
+
+void VulkanCommandList::setGraphicsPipeline(IGraphicsPipeline* pipeline) {
+    auto* p = static_cast<VulkanGraphicsPipeline*>(pipeline);
+    if (p != pipeline_) { pipeline_ = p; stateDirty_ = true; }
+}
+
+void VulkanCommandList::setVertexBuffer(IBuffer* buffer) {
+    if (!recording_ || !buffer) return;
+    auto* vb = static_cast<VulkanBuffer*>(buffer);
+    VkDeviceSize offset = 0;
+    vkCmdBindVertexBuffers(cmd_, 0, 1, &vb->buffer_, &offset);
+}
+
+void VulkanCommandList::setIndexBuffer(IBuffer* buffer) {
+    indexBuffer_ = static_cast<VulkanBuffer*>(buffer);
+}
+
+void VulkanCommandList::bindDescriptorSet(IDescriptorSet* set, std::span<const uint32_t> dynamicOffsets) {
+    auto* s = static_cast<VulkanDescriptorSet*>(set);
+    if (s && dynamicOffsets.size() != s->dynamicCount_) {
+        Core::log(Core::LogLevel::Error, "Vulkan: número de offsets dinâmicos incompatível com o set");
+        return;
+    }
+    const bool sameOffsets = std::equal(dynamicOffsets.begin(), dynamicOffsets.end(), dynamicOffsets_.begin(), dynamicOffsets_.end());
+    if (s != descriptorSet_ || !sameOffsets) {
+        descriptorSet_ = s;
+        dynamicOffsets_.assign(dynamicOffsets.begin(), dynamicOffsets.end());
+        stateDirty_ = true;
+    }
+}
+
+bool VulkanCommandList::flushGraphicsState() {
+    if (!recording_ || !activeRenderPass_ || !pipeline_) return false;
+    if (!stateDirty_) return boundPipeline_ != VK_NULL_HANDLE;
+
+    VkDescriptorSetLayout setLayout = descriptorSet_ ? descriptorSet_->layout_ : device_.emptySetLayout();
+    if (setLayout != cachedSetLayout_ || !cachedPipelineLayout_) {
+        cachedPipelineLayout_ = device_.getOrCreatePipelineLayout(setLayout);
+        cachedSetLayout_ = setLayout;
+        boundSet_ = VK_NULL_HANDLE;
+    }
+    VkPipeline pipeline = pipeline_->getOrCreate(activeRenderPass_, activeColorCount_, cachedPipelineLayout_, wireframe_);
+    if (!pipeline) return false;
+    if (pipeline != boundPipeline_) {
+        vkCmdBindPipeline(cmd_, VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline);
+        boundPipeline_ = pipeline;
+    }
+    // Mudar só o offset dinâmico rebinda o mesmo set (barato: sem escrita de descriptors)
+    if (descriptorSet_ && (descriptorSet_->set_ != boundSet_ || dynamicOffsets_ != boundDynamicOffsets_)) {
+        vkCmdBindDescriptorSets(cmd_, VK_PIPELINE_BIND_POINT_GRAPHICS, cachedPipelineLayout_, 0, 1, &descriptorSet_->set_,
+            static_cast<uint32_t>(dynamicOffsets_.size()), dynamicOffsets_.data());
+        boundSet_ = descriptorSet_->set_;
+        boundDynamicOffsets_ = dynamicOffsets_;
+    }
+    stateDirty_ = false;
+    return true;
+}
+
+void VulkanCommandList::draw(uint32_t vertexCount, uint32_t firstVertex) {
+    drawInstanced(vertexCount, firstVertex, 1, 0);
+}
+
+void VulkanCommandList::drawIndexed(uint32_t indexCount, uint32_t firstIndex, IndexType indexType) {
+    drawIndexedInstanced(indexCount, firstIndex, indexType, 1, 0);
+}
+
+void VulkanCommandList::setInstanceBuffer(IBuffer* buffer) {
+    if (!recording_ || !buffer) return;
+    auto* ib = static_cast<VulkanBuffer*>(buffer);
+    VkDeviceSize offset = 0;
+    vkCmdBindVertexBuffers(cmd_, 1, 1, &ib->buffer_, &offset);
+}
+
+void VulkanCommandList::drawInstanced(uint32_t vertexCount, uint32_t firstVertex, uint32_t instanceCount, uint32_t firstInstance) {
+    if (!flushGraphicsState()) return;
+    vkCmdDraw(cmd_, vertexCount, instanceCount, firstVertex, firstInstance);
+}
+
+void VulkanCommandList::drawIndexedInstanced(uint32_t indexCount, uint32_t firstIndex, IndexType indexType, uint32_t instanceCount, uint32_t firstInstance) {
+    if (!indexBuffer_ || !flushGraphicsState()) return;
+    VkIndexType type = (indexType == IndexType::Uint16) ? VK_INDEX_TYPE_UINT16 : VK_INDEX_TYPE_UINT32;
+    if (indexBuffer_->buffer_ != boundIndexBuffer_ || type != boundIndexType_) {
+        vkCmdBindIndexBuffer(cmd_, indexBuffer_->buffer_, 0, type);
+        boundIndexBuffer_ = indexBuffer_->buffer_;
+        boundIndexType_ = type;
+    }
+    vkCmdDrawIndexed(cmd_, indexCount, instanceCount, firstIndex, 0, firstInstance);
+}
+
+void VulkanCommandList::setComputePipeline(IComputePipeline* pipeline) {
+    computePipeline_ = static_cast<VulkanComputePipeline*>(pipeline);
+}
+
+bool VulkanCommandList::flushComputeState() {
+    if (!recording_ || !computePipeline_) return false;
+    if (activeRenderPass_) {
+        Core::log(Core::LogLevel::Warn, "Vulkan: dispatch dentro de render pass ignorado");
+        return false;
+    }
+    VkDescriptorSetLayout setLayout = descriptorSet_ ? descriptorSet_->layout_ : device_.emptySetLayout();
+    VkPipelineLayout layout = device_.getOrCreatePipelineLayout(setLayout);
+    VkPipeline pipeline = computePipeline_->getOrCreate(layout);
+    if (!pipeline) return false;
+    if (pipeline != boundComputePipeline_) {
+        vkCmdBindPipeline(cmd_, VK_PIPELINE_BIND_POINT_COMPUTE, pipeline);
+        boundComputePipeline_ = pipeline;
+        boundComputeSet_ = VK_NULL_HANDLE;
+    }
+    if (descriptorSet_ && (descriptorSet_->set_ != boundComputeSet_ || dynamicOffsets_ != boundComputeDynamicOffsets_)) {
+        vkCmdBindDescriptorSets(cmd_, VK_PIPELINE_BIND_POINT_COMPUTE, layout, 0, 1, &descriptorSet_->set_,
+            static_cast<uint32_t>(dynamicOffsets_.size()), dynamicOffsets_.data());
+        boundComputeSet_ = descriptorSet_->set_;
+        boundComputeDynamicOffsets_ = dynamicOffsets_;
+    }
+    return true;
+}
+
+void VulkanCommandList::dispatch(uint32_t groupsX, uint32_t groupsY, uint32_t groupsZ) {
+    if (!flushComputeState()) return;
+    vkCmdDispatch(cmd_, groupsX, groupsY, groupsZ);
+}
+
+void VulkanCommandList::dispatchIndirect(IBuffer* buffer, size_t offset) {
+    if (!buffer || !flushComputeState()) return;
+    vkCmdDispatchIndirect(cmd_, static_cast<VulkanBuffer*>(buffer)->buffer_, offset);
+}
+
+void VulkanCommandList::memoryBarrier(uint32_t barriers) {
+    if (!recording_ || !barriers) return;
+    if (activeRenderPass_) {
+        Core::log(Core::LogLevel::Warn, "Vulkan: memoryBarrier dentro de render pass ignorado");
+        return;
+    }
+    const VkPipelineStageFlags shaderStages = VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT;
+    VkPipelineStageFlags dstStages = 0;
+    VkAccessFlags dstAccess = 0;
+    if (barriers & (Barrier_StorageBuffer | Barrier_StorageTexture)) {
+        dstStages |= shaderStages;
+        dstAccess |= VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_SHADER_WRITE_BIT;
+    }
+    if (barriers & Barrier_VertexIndex) {
+        dstStages |= VK_PIPELINE_STAGE_VERTEX_INPUT_BIT;
+        dstAccess |= VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_INDEX_READ_BIT;
+    }
+    if (barriers & Barrier_Indirect) {
+        dstStages |= VK_PIPELINE_STAGE_DRAW_INDIRECT_BIT;
+        dstAccess |= VK_ACCESS_INDIRECT_COMMAND_READ_BIT;
+    }
+    if (barriers & Barrier_Uniform) {
+        dstStages |= shaderStages;
+        dstAccess |= VK_ACCESS_UNIFORM_READ_BIT;
+    }
+    if (barriers & Barrier_Sampled) {
+        dstStages |= shaderStages;
+        dstAccess |= VK_ACCESS_SHADER_READ_BIT;
+    }
+    // Texturas de storage ficam em GENERAL: basta uma barreira de memória global (sem transição de layout)
+    VkMemoryBarrier mb{VK_STRUCTURE_TYPE_MEMORY_BARRIER};
+    mb.srcAccessMask = VK_ACCESS_SHADER_WRITE_BIT;
+    mb.dstAccessMask = dstAccess;
+    vkCmdPipelineBarrier(cmd_, VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, dstStages, 0, 1, &mb, 0, nullptr, 0, nullptr);
+}
+
+void VulkanCommandList::executeBundle(ICommandBundle* bundle) {
+    // Pipelines dependem do render pass ativo: reproduzimos o stream já compactado em vez de usar
+    // secondary command buffers
+    if (!bundle || !bundle->isValid()) return;
+    static_cast<RecordedCommandBundle*>(bundle)->replay(*this);
+}
+
+void VulkanCommandList::setDebugWireframe(bool enable) {
+    if (enable && !device_.supportsWireframe()) {
+        Core::log(Core::LogLevel::Warn, "Vulkan: fillModeNonSolid indisponível; ignorando wireframe");
+        return;
+    }
+    if (wireframe_ != enable) { wireframe_ = enable; stateDirty_ = true; }
+}
+
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "Aurora/RHI/RHI.hpp"
+#include "VulkanCommon.hpp"
+
+#include <vector>
+
+namespace Aurora::RHI {
+
+class VulkanDevice; // fwd
+class VulkanGraphicsPipeline;
+class VulkanComputePipeline;
+class VulkanDescriptorSet;
+class VulkanBuffer;
+class VulkanTexture;
+
+// Grava diretamente num VkCommandBuffer do pool da thread chamadora (gravação multithread real).
+// O VkPipeline concreto é resolvido no draw, quando render pass e layout de descriptors são conhecidos.
+class VulkanCommandList final : public ICommandList {
+public:
+    explicit VulkanCommandList(VulkanDevice& device);
+    void begin() override;
+    void end() override;
+    void beginRenderPass(IRenderPass* renderPass, ISwapchain* target) override;
+    void endRenderPass() override;
+    void setGraphicsPipeline(IGraphicsPipeline* pipeline) override;
+    void setVertexBuffer(IBuffer* buffer) override;
+    void setIndexBuffer(IBuffer* buffer) override;
+    void bindDescriptorSet(IDescriptorSet* set, std::span<const uint32_t> dynamicOffsets = {}) override;
+    void draw(uint32_t vertexCount, uint32_t firstVertex) override;
+    void drawIndexed(uint32_t indexCount, uint32_t firstIndex, IndexType indexType) override;
+    void setInstanceBuffer(IBuffer* buffer) override;
+    void drawInstanced(uint32_t vertexCount, uint32_t firstVertex, uint32_t instanceCount, uint32_t firstInstance) override;
+    void drawIndexedInstanced(uint32_t indexCount, uint32_t firstIndex, IndexType indexType, uint32_t instanceCount, uint32_t firstInstance) override;
+    void setComputePipeline(IComputePipeline* pipeline) override;
+    void dispatch(uint32_t groupsX, uint32_t groupsY, uint32_t groupsZ) override;
+    void dispatchIndirect(IBuffer* buffer, size_t offset) override;
+    void memoryBarrier(uint32_t barriers) override;
+    void executeBundle(ICommandBundle* bundle) override;
+    void setDebugWireframe(bool enable) override;
+
+    VkCommandBuffer commandBuffer() const { return cmd_; }
+    bool isRecording() const { return recording_; }
+    bool isInRenderPass() const { return activeRenderPass_ != VK_NULL_HANDLE; }
+
+private:
+    struct PendingResolve {
+        VulkanTexture* src;
+        uint32_t srcMip;
+        VulkanTexture* dst;
+        bool depth;
+    };
+
+    bool flushGraphicsState();
+    bool flushComputeState();
+    void resolveBlit(const PendingResolve& resolve);
+
+    VulkanDevice& device_;
+    VkCommandBuffer cmd_{VK_NULL_HANDLE};
+    bool recording_{false};
+    bool wireframe_{false};
+
+    // Estado lógico (resolvido no draw)
+    VulkanGraphicsPipeline* pipeline_{nullptr};
+    VulkanComputePipeline* computePipeline_{nullptr};
+    VulkanDescriptorSet* descriptorSet_{nullptr};
+    std::vector<uint32_t> dynamicOffsets_{};
+    VulkanBuffer* indexBuffer_{nullptr};
+    bool stateDirty_{true};
+
+    // Estado efetivamente aplicado no command buffer
+    VkRenderPass activeRenderPass_{VK_NULL_HANDLE};
+    uint32_t activeColorCount_{0};
+    VkPipeline boundPipeline_{VK_NULL_HANDLE};
+    VkDescriptorSet boundSet_{VK_NULL_HANDLE};
+    std::vector<uint32_t> boundDynamicOffsets_{};
+    VkDescriptorSetLayout cachedSetLayout_{VK_NULL_HANDLE};
+    VkPipelineLayout cachedPipelineLayout_{VK_NULL_HANDLE};
+    VkBuffer boundIndexBuffer_{VK_NULL_HANDLE};
+    // Bind point de compute é independente do gráfico
+    VkPipeline boundComputePipeline_{VK_NULL_HANDLE};
+    VkDescriptorSet boundComputeSet_{VK_NULL_HANDLE};
+    std::vector<uint32_t> boundComputeDynamicOffsets_{};
+    std::vector<PendingResolve> pendingResolves_{}; // StoreAction::Resolve do pass aberto
+    VkIndexType boundIndexType_{VK_INDEX_TYPE_UINT32};
+};
+
+}
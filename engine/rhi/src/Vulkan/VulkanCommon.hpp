@@ -0,0 +1,26 @@
+#pragma once
+
+#ifdef _WIN32
+#  ifndef VK_USE_PLATFORM_WIN32_KHR
+#    define VK_USE_PLATFORM_WIN32_KHR
+#  endif
+#  ifndef NOMINMAX
+#    define NOMINMAX
+#  endif
+#  ifndef WIN32_LEAN_AND_MEAN
+#    define WIN32_LEAN_AND_MEAN
+#  endif
+#endif
+#include <vulkan/vulkan.h>
+
+#include <cstdint>
+
+namespace Aurora::RHI {
+
+// Número de frames que a CPU pode gravar à frente da GPU
+inline constexpr uint32_t kVkMaxFramesInFlight = 2;
+
+// Loga o erro (com contexto) e retorna true se r == VK_SUCCESS
+bool vkCheck(VkResult r, const char* where);
+
+}
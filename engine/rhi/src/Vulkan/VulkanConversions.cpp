@@ -0,0 +1,130 @@
+#include "VulkanConversions.hpp"
+
+namespace Aurora::RHI::VulkanConversions {
+
+VkFormat toVkFormat(TextureFormat fmt) {
+    switch (fmt) {
+        case TextureFormat::RGBA8: return VK_FORMAT_R8G8B8A8_UNORM;
+        // RGB8 raramente é suportado com tiling ótimo; expandimos para RGBA8 no upload
+        case TextureFormat::RGB8: return VK_FORMAT_R8G8B8A8_UNORM;
+        case TextureFormat::R8: return VK_FORMAT_R8_UNORM;
+        case TextureFormat::RGBA16F: return VK_FORMAT_R16G16B16A16_SFLOAT;
+        case TextureFormat::R16F: return VK_FORMAT_R16_SFLOAT;
+        case TextureFormat::Depth24Stencil8: return VK_FORMAT_D24_UNORM_S8_UINT;
+        case TextureFormat::Depth32F: return VK_FORMAT_D32_SFLOAT;
+    }
+    return VK_FORMAT_R8G8B8A8_UNORM;
+}
+
+VkFormat toVkVertexFormat(uint32_t components) {
+    switch (components) {
+        case 1: return VK_FORMAT_R32_SFLOAT;
+        case 2: return VK_FORMAT_R32G32_SFLOAT;
+        case 3: return VK_FORMAT_R32G32B32_SFLOAT;
+        case 4: return VK_FORMAT_R32G32B32A32_SFLOAT;
+        default: return VK_FORMAT_UNDEFINED;
+    }
+}
+
+bool isDepthFormat(TextureFormat fmt) {
+    return fmt == TextureFormat::Depth24Stencil8 || fmt == TextureFormat::Depth32F;
+}
+
+bool hasStencil(TextureFormat fmt) {
+    return fmt == TextureFormat::Depth24Stencil8;
+}
+
+VkCompareOp toVkCompareOp(DepthFunc func) {
+    switch (func) {
+        case DepthFunc::Never: return VK_COMPARE_OP_NEVER;
+        case DepthFunc::Less: return VK_COMPARE_OP_LESS;
+        case DepthFunc::Equal: return VK_COMPARE_OP_EQUAL;
+        case DepthFunc::LessEqual: return VK_COMPARE_OP_LESS_OR_EQUAL;
+        case DepthFunc::Greater: return VK_COMPARE_OP_GREATER;
+        case DepthFunc::NotEqual: return VK_COMPARE_OP_NOT_EQUAL;
+        case DepthFunc::GreaterEqual: return VK_COMPARE_OP_GREATER_OR_EQUAL;
+        case DepthFunc::Always: return VK_COMPARE_OP_ALWAYS;
+    }
+    return VK_COMPARE_OP_LESS;
+}
+
+VkCullModeFlags toVkCullMode(CullMode mode) {
+    switch (mode) {
+        case CullMode::None: return VK_CULL_MODE_NONE;
+        case CullMode::Front: return VK_CULL_MODE_FRONT_BIT;
+        case CullMode::Back: return VK_CULL_MODE_BACK_BIT;
+    }
+    return VK_CULL_MODE_BACK_BIT;
+}
+
+VkBlendFactor toVkBlendFactor(BlendFactor f) {
+    switch (f) {
+        case BlendFactor::Zero: return VK_BLEND_FACTOR_ZERO;
+        case BlendFactor::One: return VK_BLEND_FACTOR_ONE;
+        case BlendFactor::SrcColor: return VK_BLEND_FACTOR_SRC_COLOR;
+        case BlendFactor::OneMinusSrcColor: return VK_BLEND_FACTOR_ONE_MINUS_SRC_COLOR;
+        case BlendFactor::DstColor: return VK_BLEND_FACTOR_DST_COLOR;
+        case BlendFactor::OneMinusDstColor: return VK_BLEND_FACTOR_ONE_MINUS_DST_COLOR;
+        case BlendFactor::SrcAlpha: return VK_BLEND_FACTOR_SRC_ALPHA;
+        case BlendFactor::OneMinusSrcAlpha: return VK_BLEND_FACTOR_ONE_MINUS_SRC_ALPHA;
+        case BlendFactor::DstAlpha: return VK_BLEND_FACTOR_DST_ALPHA;
+        case BlendFactor::OneMinusDstAlpha: return VK_BLEND_FACTOR_ONE_MINUS_DST_ALPHA;
+    }
+    return VK_BLEND_FACTOR_ONE;
+}
+
+VkBlendOp toVkBlendOp(BlendOp op) {
+    switch (op) {
+        case BlendOp::Add: return VK_BLEND_OP_ADD;
+        case BlendOp::Subtract: return VK_BLEND_OP_SUBTRACT;
+        case BlendOp::ReverseSubtract: return VK_BLEND_OP_REVERSE_SUBTRACT;
+        case BlendOp::Min: return VK_BLEND_OP_MIN;
+        case BlendOp::Max: return VK_BLEND_OP_MAX;
+    }
+    return VK_BLEND_OP_ADD;
+}
+
+VkColorComponentFlags toVkColorWriteMask(uint8_t mask) {
+    VkColorComponentFlags flags = 0;
+    if (mask & ColorWrite_R) flags |= VK_COLOR_COMPONENT_R_BIT;
+    if (mask & ColorWrite_G) flags |= VK_COLOR_COMPONENT_G_BIT;
+    if (mask & ColorWrite_B) flags |= VK_COLOR_COMPONENT_B_BIT;
+    if (mask & ColorWrite_A) flags |= VK_COLOR_COMPONENT_A_BIT;
+    return flags;
+}
+
+VkFilter toVkFilter(FilterMode mode) {
+    return mode == FilterMode::Linear ? VK_FILTER_LINEAR : VK_FILTER_NEAREST;
+}
+
+VkSamplerAddressMode toVkAddressMode(AddressMode mode) {
+    return mode == AddressMode::Repeat ? VK_SAMPLER_ADDRESS_MODE_REPEAT : VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+}
+
+VkIndexType toVkIndexType(IndexType type) {
+    return type == IndexType::Uint16 ? VK_INDEX_TYPE_UINT16 : VK_INDEX_TYPE_UINT32;
+}
+
+VkShaderStageFlagBits toVkShaderStage(ShaderStage stage) {
+    switch (stage) {
+        case ShaderStage::Vertex: return VK_SHADER_STAGE_VERTEX_BIT;
+        case ShaderStage::Fragment: return VK_SHADER_STAGE_FRAGMENT_BIT;
+        case ShaderStage::Compute: return VK_SHADER_STAGE_COMPUTE_BIT;
+    }
+    return VK_SHADER_STAGE_VERTEX_BIT;
+}
+
+VkAttachmentLoadOp toVkLoadOp(LoadAction action) {
+    switch (action) {
+        case LoadAction::Load: return VK_ATTACHMENT_LOAD_OP_LOAD;
+        case LoadAction::Clear: return VK_ATTACHMENT_LOAD_OP_CLEAR;
+        case LoadAction::DontCare: return VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+    }
+    return VK_ATTACHMENT_LOAD_OP_CLEAR;
+}
+
+VkAttachmentStoreOp toVkStoreOp(StoreAction action) {
+    return action == StoreAction::DontCare ? VK_ATTACHMENT_STORE_OP_DONT_CARE : VK_ATTACHMENT_STORE_OP_STORE;
+}
+
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "Aurora/RHI/RHI.hpp"
+#include "VulkanCommon.hpp"
+
+namespace Aurora::RHI::VulkanConversions {
+
+VkFormat toVkFormat(TextureFormat fmt);
+VkFormat toVkVertexFormat(uint32_t components);
+bool isDepthFormat(TextureFormat fmt);
+bool hasStencil(TextureFormat fmt);
+VkCompareOp toVkCompareOp(DepthFunc func);
+VkCullModeFlags toVkCullMode(CullMode mode);
+VkBlendFactor toVkBlendFactor(BlendFactor f);
+VkBlendOp toVkBlendOp(BlendOp op);
+VkColorComponentFlags toVkColorWriteMask(uint8_t mask);
+VkFilter toVkFilter(FilterMode mode);
+VkSamplerAddressMode toVkAddressMode(AddressMode mode);
+VkIndexType toVkIndexType(IndexType type);
+VkShaderStageFlagBits toVkShaderStage(ShaderStage stage);
+VkAttachmentLoadOp toVkLoadOp(LoadAction action);
+// Resolve guarda o attachment; a cópia para resolveTarget é feita após o pass (não há MSAA no RHI)
+VkAttachmentStoreOp toVkStoreOp(StoreAction action);
+
+}
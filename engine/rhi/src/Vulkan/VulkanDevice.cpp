@@ -0,0 +1,1246 @@
+#include "VulkanDevice.hpp"
+#include "VulkanConversions.hpp"
+#include "../CommandBundle.hpp"
+#include "../GpuMemoryTracking.hpp"
+#include "Aurora/Core/Log.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+namespace Aurora::RHI {
+
+using namespace VulkanConversions;
+
+namespace {
+
+constexpr const char* kPipelineCacheFile = "aurora_vk_pipeline_cache.bin";
+constexpr uint32_t kSetsPerDescriptorPool = 256;
+// Limite de vkCmdUpdateBuffer; acima disso usamos staging
+constexpr size_t kInlineUpdateLimit = 65536;
+
+#ifdef AURORA_DEBUG
+VKAPI_ATTR VkBool32 VKAPI_CALL debugCallback(VkDebugUtilsMessageSeverityFlagBitsEXT severity,
+                                             VkDebugUtilsMessageTypeFlagsEXT,
+                                             const VkDebugUtilsMessengerCallbackDataEXT* data, void*) {
+    if (severity >= VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT) {
+        Core::log(Core::LogLevel::Error, std::string("Vulkan validation: ") + data->pMessage);
+    } else if (severity >= VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT) {
+        Core::log(Core::LogLevel::Warn, std::string("Vulkan validation: ") + data->pMessage);
+    }
+    return VK_FALSE;
+}
+#endif
+
+bool hasExtension(const std::vector<VkExtensionProperties>& list, const char* name) {
+    for (const auto& e : list) if (std::strcmp(e.extensionName, name) == 0) return true;
+    return false;
+}
+
+VkImageAspectFlags aspectFor(VkFormat format) {
+    switch (format) {
+        case VK_FORMAT_D32_SFLOAT: return VK_IMAGE_ASPECT_DEPTH_BIT;
+        case VK_FORMAT_D24_UNORM_S8_UINT:
+        case VK_FORMAT_D32_SFLOAT_S8_UINT: return VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT;
+        default: return VK_IMAGE_ASPECT_COLOR_BIT;
+    }
+}
+
+uint32_t bytesPerPixel(TextureFormat fmt) {
+    switch (fmt) {
+        case TextureFormat::RGBA8: return 4;
+        case TextureFormat::RGB8: return 4; // expandido para RGBA8 no upload
+        case TextureFormat::R8: return 1;
+        case TextureFormat::RGBA16F: return 8;
+        case TextureFormat::R16F: return 2;
+        default: return 4;
+    }
+}
+
+} // namespace
+
+bool vkCheck(VkResult r, const char* where) {
+    if (r == VK_SUCCESS) return true;
+    Core::log(Core::LogLevel::Error, std::string("Vulkan error [") + where + "]: " + std::to_string(static_cast<int>(r)));
+    return false;
+}
+
+VulkanDevice::~VulkanDevice() {
+    if (!device_) {
+        if (instance_) vkDestroyInstance(instance_, nullptr);
+        return;
+    }
+    vkDeviceWaitIdle(device_);
+    immediate_.reset();
+    {
+        std::scoped_lock lock(deletionMutex_);
+        for (auto& fn : pendingDeletions_) fn();
+        pendingDeletions_.clear();
+        for (auto& f : frames_) {
+            for (auto& fn : f.deletions) fn();
+            f.deletions.clear();
+        }
+    }
+    savePipelineCache();
+
+    for (auto& kv : threadPools_) {
+        for (auto& pf : kv.second->frames) if (pf.pool) vkDestroyCommandPool(device_, pf.pool, nullptr);
+    }
+    threadPools_.clear();
+    for (auto pool : descriptorPools_) vkDestroyDescriptorPool(device_, pool, nullptr);
+    for (auto& kv : pipelineLayouts_) vkDestroyPipelineLayout(device_, kv.second, nullptr);
+    for (auto& kv : setLayouts_) vkDestroyDescriptorSetLayout(device_, kv.second, nullptr);
+    for (auto& kv : renderPasses_) vkDestroyRenderPass(device_, kv.second, nullptr);
+    for (auto& f : frames_) if (f.fence) vkDestroyFence(device_, f.fence, nullptr);
+    if (pipelineCache_) vkDestroyPipelineCache(device_, pipelineCache_, nullptr);
+    vkDestroyDevice(device_, nullptr);
+
+#ifdef AURORA_DEBUG
+    if (debugMessenger_) {
+        auto destroyFn = reinterpret_cast<PFN_vkDestroyDebugUtilsMessengerEXT>(
+            vkGetInstanceProcAddr(instance_, "vkDestroyDebugUtilsMessengerEXT"));
+        if (destroyFn) destroyFn(instance_, debugMessenger_, nullptr);
+    }
+#endif
+    vkDestroyInstance(instance_, nullptr);
+}
+
+bool VulkanDevice::initialize() {
+    if (!createInstance() || !pickPhysicalDevice() || !createLogicalDevice()) return false;
+
+    VkFenceCreateInfo fi{VK_STRUCTURE_TYPE_FENCE_CREATE_INFO};
+    fi.flags = VK_FENCE_CREATE_SIGNALED_BIT; // primeiro beginFrame não espera
+    for (auto& f : frames_) {
+        if (!vkCheck(vkCreateFence(device_, &fi, nullptr, &f.fence), "vkCreateFence")) return false;
+    }
+
+    VkDescriptorSetLayoutCreateInfo li{VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO};
+    if (!vkCheck(vkCreateDescriptorSetLayout(device_, &li, nullptr, &emptySetLayout_), "vkCreateDescriptorSetLayout")) return false;
+    setLayouts_.emplace(std::string(), emptySetLayout_);
+
+    loadPipelineCache();
+    return true;
+}
+
+bool VulkanDevice::createInstance() {
+    uint32_t extCount = 0;
+    if (vkEnumerateInstanceExtensionProperties(nullptr, &extCount, nullptr) != VK_SUCCESS) {
+        Core::log(Core::LogLevel::Error, "Vulkan: loader indisponível");
+        return false;
+    }
+    std::vector<VkExtensionProperties> available(extCount);
+    vkEnumerateInstanceExtensionProperties(nullptr, &extCount, available.data());
+
+    std::vector<const char*> extensions;
+    std::vector<const char*> layers;
+#ifdef _WIN32
+    if (hasExtension(available, VK_KHR_SURFACE_EXTENSION_NAME) && hasExtension(available, VK_KHR_WIN32_SURFACE_EXTENSION_NAME)) {
+        extensions.push_back(VK_KHR_SURFACE_EXTENSION_NAME);
+        extensions.push_back(VK_KHR_WIN32_SURFACE_EXTENSION_NAME);
+    }
+#endif
+#ifdef AURORA_DEBUG
+    const bool debugUtils = hasExtension(available, VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
+    if (debugUtils) extensions.push_back(VK_EXT_DEBUG_UTILS_EXTENSION_NAME);
+    uint32_t layerCount = 0;
+    vkEnumerateInstanceLayerProperties(&layerCount, nullptr);
+    std::vector<VkLayerProperties> availableLayers(layerCount);
+    vkEnumerateInstanceLayerProperties(&layerCount, availableLayers.data());
+    for (const auto& l : availableLayers) {
+        if (std::strcmp(l.layerName, "VK_LAYER_KHRONOS_validation") == 0) {
+            layers.push_back("VK_LAYER_KHRONOS_validation");
+            break;
+        }
+    }
+#endif
+
+    VkApplicationInfo app{VK_STRUCTURE_TYPE_APPLICATION_INFO};
+    app.pApplicationName = "Aurora";
+    app.pEngineName = "AuroraEngine";
+    app.apiVersion = VK_API_VERSION_1_1;
+
+    VkInstanceCreateInfo ci{VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO};
+    ci.pApplicationInfo = &app;
+    ci.enabledExtensionCount = static_cast<uint32_t>(extensions.size());
+    ci.ppEnabledExtensionNames = extensions.data();
+    ci.enabledLayerCount = static_cast<uint32_t>(layers.size());
+    ci.ppEnabledLayerNames = layers.data();
+    if (!vkCheck(vkCreateInstance(&ci, nullptr, &instance_), "vkCreateInstance")) return false;
+
+#ifdef AURORA_DEBUG
+    if (debugUtils) {
+        auto createFn = reinterpret_cast<PFN_vkCreateDebugUtilsMessengerEXT>(
+            vkGetInstanceProcAddr(instance_, "vkCreateDebugUtilsMessengerEXT"));
+        if (createFn) {
+            VkDebugUtilsMessengerCreateInfoEXT mi{VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT};
+            mi.messageSeverity = VK_DEBUG_UTILS_MESSAGE_SEVERITY_WARNING_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_SEVERITY_ERROR_BIT_EXT;
+            mi.messageType = VK_DEBUG_UTILS_MESSAGE_TYPE_GENERAL_BIT_EXT | VK_DEBUG_UTILS_MESSAGE_TYPE_VALIDATION_BIT_EXT
+                           | VK_DEBUG_UTILS_MESSAGE_TYPE_PERFORMANCE_BIT_EXT;
+            mi.pfnUserCallback = debugCallback;
+            createFn(instance_, &mi, nullptr, &debugMessenger_);
+        }
+    }
+#endif
+    return true;
+}
+
+bool VulkanDevice::pickPhysicalDevice() {
+    uint32_t count = 0;
+    vkEnumeratePhysicalDevices(instance_, &count, nullptr);
+    std::vector<VkPhysicalDevice> devices(count);
+    vkEnumeratePhysicalDevices(instance_, &count, devices.data());
+    if (devices.empty()) {
+        Core::log(Core::LogLevel::Error, "Vulkan: nenhum dispositivo físico encontrado");
+        return false;
+    }
+
+    // AURORA_VK_DEVICE força um dispositivo por substring do nome (ex.: "llvmpipe" para lavapipe)
+    const char* forced = std::getenv("AURORA_VK_DEVICE");
+    int bestScore = -1;
+    for (VkPhysicalDevice pd : devices) {
+        uint32_t familyCount = 0;
+        vkGetPhysicalDeviceQueueFamilyProperties(pd, &familyCount, nullptr);
+        std::vector<VkQueueFamilyProperties> families(familyCount);
+        vkGetPhysicalDeviceQueueFamilyProperties(pd, &familyCount, families.data());
+        int family = -1;
+        for (uint32_t i = 0; i < familyCount; ++i) {
+            const VkQueueFlags need = VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT;
+            if ((families[i].queueFlags & need) == need) { family = static_cast<int>(i); break; }
+        }
+        if (family < 0) continue;
+
+        VkPhysicalDeviceProperties props{};
+        vkGetPhysicalDeviceProperties(pd, &props);
+        int score = 0;
+        switch (props.deviceType) {
+            case VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU: score = 4; break;
+            case VK_PHYSICAL_DEVICE_TYPE_INTEGRATED_GPU: score = 3; break;
+            case VK_PHYSICAL_DEVICE_TYPE_VIRTUAL_GPU: score = 2; break;
+            case VK_PHYSICAL_DEVICE_TYPE_CPU: score = 1; break;
+            default: break;
+        }
+        if (forced && std::strstr(props.deviceName, forced)) score = 100;
+        if (score > bestScore) {
+            bestScore = score;
+            physicalDevice_ = pd;
+            queueFamily_ = static_cast<uint32_t>(family);
+        }
+    }
+    if (!physicalDevice_) {
+        Core::log(Core::LogLevel::Error, "Vulkan: nenhum dispositivo com fila gráfica+compute");
+        return false;
+    }
+    VkPhysicalDeviceProperties props{};
+    vkGetPhysicalDeviceProperties(physicalDevice_, &props);
+    vkGetPhysicalDeviceMemoryProperties(physicalDevice_, &memoryProps_);
+    caps_.uniformBufferOffsetAlignment = static_cast<uint32_t>(props.limits.minUniformBufferOffsetAlignment);
+    caps_.storageBufferOffsetAlignment = static_cast<uint32_t>(props.limits.minStorageBufferOffsetAlignment);
+    caps_.supportsCompute = true; // a fila escolhida sempre suporta compute
+    caps_.supportsSpirv = true;
+    caps_.spirvVulkanTarget = true;
+    Core::log(Core::LogLevel::Info, std::string("Vulkan: usando dispositivo ") + props.deviceName);
+    return true;
+}
+
+bool VulkanDevice::createLogicalDevice() {
+    uint32_t extCount = 0;
+    vkEnumerateDeviceExtensionProperties(physicalDevice_, nullptr, &extCount, nullptr);
+    std::vector<VkExtensionProperties> available(extCount);
+    vkEnumerateDeviceExtensionProperties(physicalDevice_, nullptr, &extCount, available.data());
+    std::vector<const char*> extensions;
+    // Sem VK_KHR_swapchain (ex.: lavapipe headless) o swapchain opera apenas offscreen
+    if (hasExtension(available, VK_KHR_SWAPCHAIN_EXTENSION_NAME)) extensions.push_back(VK_KHR_SWAPCHAIN_EXTENSION_NAME);
+
+    VkPhysicalDeviceFeatures supported{};
+    vkGetPhysicalDeviceFeatures(physicalDevice_, &supported);
+    VkPhysicalDeviceFeatures enabled{};
+    enabled.fillModeNonSolid = supported.fillModeNonSolid;
+    fillModeNonSolid_ = supported.fillModeNonSolid == VK_TRUE;
+
+    const float priority = 1.0f;
+    VkDeviceQueueCreateInfo qi{VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO};
+    qi.queueFamilyIndex = queueFamily_;
+    qi.queueCount = 1;
+    qi.pQueuePriorities = &priority;
+
+    VkDeviceCreateInfo ci{VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO};
+    ci.queueCreateInfoCount = 1;
+    ci.pQueueCreateInfos = &qi;
+    ci.enabledExtensionCount = static_cast<uint32_t>(extensions.size());
+    ci.ppEnabledExtensionNames = extensions.data();
+    ci.pEnabledFeatures = &enabled;
+    if (!vkCheck(vkCreateDevice(physicalDevice_, &ci, nullptr, &device_), "vkCreateDevice")) return false;
+    vkGetDeviceQueue(device_, queueFamily_, 0, &queue_);
+
+    swapchainDepthFormat_ = depthFormat(TextureFormat::Depth24Stencil8);
+    return true;
+}
+
+VkFormat VulkanDevice::depthFormat(TextureFormat fmt) const {
+    auto supports = [this](VkFormat f) {
+        VkFormatProperties p{};
+        vkGetPhysicalDeviceFormatProperties(physicalDevice_, f, &p);
+        return (p.optimalTilingFeatures & VK_FORMAT_FEATURE_DEPTH_STENCIL_ATTACHMENT_BIT) != 0;
+    };
+    if (fmt == TextureFormat::Depth32F) return VK_FORMAT_D32_SFLOAT;
+    // D24S8 não é obrigatório pela spec; D32S8 é a alternativa com stencil
+    if (supports(VK_FORMAT_D24_UNORM_S8_UINT)) return VK_FORMAT_D24_UNORM_S8_UINT;
+    if (supports(VK_FORMAT_D32_SFLOAT_S8_UINT)) return VK_FORMAT_D32_SFLOAT_S8_UINT;
+    return VK_FORMAT_D32_SFLOAT;
+}
+
+void VulkanDevice::loadPipelineCache() {
+    std::vector<char> data;
+    std::ifstream in(kPipelineCacheFile, std::ios::binary);
+    if (in) data.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+
+    // Valida o header (VkPipelineCacheHeaderVersionOne) antes de entregar ao driver
+    VkPhysicalDeviceProperties props{};
+    vkGetPhysicalDeviceProperties(physicalDevice_, &props);
+    bool valid = data.size() >= 16 + VK_UUID_SIZE;
+    if (valid) {
+        uint32_t header[4];
+        std::memcpy(header, data.data(), sizeof(header));
+        valid = header[1] == VK_PIPELINE_CACHE_HEADER_VERSION_ONE && header[2] == props.vendorID && header[3] == props.deviceID
+             && std::memcmp(data.data() + 16, props.pipelineCacheUUID, VK_UUID_SIZE) == 0;
+    }
+
+    VkPipelineCacheCreateInfo ci{VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO};
+    if (valid) {
+        ci.initialDataSize = data.size();
+        ci.pInitialData = data.data();
+    }
+    if (!vkCheck(vkCreatePipelineCache(device_, &ci, nullptr, &pipelineCache_), "vkCreatePipelineCache")) {
+        pipelineCache_ = VK_NULL_HANDLE;
+    } else if (valid) {
+        Core::log(Core::LogLevel::Info, "Vulkan: pipeline cache carregado do disco");
+    }
+}
+
+void VulkanDevice::savePipelineCache() {
+    if (!pipelineCache_) return;
+    size_t size = 0;
+    if (vkGetPipelineCacheData(device_, pipelineCache_, &size, nullptr) != VK_SUCCESS || size == 0) return;
+    std::vector<char> data(size);
+    if (vkGetPipelineCacheData(device_, pipelineCache_, &size, data.data()) != VK_SUCCESS) return;
+    std::ofstream out(kPipelineCacheFile, std::ios::binary | std::ios::trunc);
+    if (out) out.write(data.data(), static_cast<std::streamsize>(size));
+}
+
+// ---------------- Frames ----------------
+
+void VulkanDevice::beginFrame() {
+    const uint32_t slot = frameSlot();
+    auto& frame = frames_[slot];
+    vkWaitForFences(device_, 1, &frame.fence, VK_TRUE, UINT64_MAX);
+
+    std::vector<std::function<void()>> deletions;
+    {
+        std::scoped_lock lock(deletionMutex_);
+        deletions.swap(frame.deletions);
+    }
+    for (auto& fn : deletions) fn();
+
+    // A GPU terminou o slot: os pools de todas as threads podem ser reciclados
+    std::scoped_lock lock(poolsMutex_);
+    for (auto& kv : threadPools_) {
+        auto& pf = kv.second->frames[slot];
+        if (pf.pool && pf.used > 0) vkResetCommandPool(device_, pf.pool, 0);
+        pf.used = 0;
+    }
+}
+
+void VulkanDevice::endFrame() {
+    // Swapchain adquirido mas não apresentado: apresenta para não perder o semáforo de acquire
+    if (auto* sc = frameSwapchain_.load()) sc->present();
+    flushSubmissions(VK_NULL_HANDLE, VK_NULL_HANDLE);
+
+    const uint32_t slot = frameSlot();
+    auto& frame = frames_[slot];
+    {
+        std::scoped_lock lock(deletionMutex_);
+        for (auto& fn : pendingDeletions_) frame.deletions.push_back(std::move(fn));
+        pendingDeletions_.clear();
+    }
+    // Submit vazio com fence: sinaliza quando todo o trabalho anterior na fila terminar
+    vkResetFences(device_, 1, &frame.fence);
+    {
+        std::scoped_lock lock(queueMutex_);
+        vkCheck(vkQueueSubmit(queue_, 0, nullptr, frame.fence), "vkQueueSubmit(fence)");
+    }
+    frameSlot_.store((slot + 1) % kVkMaxFramesInFlight, std::memory_order_release);
+}
+
+void VulkanDevice::deferDestroy(std::function<void()> fn) {
+    std::scoped_lock lock(deletionMutex_);
+    pendingDeletions_.push_back(std::move(fn));
+}
+
+VkCommandBuffer VulkanDevice::acquireCommandBuffer() {
+    ThreadCommandPools* pools = nullptr;
+    {
+        std::scoped_lock lock(poolsMutex_);
+        auto& entry = threadPools_[std::this_thread::get_id()];
+        if (!entry) {
+            entry = std::make_unique<ThreadCommandPools>();
+            VkCommandPoolCreateInfo pi{VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO};
+            pi.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+            pi.queueFamilyIndex = queueFamily_;
+            for (auto& pf : entry->frames) {
+                if (!vkCheck(vkCreateCommandPool(device_, &pi, nullptr, &pf.pool), "vkCreateCommandPool")) return VK_NULL_HANDLE;
+            }
+        }
+        pools = entry.get();
+    }
+    // Daqui em diante só esta thread toca nos seus pools (beginFrame roda sem gravações ativas)
+    auto& pf = pools->frames[frameSlot()];
+    if (pf.used < pf.buffers.size()) return pf.buffers[pf.used++];
+    VkCommandBufferAllocateInfo ai{VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO};
+    ai.commandPool = pf.pool;
+    ai.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    ai.commandBufferCount = 1;
+    VkCommandBuffer cmd = VK_NULL_HANDLE;
+    if (!vkCheck(vkAllocateCommandBuffers(device_, &ai, &cmd), "vkAllocateCommandBuffers")) return VK_NULL_HANDLE;
+    pf.buffers.push_back(cmd);
+    ++pf.used;
+    return cmd;
+}
+
+// ---------------- Submissão ----------------
+
+VkCommandBuffer VulkanDevice::uploadCommandBuffer() {
+    if (uploadCmd_) return uploadCmd_;
+    uploadCmd_ = acquireCommandBuffer();
+    if (!uploadCmd_) return VK_NULL_HANDLE;
+    VkCommandBufferBeginInfo bi{VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO};
+    bi.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    vkBeginCommandBuffer(uploadCmd_, &bi);
+    // Cópias só começam depois que leituras anteriores do buffer (submits passados) terminaram
+    VkMemoryBarrier b{VK_STRUCTURE_TYPE_MEMORY_BARRIER};
+    b.srcAccessMask = VK_ACCESS_MEMORY_READ_BIT | VK_ACCESS_MEMORY_WRITE_BIT;
+    b.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    vkCmdPipelineBarrier(uploadCmd_, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0, 1, &b, 0, nullptr, 0, nullptr);
+    return uploadCmd_;
+}
+
+void VulkanDevice::closeUploadCommandBuffer() {
+    if (!uploadCmd_) return;
+    VkMemoryBarrier b{VK_STRUCTURE_TYPE_MEMORY_BARRIER};
+    b.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+    b.dstAccessMask = VK_ACCESS_VERTEX_ATTRIBUTE_READ_BIT | VK_ACCESS_INDEX_READ_BIT | VK_ACCESS_UNIFORM_READ_BIT | VK_ACCESS_SHADER_READ_BIT;
+    vkCmdPipelineBarrier(uploadCmd_, VK_PIPELINE_STAGE_TRANSFER_BIT,
+                         VK_PIPELINE_STAGE_VERTEX_INPUT_BIT | VK_PIPELINE_STAGE_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT,
+                         0, 1, &b, 0, nullptr, 0, nullptr);
+    vkCheck(vkEndCommandBuffer(uploadCmd_), "vkEndCommandBuffer(upload)");
+    pendingSubmits_.push_back(uploadCmd_);
+    uploadCmd_ = VK_NULL_HANDLE;
+}
+
+void VulkanDevice::ensureImmediateList() {
+    if (!immediate_) immediate_ = std::make_unique<VulkanCommandList>(*this);
+    if (!immediateOpen_) {
+        immediate_->begin();
+        immediateOpen_ = immediate_->isRecording();
+    }
+}
+
+void VulkanDevice::flushImmediateList() {
+    if (!immediateOpen_) return;
+    immediate_->end();
+    if (immediate_->commandBuffer()) pendingSubmits_.push_back(immediate_->commandBuffer());
+    immediateOpen_ = false;
+}
+
+void VulkanDevice::submit(ICommandList* list) {
+    auto* vl = static_cast<VulkanCommandList*>(list);
+    if (!vl || !vl->commandBuffer()) return;
+    if (vl->isRecording()) {
+        Core::log(Core::LogLevel::Warn, "Vulkan: submit de command list sem end(); encerrando");
+        vl->end();
+    }
+    // Preserva a ordem: trabalho imediato e uploads anteriores executam antes desta lista
+    flushImmediateList();
+    {
+        std::scoped_lock lock(uploadMutex_);
+        closeUploadCommandBuffer();
+    }
+    pendingSubmits_.push_back(vl->commandBuffer());
+}
+
+void VulkanDevice::flushSubmissions(VkSemaphore waitSemaphore, VkSemaphore signalSemaphore) {
+    flushImmediateList();
+    {
+        std::scoped_lock lock(uploadMutex_);
+        closeUploadCommandBuffer();
+    }
+    if (pendingSubmits_.empty() && !waitSemaphore && !signalSemaphore) return;
+
+    const VkPipelineStageFlags waitStage = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+    VkSubmitInfo si{VK_STRUCTURE_TYPE_SUBMIT_INFO};
+    si.commandBufferCount = static_cast<uint32_t>(pendingSubmits_.size());
+    si.pCommandBuffers = pendingSubmits_.data();
+    if (waitSemaphore) {
+        si.waitSemaphoreCount = 1;
+        si.pWaitSemaphores = &waitSemaphore;
+        si.pWaitDstStageMask = &waitStage;
+    }
+    if (signalSemaphore) {
+        si.signalSemaphoreCount = 1;
+        si.pSignalSemaphores = &signalSemaphore;
+    }
+    {
+        std::scoped_lock lock(queueMutex_);
+        vkCheck(vkQueueSubmit(queue_, 1, &si, VK_NULL_HANDLE), "vkQueueSubmit");
+    }
+    pendingSubmits_.clear();
+}
+
+void VulkanDevice::registerSwapchainUse(VulkanSwapchain* swapchain) {
+    frameSwapchain_.store(swapchain);
+}
+
+void VulkanDevice::releaseSwapchainUse(VulkanSwapchain* swapchain) {
+    VulkanSwapchain* expected = swapchain;
+    frameSwapchain_.compare_exchange_strong(expected, nullptr);
+}
+
+void VulkanDevice::immediateSubmit(const std::function<void(VkCommandBuffer)>& record) {
+    VkCommandPoolCreateInfo pi{VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO};
+    pi.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+    pi.queueFamilyIndex = queueFamily_;
+    VkCommandPool pool = VK_NULL_HANDLE;
+    if (!vkCheck(vkCreateCommandPool(device_, &pi, nullptr, &pool), "vkCreateCommandPool(immediate)")) return;
+
+    VkCommandBufferAllocateInfo ai{VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO};
+    ai.commandPool = pool;
+    ai.level = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+    ai.commandBufferCount = 1;
+    VkCommandBuffer cmd = VK_NULL_HANDLE;
+    vkAllocateCommandBuffers(device_, &ai, &cmd);
+    VkCommandBufferBeginInfo bi{VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO};
+    bi.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    vkBeginCommandBuffer(cmd, &bi);
+    record(cmd);
+    vkEndCommandBuffer(cmd);
+
+    VkFenceCreateInfo fi{VK_STRUCTURE_TYPE_FENCE_CREATE_INFO};
+    VkFence fence = VK_NULL_HANDLE;
+    vkCreateFence(device_, &fi, nullptr, &fence);
+    VkSubmitInfo si{VK_STRUCTURE_TYPE_SUBMIT_INFO};
+    si.commandBufferCount = 1;
+    si.pCommandBuffers = &cmd;
+    {
+        std::scoped_lock lock(queueMutex_);
+        vkCheck(vkQueueSubmit(queue_, 1, &si, fence), "vkQueueSubmit(immediate)");
+    }
+    vkWaitForFences(device_, 1, &fence, VK_TRUE, UINT64_MAX);
+    vkDestroyFence(device_, fence, nullptr);
+    vkDestroyCommandPool(device_, pool, nullptr);
+}
+
+// ---------------- Memória ----------------
+
+uint32_t VulkanDevice::findMemoryType(uint32_t typeBits, VkMemoryPropertyFlags props) const {
+    for (uint32_t i = 0; i < memoryProps_.memoryTypeCount; ++i) {
+        if ((typeBits & (1u << i)) && (memoryProps_.memoryTypes[i].propertyFlags & props) == props) return i;
+    }
+    return UINT32_MAX;
+}
+
+bool VulkanDevice::createRawBuffer(VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags props,
+                                   VkBuffer& outBuffer, VkDeviceMemory& outMemory, void** outMapped) {
+    VkBufferCreateInfo bi{VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO};
+    bi.size = size;
+    bi.usage = usage;
+    bi.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    if (!vkCheck(vkCreateBuffer(device_, &bi, nullptr, &outBuffer), "vkCreateBuffer")) return false;
+
+    VkMemoryRequirements req{};
+    vkGetBufferMemoryRequirements(device_, outBuffer, &req);
+    uint32_t type = findMemoryType(req.memoryTypeBits, props);
+    if (type == UINT32_MAX) {
+        vkDestroyBuffer(device_, outBuffer, nullptr);
+        outBuffer = VK_NULL_HANDLE;
+        return false;
+    }
+    VkMemoryAllocateInfo ai{VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO};
+    ai.allocationSize = req.size;
+    ai.memoryTypeIndex = type;
+    if (!vkCheck(vkAllocateMemory(device_, &ai, nullptr, &outMemory), "vkAllocateMemory(buffer)")) {
+        vkDestroyBuffer(device_, outBuffer, nullptr);
+        outBuffer = VK_NULL_HANDLE;
+        return false;
+    }
+    vkBindBufferMemory(device_, outBuffer, outMemory, 0);
+    if (outMapped) vkMapMemory(device_, outMemory, 0, VK_WHOLE_SIZE, 0, outMapped);
+    return true;
+}
+
+bool VulkanDevice::createRawImage(const VkImageCreateInfo& info, VkImage& outImage, VkDeviceMemory& outMemory) {
+    if (!vkCheck(vkCreateImage(device_, &info, nullptr, &outImage), "vkCreateImage")) return false;
+    VkMemoryRequirements req{};
+    vkGetImageMemoryRequirements(device_, outImage, &req);
+    uint32_t type = findMemoryType(req.memoryTypeBits, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+    if (type == UINT32_MAX) type = findMemoryType(req.memoryTypeBits, 0);
+    VkMemoryAllocateInfo ai{VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO};
+    ai.allocationSize = req.size;
+    ai.memoryTypeIndex = type;
+    if (type == UINT32_MAX || !vkCheck(vkAllocateMemory(device_, &ai, nullptr, &outMemory), "vkAllocateMemory(image)")) {
+        vkDestroyImage(device_, outImage, nullptr);
+        outImage = VK_NULL_HANDLE;
+        return false;
+    }
+    vkBindImageMemory(device_, outImage, outMemory, 0);
+    return true;
+}
+
+// ---------------- Recursos ----------------
+
+std::unique_ptr<ISwapchain> VulkanDevice::createSwapchain(const SwapchainDesc& desc) {
+    auto sc = std::make_unique<VulkanSwapchain>(*this, desc);
+    if (!sc->initialize()) {
+        Core::log(Core::LogLevel::Error, "Falha ao inicializar swapchain Vulkan");
+        return nullptr;
+    }
+    return sc;
+}
+
+std::unique_ptr<IRenderPass> VulkanDevice::createRenderPass(const RenderPassDesc& desc) {
+    return std::make_unique<VulkanRenderPass>(desc);
+}
+
+VkRenderPass VulkanDevice::getOrCreateRenderPass(const VulkanRenderPassKey& key) {
+    std::scoped_lock lock(renderPassMutex_);
+    auto it = renderPasses_.find(key);
+    if (it != renderPasses_.end()) return it->second;
+
+    std::vector<VkAttachmentDescription> attachments;
+    std::vector<VkAttachmentReference> colorRefs;
+    for (size_t i = 0; i < key.colorFormats.size(); ++i) {
+        VkAttachmentDescription a{};
+        a.format = key.colorFormats[i];
+        a.samples = VK_SAMPLE_COUNT_1_BIT;
+        a.loadOp = key.colorLoads[i];
+        a.storeOp = key.colorStores[i];
+        a.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+        a.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
+        a.initialLayout = a.loadOp == VK_ATTACHMENT_LOAD_OP_LOAD ? key.colorFinalLayout : VK_IMAGE_LAYOUT_UNDEFINED;
+        a.finalLayout = key.colorFinalLayout;
+        colorRefs.push_back({static_cast<uint32_t>(attachments.size()), VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL});
+        attachments.push_back(a);
+    }
+    VkAttachmentReference depthRef{};
+    const bool hasDepth = key.depthFormat != VK_FORMAT_UNDEFINED;
+    if (hasDepth) {
+        VkAttachmentDescription a{};
+        a.format = key.depthFormat;
+        a.samples = VK_SAMPLE_COUNT_1_BIT;
+        a.loadOp = key.depthLoad;
+        a.storeOp = key.depthStore;
+        a.stencilLoadOp = key.depthLoad;
+        a.stencilStoreOp = key.depthStore;
+        a.initialLayout = key.depthLoad == VK_ATTACHMENT_LOAD_OP_LOAD ? key.depthFinalLayout : VK_IMAGE_LAYOUT_UNDEFINED;
+        a.finalLayout = key.depthFinalLayout;
+        depthRef = {static_cast<uint32_t>(attachments.size()), VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL};
+        attachments.push_back(a);
+    }
+
+    VkSubpassDescription subpass{};
+    subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
+    subpass.colorAttachmentCount = static_cast<uint32_t>(colorRefs.size());
+    subpass.pColorAttachments = colorRefs.data();
+    subpass.pDepthStencilAttachment = hasDepth ? &depthRef : nullptr;
+
+    // Entrada: espera escritas/leituras anteriores dos attachments (e o semáforo de acquire, que usa
+    // COLOR_ATTACHMENT_OUTPUT). Saída: resultado visível para amostragem ou cópia nos passes seguintes.
+    VkSubpassDependency deps[2]{};
+    deps[0].srcSubpass = VK_SUBPASS_EXTERNAL;
+    deps[0].dstSubpass = 0;
+    deps[0].srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+    deps[0].srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+    deps[0].dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT;
+    deps[0].dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT
+                          | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+    deps[1].srcSubpass = 0;
+    deps[1].dstSubpass = VK_SUBPASS_EXTERNAL;
+    deps[1].srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT | VK_PIPELINE_STAGE_LATE_FRAGMENT_TESTS_BIT;
+    deps[1].srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+    deps[1].dstStageMask = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_TRANSFER_BIT;
+    deps[1].dstAccessMask = VK_ACCESS_SHADER_READ_BIT | VK_ACCESS_TRANSFER_READ_BIT;
+
+    VkRenderPassCreateInfo ci{VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO};
+    ci.attachmentCount = static_cast<uint32_t>(attachments.size());
+    ci.pAttachments = attachments.data();
+    ci.subpassCount = 1;
+    ci.pSubpasses = &subpass;
+    ci.dependencyCount = 2;
+    ci.pDependencies = deps;
+    VkRenderPass pass = VK_NULL_HANDLE;
+    if (!vkCheck(vkCreateRenderPass(device_, &ci, nullptr, &pass), "vkCreateRenderPass")) return VK_NULL_HANDLE;
+    renderPasses_.emplace(key, pass);
+    return pass;
+}
+
+std::unique_ptr<IShaderModule> VulkanDevice::createShaderModule(const ShaderModuleDesc& desc) {
+    if (!desc.spirv || desc.spirvSize == 0) {
+        Core::log(Core::LogLevel::Error, "Vulkan: ShaderModuleDesc sem SPIR-V (GLSL não é aceito por este backend)");
+        return nullptr;
+    }
+    VkShaderModuleCreateInfo ci{VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO};
+    ci.codeSize = desc.spirvSize;
+    ci.pCode = desc.spirv;
+    VkShaderModule module = VK_NULL_HANDLE;
+    if (!vkCheck(vkCreateShaderModule(device_, &ci, nullptr, &module), "vkCreateShaderModule")) return nullptr;
+    VulkanSpecialization specialization;
+    for (const auto& c : desc.specializationConstants) {
+        specialization.entries.push_back({c.id, static_cast<uint32_t>(specialization.data.size() * sizeof(uint32_t)), sizeof(uint32_t)});
+        specialization.data.push_back(c.bits);
+    }
+    return std::make_unique<VulkanShaderModule>(*this, desc.stage, module, std::move(specialization));
+}
+
+std::unique_ptr<IBuffer> VulkanDevice::createBuffer(const void* data, size_t bytes, BufferUsage usage, BufferUpdate /*update*/) {
+    // Todo buffer já é host visible e mapeado persistente: a dica de atualização não muda a alocação
+    VkBufferUsageFlags flags = VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+    switch (usage) {
+        case BufferUsage::Vertex: flags |= VK_BUFFER_USAGE_VERTEX_BUFFER_BIT; break;
+        case BufferUsage::Index: flags |= VK_BUFFER_USAGE_INDEX_BUFFER_BIT; break;
+        case BufferUsage::Uniform: flags |= VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT; break;
+        case BufferUsage::Storage:
+            // Saída de compute também consumida como vértices/índices ou argumentos indiretos
+            flags |= VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT
+                   | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+            break;
+    }
+    const VkDeviceSize size = bytes > 0 ? bytes : 4;
+    VkBuffer buffer = VK_NULL_HANDLE;
+    VkDeviceMemory memory = VK_NULL_HANDLE;
+    void* mapped = nullptr;
+    // Host visible + coerente, preferindo memória local (BAR/UMA); mapeado durante toda a vida do buffer
+    const VkMemoryPropertyFlags hostFlags = VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+    if (!createRawBuffer(size, flags, hostFlags | VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, buffer, memory, &mapped)
+        && !createRawBuffer(size, flags, hostFlags, buffer, memory, &mapped)) {
+        Core::log(Core::LogLevel::Error, "Vulkan: falha ao criar buffer");
+        return nullptr;
+    }
+    if (data && mapped) std::memcpy(mapped, data, bytes);
+    trackBufferMemory(bytes);
+    return std::make_unique<VulkanBuffer>(*this, bytes, usage, buffer, memory, mapped);
+}
+
+void VulkanDevice::updateBuffer(IBuffer* buffer, const void* data, size_t bytes, size_t dstOffset) {
+    auto* vb = static_cast<VulkanBuffer*>(buffer);
+    if (!vb || !data || bytes == 0 || dstOffset + bytes > vb->getSize()) return;
+    // A atualização acontece na GPU, no command buffer de upload que antecede o próximo submit;
+    // assim frames ainda em voo continuam lendo o conteúdo antigo (mesma semântica de glBufferSubData)
+    std::scoped_lock lock(uploadMutex_);
+    VkCommandBuffer cmd = uploadCommandBuffer();
+    if (!cmd) return;
+    if (bytes <= kInlineUpdateLimit && (bytes % 4) == 0 && (dstOffset % 4) == 0) {
+        vkCmdUpdateBuffer(cmd, vb->buffer_, dstOffset, bytes, data);
+        return;
+    }
+    VkBuffer staging = VK_NULL_HANDLE;
+    VkDeviceMemory stagingMemory = VK_NULL_HANDLE;
+    void* mapped = nullptr;
+    if (!createRawBuffer(bytes, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                         VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                         staging, stagingMemory, &mapped)) {
+        return;
+    }
+    std::memcpy(mapped, data, bytes);
+    VkBufferCopy region{0, dstOffset, bytes};
+    vkCmdCopyBuffer(cmd, staging, vb->buffer_, 1, &region);
+    VkDevice dev = device_;
+    deferDestroy([dev, staging, stagingMemory] {
+        vkDestroyBuffer(dev, staging, nullptr);
+        vkFreeMemory(dev, stagingMemory, nullptr);
+    });
+}
+
+std::unique_ptr<ITexture> VulkanDevice::createTexture(const TextureDesc& desc, const void* initialPixelsRGBA8) {
+    const bool depth = isDepthFormat(desc.format);
+    const VkFormat format = depth ? depthFormat(desc.format) : toVkFormat(desc.format);
+    const uint32_t mipLevels = std::max(1u, desc.mipLevels);
+
+    VkFormatProperties formatProps{};
+    vkGetPhysicalDeviceFormatProperties(physicalDevice_, format, &formatProps);
+
+    VkImageCreateInfo ici{VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO};
+    ici.imageType = VK_IMAGE_TYPE_2D;
+    ici.format = format;
+    ici.extent = {std::max(1u, desc.width), std::max(1u, desc.height), 1};
+    ici.mipLevels = mipLevels;
+    ici.arrayLayers = 1;
+    ici.samples = VK_SAMPLE_COUNT_1_BIT;
+    ici.tiling = VK_IMAGE_TILING_OPTIMAL;
+    ici.usage = VK_IMAGE_USAGE_SAMPLED_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+    if (depth) ici.usage |= VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT;
+    else if (desc.usage == TextureUsage::RenderTarget) ici.usage |= VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+    const bool storage = desc.usage == TextureUsage::Storage && (formatProps.optimalTilingFeatures & VK_FORMAT_FEATURE_STORAGE_IMAGE_BIT);
+    if (storage) ici.usage |= VK_IMAGE_USAGE_STORAGE_BIT;
+    else if (desc.usage == TextureUsage::Storage) Core::log(Core::LogLevel::Warn, "Vulkan: formato sem suporte a imagem de storage");
+    ici.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+    VkImage image = VK_NULL_HANDLE;
+    VkDeviceMemory memory = VK_NULL_HANDLE;
+    if (!createRawImage(ici, image, memory)) {
+        Core::log(Core::LogLevel::Error, "Vulkan: falha ao criar textura");
+        return nullptr;
+    }
+
+    // View de amostragem: apenas o aspecto de depth para formatos depth/stencil
+    VkImageViewCreateInfo vi{VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO};
+    vi.image = image;
+    vi.viewType = VK_IMAGE_VIEW_TYPE_2D;
+    vi.format = format;
+    vi.subresourceRange = {depth ? VkImageAspectFlags(VK_IMAGE_ASPECT_DEPTH_BIT) : VkImageAspectFlags(VK_IMAGE_ASPECT_COLOR_BIT), 0, mipLevels, 0, 1};
+    VkImageView view = VK_NULL_HANDLE;
+    if (!vkCheck(vkCreateImageView(device_, &vi, nullptr, &view), "vkCreateImageView")) {
+        vkDestroyImage(device_, image, nullptr);
+        vkFreeMemory(device_, memory, nullptr);
+        return nullptr;
+    }
+
+    // Storage fica em GENERAL: leitura amostrada e load/store em compute sem transições entre dispatches
+    VkImageLayout resting = depth ? VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL : VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+    if (storage) resting = VK_IMAGE_LAYOUT_GENERAL;
+    const VkImageAspectFlags fullAspect = aspectFor(format);
+
+    // Staging do nível 0 (RGB8 é expandido para RGBA8, formato real da imagem)
+    VkBuffer staging = VK_NULL_HANDLE;
+    VkDeviceMemory stagingMemory = VK_NULL_HANDLE;
+    const bool upload = initialPixelsRGBA8 && !depth;
+    if (upload) {
+        const size_t pixels = static_cast<size_t>(ici.extent.width) * ici.extent.height;
+        const size_t bytes = pixels * bytesPerPixel(desc.format);
+        void* mapped = nullptr;
+        if (createRawBuffer(bytes, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
+                            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT,
+                            staging, stagingMemory, &mapped)) {
+            if (desc.format == TextureFormat::RGB8) {
+                auto* dst = static_cast<uint8_t*>(mapped);
+                auto* src = static_cast<const uint8_t*>(initialPixelsRGBA8);
+                for (size_t i = 0; i < pixels; ++i) {
+                    dst[i * 4 + 0] = src[i * 3 + 0];
+                    dst[i * 4 + 1] = src[i * 3 + 1];
+                    dst[i * 4 + 2] = src[i * 3 + 2];
+                    dst[i * 4 + 3] = 255;
+                }
+            } else {
+                std::memcpy(mapped, initialPixelsRGBA8, bytes);
+            }
+        }
+    }
+
+    const bool canBlit = (formatProps.optimalTilingFeatures & VK_FORMAT_FEATURE_BLIT_SRC_BIT)
+                      && (formatProps.optimalTilingFeatures & VK_FORMAT_FEATURE_BLIT_DST_BIT);
+    const bool linearBlit = (formatProps.optimalTilingFeatures & VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT) != 0;
+    const bool generateMips = staging && mipLevels > 1 && canBlit;
+    if (staging && mipLevels > 1 && !canBlit) {
+        Core::log(Core::LogLevel::Warn, "Vulkan: formato sem suporte a blit; mips não gerados");
+    }
+
+    const uint32_t width = ici.extent.width;
+    const uint32_t height = ici.extent.height;
+    immediateSubmit([&](VkCommandBuffer cmd) {
+        auto barrier = [&](uint32_t baseMip, uint32_t levels, VkImageLayout from, VkImageLayout to,
+                           VkAccessFlags srcAccess, VkAccessFlags dstAccess,
+                           VkPipelineStageFlags srcStage, VkPipelineStageFlags dstStage) {
+            VkImageMemoryBarrier b{VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER};
+            b.oldLayout = from;
+            b.newLayout = to;
+            b.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            b.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+            b.image = image;
+            b.subresourceRange = {fullAspect, baseMip, levels, 0, 1};
+            b.srcAccessMask = srcAccess;
+            b.dstAccessMask = dstAccess;
+            vkCmdPipelineBarrier(cmd, srcStage, dstStage, 0, 0, nullptr, 0, nullptr, 1, &b);
+        };
+
+        if (!staging) {
+            barrier(0, mipLevels, VK_IMAGE_LAYOUT_UNDEFINED, resting, 0, VK_ACCESS_SHADER_READ_BIT,
+                    VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
+            return;
+        }
+        barrier(0, mipLevels, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 0, VK_ACCESS_TRANSFER_WRITE_BIT,
+                VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+        VkBufferImageCopy region{};
+        region.imageSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1};
+        region.imageExtent = {width, height, 1};
+        vkCmdCopyBufferToImage(cmd, staging, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+
+        uint32_t lastLevel = 0;
+        if (generateMips) {
+            int32_t w = static_cast<int32_t>(width), h = static_cast<int32_t>(height);
+            for (uint32_t level = 1; level < mipLevels; ++level) {
+                barrier(level - 1, 1, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                        VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_TRANSFER_READ_BIT,
+                        VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT);
+                const int32_t nw = std::max(1, w / 2), nh = std::max(1, h / 2);
+                VkImageBlit blit{};
+                blit.srcSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, level - 1, 0, 1};
+                blit.srcOffsets[1] = {w, h, 1};
+                blit.dstSubresource = {VK_IMAGE_ASPECT_COLOR_BIT, level, 0, 1};
+                blit.dstOffsets[1] = {nw, nh, 1};
+                vkCmdBlitImage(cmd, image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, image, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL,
+                               1, &blit, linearBlit ? VK_FILTER_LINEAR : VK_FILTER_NEAREST);
+                w = nw; h = nh;
+            }
+            lastLevel = mipLevels - 1;
+            if (lastLevel > 0) {
+                barrier(0, lastLevel, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, resting,
+                        VK_ACCESS_TRANSFER_READ_BIT, VK_ACCESS_SHADER_READ_BIT,
+                        VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
+            }
+        }
+        // Demais níveis (o último gerado ou todos os não gerados) saem de TRANSFER_DST
+        barrier(lastLevel, mipLevels - lastLevel, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, resting,
+                VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_SHADER_READ_BIT,
+                VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT);
+    });
+
+    if (staging) {
+        vkDestroyBuffer(device_, staging, nullptr);
+        vkFreeMemory(device_, stagingMemory, nullptr);
+    }
+
+    trackTextureMemory(desc);
+    auto tex = std::make_unique<VulkanTexture>(*this, desc, format, image, memory, view);
+    tex->restingLayout_ = resting;
+    if (storage) {
+        for (uint32_t mip = 0; mip < mipLevels; ++mip) {
+            VkImageViewCreateInfo svi = vi;
+            svi.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, mip, 1, 0, 1};
+            VkImageView storageView = VK_NULL_HANDLE;
+            if (vkCheck(vkCreateImageView(device_, &svi, nullptr, &storageView), "vkCreateImageView (storage)")) {
+                tex->storageViews_.push_back(storageView);
+            }
+        }
+    }
+    return tex;
+}
+
+std::unique_ptr<ISampler> VulkanDevice::createSampler(const SamplerDesc& desc) {
+    VkSamplerCreateInfo ci{VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO};
+    ci.magFilter = toVkFilter(desc.magFilter);
+    ci.minFilter = toVkFilter(desc.minFilter);
+    ci.addressModeU = toVkAddressMode(desc.addressU);
+    ci.addressModeV = toVkAddressMode(desc.addressV);
+    ci.addressModeW = ci.addressModeU;
+    // MipmapMode::None amostra só o nível base, como o minFilter sem mip do GL
+    ci.mipmapMode = desc.mipmapMode == SamplerDesc::MipmapMode::Linear ? VK_SAMPLER_MIPMAP_MODE_LINEAR : VK_SAMPLER_MIPMAP_MODE_NEAREST;
+    ci.minLod = 0.0f;
+    ci.maxLod = desc.mipmapMode == SamplerDesc::MipmapMode::None ? 0.0f : VK_LOD_CLAMP_NONE;
+    ci.maxAnisotropy = 1.0f;
+    VkSampler sampler = VK_NULL_HANDLE;
+    if (!vkCheck(vkCreateSampler(device_, &ci, nullptr, &sampler), "vkCreateSampler")) return nullptr;
+    return std::make_unique<VulkanSampler>(*this, sampler);
+}
+
+std::unique_ptr<IGraphicsPipeline> VulkanDevice::createGraphicsPipeline(const GraphicsPipelineDesc& desc) {
+    if (!desc.vertexShader) {
+        Core::log(Core::LogLevel::Error, "Vulkan: pipeline sem vertex shader");
+        return nullptr;
+    }
+    return std::make_unique<VulkanGraphicsPipeline>(*this, desc);
+}
+
+std::unique_ptr<IComputePipeline> VulkanDevice::createComputePipeline(const ComputePipelineDesc& desc) {
+    if (!desc.computeShader || desc.computeShader->getStage() != ShaderStage::Compute) {
+        Core::log(Core::LogLevel::Error, "Vulkan: pipeline de compute sem compute shader");
+        return nullptr;
+    }
+    return std::make_unique<VulkanComputePipeline>(*this, desc);
+}
+
+// ---------------- Descriptors ----------------
+
+VkDescriptorSetLayout VulkanDevice::getOrCreateSetLayout(const DescriptorSetDesc& desc) {
+    std::vector<VkDescriptorSetLayoutBinding> bindings;
+    std::string signature;
+    for (const auto& ub : desc.uniformBuffers) {
+        if (ub.blockName) {
+            Core::log(Core::LogLevel::Warn, "Vulkan: blockName não é resolvido; usando binding");
+        }
+        signature += (ub.dynamic ? "d" : "u") + std::to_string(ub.binding) + ";";
+        VkDescriptorSetLayoutBinding b{};
+        b.binding = ub.binding;
+        b.descriptorType = ub.dynamic ? VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC : VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        b.descriptorCount = 1;
+        b.stageFlags = VK_SHADER_STAGE_ALL_GRAPHICS | VK_SHADER_STAGE_COMPUTE_BIT;
+        bindings.push_back(b);
+    }
+    for (const auto& st : desc.sampledTextures) {
+        signature += "s" + std::to_string(st.binding) + ";";
+        VkDescriptorSetLayoutBinding b{};
+        b.binding = st.binding;
+        b.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        b.descriptorCount = 1;
+        b.stageFlags = VK_SHADER_STAGE_ALL_GRAPHICS | VK_SHADER_STAGE_COMPUTE_BIT;
+        bindings.push_back(b);
+    }
+    for (const auto& sb : desc.storageBuffers) {
+        signature += "b" + std::to_string(sb.binding) + ";";
+        VkDescriptorSetLayoutBinding b{};
+        b.binding = sb.binding;
+        b.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        b.descriptorCount = 1;
+        b.stageFlags = VK_SHADER_STAGE_ALL_GRAPHICS | VK_SHADER_STAGE_COMPUTE_BIT;
+        bindings.push_back(b);
+    }
+    for (const auto& st : desc.storageTextures) {
+        signature += "i" + std::to_string(st.binding) + ";";
+        VkDescriptorSetLayoutBinding b{};
+        b.binding = st.binding;
+        b.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+        b.descriptorCount = 1;
+        b.stageFlags = VK_SHADER_STAGE_ALL_GRAPHICS | VK_SHADER_STAGE_COMPUTE_BIT;
+        bindings.push_back(b);
+    }
+
+    std::scoped_lock lock(layoutMutex_);
+    auto it = setLayouts_.find(signature);
+    if (it != setLayouts_.end()) return it->second;
+    VkDescriptorSetLayoutCreateInfo ci{VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO};
+    ci.bindingCount = static_cast<uint32_t>(bindings.size());
+    ci.pBindings = bindings.data();
+    VkDescriptorSetLayout layout = VK_NULL_HANDLE;
+    if (!vkCheck(vkCreateDescriptorSetLayout(device_, &ci, nullptr, &layout), "vkCreateDescriptorSetLayout")) return VK_NULL_HANDLE;
+    setLayouts_.emplace(signature, layout);
+    return layout;
+}
+
+VkPipelineLayout VulkanDevice::getOrCreatePipelineLayout(VkDescriptorSetLayout setLayout) {
+    std::scoped_lock lock(layoutMutex_);
+    auto it = pipelineLayouts_.find(setLayout);
+    if (it != pipelineLayouts_.end()) return it->second;
+    VkPipelineLayoutCreateInfo ci{VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO};
+    ci.setLayoutCount = 1;
+    ci.pSetLayouts = &setLayout;
+    VkPipelineLayout layout = VK_NULL_HANDLE;
+    if (!vkCheck(vkCreatePipelineLayout(device_, &ci, nullptr, &layout), "vkCreatePipelineLayout")) return VK_NULL_HANDLE;
+    pipelineLayouts_.emplace(setLayout, layout);
+    return layout;
+}
+
+bool VulkanDevice::allocateDescriptorSet(VkDescriptorSetLayout layout, VkDescriptorSet& outSet, VkDescriptorPool& outPool) {
+    std::scoped_lock lock(descriptorPoolMutex_);
+    VkDescriptorSetAllocateInfo ai{VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO};
+    ai.descriptorSetCount = 1;
+    ai.pSetLayouts = &layout;
+    // Tenta os pools existentes do mais novo ao mais antigo; sets liberados voltam aos pools antigos
+    for (auto it = descriptorPools_.rbegin(); it != descriptorPools_.rend(); ++it) {
+        ai.descriptorPool = *it;
+        if (vkAllocateDescriptorSets(device_, &ai, &outSet) == VK_SUCCESS) {
+            outPool = *it;
+            return true;
+        }
+    }
+    const VkDescriptorPoolSize sizes[] = {
+        {VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, kSetsPerDescriptorPool * 2},
+        {VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, kSetsPerDescriptorPool},
+        {VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, kSetsPerDescriptorPool * 2},
+        {VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, kSetsPerDescriptorPool},
+        {VK_DESCRIPTOR_TYPE_STORAGE_IMAGE, kSetsPerDescriptorPool},
+    };
+    VkDescriptorPoolCreateInfo pi{VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO};
+    pi.flags = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT;
+    pi.maxSets = kSetsPerDescriptorPool;
+    pi.poolSizeCount = static_cast<uint32_t>(std::size(sizes));
+    pi.pPoolSizes = sizes;
+    VkDescriptorPool pool = VK_NULL_HANDLE;
+    if (!vkCheck(vkCreateDescriptorPool(device_, &pi, nullptr, &pool), "vkCreateDescriptorPool")) return false;
+    descriptorPools_.push_back(pool);
+    ai.descriptorPool = pool;
+    if (!vkCheck(vkAllocateDescriptorSets(device_, &ai, &outSet), "vkAllocateDescriptorSets")) return false;
+    outPool = pool;
+    return true;
+}
+
+void VulkanDevice::freeDescriptorSet(VkDescriptorPool pool, VkDescriptorSet set) {
+    if (!pool || !set) return;
+    std::scoped_lock lock(descriptorPoolMutex_);
+    vkFreeDescriptorSets(device_, pool, 1, &set);
+}
+
+std::unique_ptr<IDescriptorSet> VulkanDevice::createDescriptorSet(const DescriptorSetDesc& desc) {
+    uint32_t dynamicCount = 0;
+    for (const auto& ub : desc.uniformBuffers) {
+        if (!ub.dynamic) continue;
+        if (ub.size == 0) { Core::log(Core::LogLevel::Error, "Vulkan: UniformBinding dinâmico exige size"); return nullptr; }
+        ++dynamicCount;
+    }
+    for (const auto& sb : desc.storageBuffers) {
+        if (!sb.buffer || sb.buffer->getUsage() != BufferUsage::Storage) {
+            Core::log(Core::LogLevel::Error, "Vulkan: StorageBufferBinding exige buffer com BufferUsage::Storage");
+            return nullptr;
+        }
+    }
+    for (const auto& st : desc.storageTextures) {
+        auto* tex = static_cast<VulkanTexture*>(st.texture);
+        if (!tex || st.mipLevel >= tex->storageViews_.size()) {
+            Core::log(Core::LogLevel::Error, "Vulkan: StorageTextureBinding exige textura de storage (mip existente)");
+            return nullptr;
+        }
+    }
+    VkDescriptorSetLayout layout = getOrCreateSetLayout(desc);
+    if (!layout) return nullptr;
+    VkDescriptorSet set = VK_NULL_HANDLE;
+    VkDescriptorPool pool = VK_NULL_HANDLE;
+    if (!allocateDescriptorSet(layout, set, pool)) return nullptr;
+
+    std::vector<VkDescriptorBufferInfo> bufferInfos;
+    std::vector<VkDescriptorImageInfo> imageInfos;
+    // reserve garante que os ponteiros guardados em writes não são invalidados
+    bufferInfos.reserve(desc.uniformBuffers.size() + desc.storageBuffers.size());
+    imageInfos.reserve(desc.sampledTextures.size() + desc.storageTextures.size());
+    std::vector<VkWriteDescriptorSet> writes;
+    for (const auto& ub : desc.uniformBuffers) {
+        auto* buf = static_cast<VulkanBuffer*>(ub.buffer);
+        if (!buf) continue;
+        bufferInfos.push_back({buf->buffer_, ub.offset, ub.size ? ub.size : VK_WHOLE_SIZE});
+        VkWriteDescriptorSet w{VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET};
+        w.dstSet = set;
+        w.dstBinding = ub.binding;
+        w.descriptorCount = 1;
+        w.descriptorType = ub.dynamic ? VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC : VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
+        w.pBufferInfo = &bufferInfos.back();
+        writes.push_back(w);
+    }
+    for (const auto& st : desc.sampledTextures) {
+        auto* tex = static_cast<VulkanTexture*>(st.texture);
+        auto* smp = static_cast<VulkanSampler*>(st.sampler);
+        if (!tex || !smp) continue;
+        imageInfos.push_back({smp->sampler_, tex->view_, tex->restingLayout_});
+        VkWriteDescriptorSet w{VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET};
+        w.dstSet = set;
+        w.dstBinding = st.binding;
+        w.descriptorCount = 1;
+        w.descriptorType = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        w.pImageInfo = &imageInfos.back();
+        writes.push_back(w);
+    }
+    for (const auto& sb : desc.storageBuffers) {
+        auto* buf = static_cast<VulkanBuffer*>(sb.buffer);
+        bufferInfos.push_back({buf->buffer_, sb.offset, sb.size ? sb.size : VK_WHOLE_SIZE});
+        VkWriteDescriptorSet w{VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET};
+        w.dstSet = set;
+        w.dstBinding = sb.binding;
+        w.descriptorCount = 1;
+        w.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        w.pBufferInfo = &bufferInfos.back();
+        writes.push_back(w);
+    }
+    for (const auto& st : desc.storageTextures) {
+        auto* tex = static_cast<VulkanTexture*>(st.texture);
+        imageInfos.push_back({VK_NULL_HANDLE, tex->storageViews_[st.mipLevel], VK_IMAGE_LAYOUT_GENERAL});
+        VkWriteDescriptorSet w{VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET};
+        w.dstSet = set;
+        w.dstBinding = st.binding;
+        w.descriptorCount = 1;
+        w.descriptorType = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
+        w.pImageInfo = &imageInfos.back();
+        writes.push_back(w);
+    }
+    if (!writes.empty()) vkUpdateDescriptorSets(device_, static_cast<uint32_t>(writes.size()), writes.data(), 0, nullptr);
+    return std::make_unique<VulkanDescriptorSet>(*this, set, pool, layout, dynamicCount);
+}
+
+// ---------------- API imediata (encaminha para uma command list interna) ----------------
+
+void VulkanDevice::beginRenderPass(IRenderPass* renderPass, ISwapchain* target) {
+    ensureImmediateList();
+    immediate_->beginRenderPass(renderPass, target);
+}
+
+void VulkanDevice::endRenderPass() {
+    if (immediateOpen_) immediate_->endRenderPass();
+}
+
+void VulkanDevice::setGraphicsPipeline(IGraphicsPipeline* pipeline) {
+    ensureImmediateList();
+    immediate_->setGraphicsPipeline(pipeline);
+}
+
+void VulkanDevice::setVertexBuffer(IBuffer* buffer) {
+    ensureImmediateList();
+    immediate_->setVertexBuffer(buffer);
+}
+
+void VulkanDevice::setIndexBuffer(IBuffer* buffer) {
+    ensureImmediateList();
+    immediate_->setIndexBuffer(buffer);
+}
+
+void VulkanDevice::bindDescriptorSet(IDescriptorSet* set, std::span<const uint32_t> dynamicOffsets) {
+    ensureImmediateList();
+    immediate_->bindDescriptorSet(set, dynamicOffsets);
+}
+
+void VulkanDevice::draw(uint32_t vertexCount, uint32_t firstVertex) {
+    ensureImmediateList();
+    immediate_->draw(vertexCount, firstVertex);
+}
+
+void VulkanDevice::drawIndexed(uint32_t indexCount, uint32_t firstIndex, IndexType indexType) {
+    ensureImmediateList();
+    immediate_->drawIndexed(indexCount, firstIndex, indexType);
+}
+
+void VulkanDevice::setInstanceBuffer(IBuffer* buffer) {
+    ensureImmediateList();
+    immediate_->setInstanceBuffer(buffer);
+}
+
+void VulkanDevice::drawInstanced(uint32_t vertexCount, uint32_t firstVertex, uint32_t instanceCount, uint32_t firstInstance) {
+    ensureImmediateList();
+    immediate_->drawInstanced(vertexCount, firstVertex, instanceCount, firstInstance);
+}
+
+void VulkanDevice::drawIndexedInstanced(uint32_t indexCount, uint32_t firstIndex, IndexType indexType, uint32_t instanceCount, uint32_t firstInstance) {
+    ensureImmediateList();
+    immediate_->drawIndexedInstanced(indexCount, firstIndex, indexType, instanceCount, firstInstance);
+}
+
+void VulkanDevice::setComputePipeline(IComputePipeline* pipeline) {
+    ensureImmediateList();
+    immediate_->setComputePipeline(pipeline);
+}
+
+void VulkanDevice::dispatch(uint32_t groupsX, uint32_t groupsY, uint32_t groupsZ) {
+    ensureImmediateList();
+    immediate_->dispatch(groupsX, groupsY, groupsZ);
+}
+
+void VulkanDevice::dispatchIndirect(IBuffer* buffer, size_t offset) {
+    ensureImmediateList();
+    immediate_->dispatchIndirect(buffer, offset);
+}
+
+void VulkanDevice::memoryBarrier(uint32_t barriers) {
+    ensureImmediateList();
+    immediate_->memoryBarrier(barriers);
+}
+
+std::unique_ptr<ICommandList> VulkanDevice::createCommandList() {
+    return std::make_unique<VulkanCommandList>(*this);
+}
+
+std::unique_ptr<ICommandBundle> VulkanDevice::createCommandBundle() {
+    return std::make_unique<RecordedCommandBundle>();
+}
+
+void VulkanDevice::setDebugWireframe(bool enable) {
+    if (enable && !fillModeNonSolid_) {
+        Core::log(Core::LogLevel::Warn, "Vulkan: fillModeNonSolid indisponível; ignorando wireframe");
+        return;
+    }
+    wireframe_ = enable;
+    if (immediate_) immediate_->setDebugWireframe(enable);
+}
+
+}
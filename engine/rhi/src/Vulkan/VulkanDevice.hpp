@@ -0,0 +1,181 @@
+#pragma once
+
+#include "Aurora/RHI/RHI.hpp"
+#include "VulkanCommon.hpp"
+#include "VulkanResources.hpp"
+#include "VulkanCommandList.hpp"
+#include "VulkanSwapchain.hpp"
+
+#include <array>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace Aurora::RHI {
+
+// Backend Vulkan.
+// Contrato de threads: createCommandList/gravação de ICommandList podem ocorrer em qualquer thread
+// (cada lista gravada por uma única thread entre begin/end); beginFrame/endFrame/submit/present e a
+// API imediata devem ser chamados na thread principal.
+class VulkanDevice final : public IDevice {
+public:
+    VulkanDevice() = default;
+    ~VulkanDevice() override;
+
+    // Cria instance/device/filas; retorna false se não houver implementação Vulkan utilizável
+    bool initialize();
+
+    const char* getName() const override { return "Vulkan"; }
+    void beginFrame() override;
+    void endFrame() override;
+    // Sem timestamp queries neste backend ainda (Capabilities::supportsGpuTiming = false)
+    float getGpuFrameTimeMs() const override { return 0.0f; }
+    uint32_t getFramesInFlight() const override { return kVkMaxFramesInFlight; }
+    uint32_t getFrameSlot() const override { return frameSlot(); }
+    std::unique_ptr<ISwapchain> createSwapchain(const SwapchainDesc& desc) override;
+    std::unique_ptr<IRenderPass> createRenderPass(const RenderPassDesc& desc) override;
+    void beginRenderPass(IRenderPass* renderPass, ISwapchain* target) override;
+    void endRenderPass() override;
+
+    std::unique_ptr<IShaderModule> createShaderModule(const ShaderModuleDesc& desc) override;
+    std::unique_ptr<IBuffer> createBuffer(const void* data, size_t bytes, BufferUsage usage, BufferUpdate update = BufferUpdate::Static) override;
+    std::unique_ptr<IGraphicsPipeline> createGraphicsPipeline(const GraphicsPipelineDesc& desc) override;
+    std::unique_ptr<IComputePipeline> createComputePipeline(const ComputePipelineDesc& desc) override;
+    std::unique_ptr<IDescriptorSet> createDescriptorSet(const DescriptorSetDesc& desc) override;
+    void updateBuffer(IBuffer* buffer, const void* data, size_t bytes, size_t dstOffset = 0) override;
+    std::unique_ptr<ITexture> createTexture(const TextureDesc& desc, const void* initialPixelsRGBA8) override;
+    std::unique_ptr<ISampler> createSampler(const SamplerDesc& desc) override;
+
+    void setGraphicsPipeline(IGraphicsPipeline* pipeline) override;
+    void setVertexBuffer(IBuffer* buffer) override;
+    void setIndexBuffer(IBuffer* buffer) override;
+    void bindDescriptorSet(IDescriptorSet* set, std::span<const uint32_t> dynamicOffsets = {}) override;
+    void draw(uint32_t vertexCount, uint32_t firstVertex) override;
+    void drawIndexed(uint32_t indexCount, uint32_t firstIndex, IndexType indexType) override;
+    void setInstanceBuffer(IBuffer* buffer) override;
+    void drawInstanced(uint32_t vertexCount, uint32_t firstVertex, uint32_t instanceCount, uint32_t firstInstance) override;
+    void drawIndexedInstanced(uint32_t indexCount, uint32_t firstIndex, IndexType indexType, uint32_t instanceCount, uint32_t firstInstance) override;
+    void setComputePipeline(IComputePipeline* pipeline) override;
+    void dispatch(uint32_t groupsX, uint32_t groupsY, uint32_t groupsZ) override;
+    void dispatchIndirect(IBuffer* buffer, size_t offset) override;
+    void memoryBarrier(uint32_t barriers) override;
+
+    std::unique_ptr<ICommandList> createCommandList() override;
+    std::unique_ptr<ICommandBundle> createCommandBundle() override;
+    void submit(ICommandList* list) override;
+    Capabilities getCapabilities() const override { return caps_; }
+    void setDebugWireframe(bool enable) override;
+
+    // ---- Interno ao backend ----
+    VkInstance vkInstance() const { return instance_; }
+    VkPhysicalDevice vkPhysicalDevice() const { return physicalDevice_; }
+    VkDevice vkDevice() const { return device_; }
+    VkQueue vkQueue() const { return queue_; }
+    uint32_t queueFamily() const { return queueFamily_; }
+    VkPipelineCache pipelineCache() const { return pipelineCache_; }
+    uint32_t frameSlot() const { return frameSlot_.load(std::memory_order_acquire); }
+    bool defaultWireframe() const { return wireframe_; }
+    bool supportsWireframe() const { return fillModeNonSolid_; }
+    std::mutex& queueMutex() { return queueMutex_; }
+
+    // Command buffer primário do pool da thread atual para o frame corrente
+    VkCommandBuffer acquireCommandBuffer();
+    // Destruição adiada até a GPU terminar o frame corrente (thread-safe)
+    void deferDestroy(std::function<void()> fn);
+
+    VkDescriptorSetLayout getOrCreateSetLayout(const DescriptorSetDesc& desc);
+    VkPipelineLayout getOrCreatePipelineLayout(VkDescriptorSetLayout setLayout);
+    VkDescriptorSetLayout emptySetLayout() const { return emptySetLayout_; }
+    // Aloca um descriptor set (cria novos pools quando o atual esgota)
+    bool allocateDescriptorSet(VkDescriptorSetLayout layout, VkDescriptorSet& outSet, VkDescriptorPool& outPool);
+    void freeDescriptorSet(VkDescriptorPool pool, VkDescriptorSet set);
+    VkRenderPass getOrCreateRenderPass(const VulkanRenderPassKey& key);
+    VkFormat depthFormat(TextureFormat fmt) const;
+    VkFormat swapchainDepthFormat() const { return swapchainDepthFormat_; }
+    uint32_t findMemoryType(uint32_t typeBits, VkMemoryPropertyFlags props) const;
+    bool createRawBuffer(VkDeviceSize size, VkBufferUsageFlags usage, VkMemoryPropertyFlags props,
+                         VkBuffer& outBuffer, VkDeviceMemory& outMemory, void** outMapped);
+    bool createRawImage(const VkImageCreateInfo& info, VkImage& outImage, VkDeviceMemory& outMemory);
+    // Executa gravação pontual e espera a fila (uso em criação de recursos)
+    void immediateSubmit(const std::function<void(VkCommandBuffer)>& record);
+
+    // Envia as submissões pendentes do frame numa única batch (chamado pelo swapchain ao apresentar)
+    void flushSubmissions(VkSemaphore waitSemaphore, VkSemaphore signalSemaphore);
+    // Swapchain cuja imagem foi adquirida no frame corrente (apresentado no endFrame se esquecido)
+    void registerSwapchainUse(VulkanSwapchain* swapchain);
+    void releaseSwapchainUse(VulkanSwapchain* swapchain);
+
+private:
+    struct ThreadCommandPools {
+        struct PerFrame {
+            VkCommandPool pool{VK_NULL_HANDLE};
+            std::vector<VkCommandBuffer> buffers{};
+            size_t used{0};
+        };
+        std::array<PerFrame, kVkMaxFramesInFlight> frames{};
+    };
+
+    struct FrameData {
+        VkFence fence{VK_NULL_HANDLE};
+        std::vector<std::function<void()>> deletions{};
+    };
+
+    bool createInstance();
+    bool pickPhysicalDevice();
+    bool createLogicalDevice();
+    void loadPipelineCache();
+    void savePipelineCache();
+    VkCommandBuffer uploadCommandBuffer();
+    void closeUploadCommandBuffer();
+    void flushImmediateList();
+    void ensureImmediateList();
+
+    VkInstance instance_{VK_NULL_HANDLE};
+    VkDebugUtilsMessengerEXT debugMessenger_{VK_NULL_HANDLE};
+    VkPhysicalDevice physicalDevice_{VK_NULL_HANDLE};
+    VkPhysicalDeviceMemoryProperties memoryProps_{};
+    VkDevice device_{VK_NULL_HANDLE};
+    VkQueue queue_{VK_NULL_HANDLE};
+    uint32_t queueFamily_{0};
+    VkPipelineCache pipelineCache_{VK_NULL_HANDLE};
+    VkFormat swapchainDepthFormat_{VK_FORMAT_D32_SFLOAT};
+    bool fillModeNonSolid_{false};
+    bool wireframe_{false};
+    Capabilities caps_{};
+
+    std::atomic<uint32_t> frameSlot_{0};
+    std::array<FrameData, kVkMaxFramesInFlight> frames_{};
+    std::mutex deletionMutex_{};
+    // Destruições pedidas desde o último endFrame; presas ao fence do próximo submit
+    std::vector<std::function<void()>> pendingDeletions_{};
+    std::mutex queueMutex_{};
+
+    // Pools por thread (um VkCommandPool por thread e por frame em voo)
+    std::mutex poolsMutex_{};
+    std::unordered_map<std::thread::id, std::unique_ptr<ThreadCommandPools>> threadPools_{};
+
+    // Descriptors
+    std::mutex layoutMutex_{};
+    std::unordered_map<std::string, VkDescriptorSetLayout> setLayouts_{};
+    std::unordered_map<VkDescriptorSetLayout, VkPipelineLayout> pipelineLayouts_{};
+    VkDescriptorSetLayout emptySetLayout_{VK_NULL_HANDLE};
+    std::mutex renderPassMutex_{};
+    std::unordered_map<VulkanRenderPassKey, VkRenderPass, VulkanRenderPassKeyHash> renderPasses_{};
+    std::mutex descriptorPoolMutex_{};
+    std::vector<VkDescriptorPool> descriptorPools_{};
+
+    // Submissões pendentes do frame (ordem de submit preservada)
+    std::vector<VkCommandBuffer> pendingSubmits_{};
+    VkCommandBuffer uploadCmd_{VK_NULL_HANDLE};
+    std::mutex uploadMutex_{};
+    std::unique_ptr<VulkanCommandList> immediate_{};
+    bool immediateOpen_{false};
+    std::atomic<VulkanSwapchain*> frameSwapchain_{nullptr}; // swapchain adquirido no frame corrente
+};
+
+}
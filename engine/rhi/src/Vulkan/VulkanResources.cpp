@@ -0,0 +1,253 @@
+#include "VulkanResources.hpp"
+#include "VulkanDevice.hpp"
+#include "VulkanConversions.hpp"
+#include "../GpuMemoryTracking.hpp"
+#include "Aurora/Core/Log.hpp"
+
+#include <array>
+#include <vector>
+
+namespace Aurora::RHI {
+
+// Destruidores: a GPU pode ainda referenciar o objeto, então tudo passa pela fila de destruição do frame
+
+VulkanBuffer::~VulkanBuffer() {
+    untrackBufferMemory(size_);
+    VkDevice dev = device_.vkDevice();
+    VkBuffer buffer = buffer_;
+    VkDeviceMemory memory = memory_;
+    device_.deferDestroy([dev, buffer, memory] {
+        if (buffer) vkDestroyBuffer(dev, buffer, nullptr);
+        if (memory) vkFreeMemory(dev, memory, nullptr);
+    });
+}
+
+VulkanTexture::~VulkanTexture() {
+    untrackTextureMemory(desc_);
+    VkDevice dev = device_.vkDevice();
+    VkImage image = image_;
+    VkDeviceMemory memory = memory_;
+    VkImageView view = view_;
+    std::vector<VkImageView> storageViews = storageViews_;
+    device_.deferDestroy([dev, image, memory, view, storageViews] {
+        for (VkImageView v : storageViews) vkDestroyImageView(dev, v, nullptr);
+        if (view) vkDestroyImageView(dev, view, nullptr);
+        if (image) vkDestroyImage(dev, image, nullptr);
+        if (memory) vkFreeMemory(dev, memory, nullptr);
+    });
+}
+
+VulkanSampler::~VulkanSampler() {
+    VkDevice dev = device_.vkDevice();
+    VkSampler sampler = sampler_;
+    device_.deferDestroy([dev, sampler] { if (sampler) vkDestroySampler(dev, sampler, nullptr); });
+}
+
+VulkanShaderModule::~VulkanShaderModule() {
+    VkDevice dev = device_.vkDevice();
+    VkShaderModule module = module_;
+    device_.deferDestroy([dev, module] { if (module) vkDestroyShaderModule(dev, module, nullptr); });
+}
+
+VulkanDescriptorSet::~VulkanDescriptorSet() {
+    VulkanDevice* device = &device_;
+    VkDescriptorPool pool = pool_;
+    VkDescriptorSet set = set_;
+    device_.deferDestroy([device, pool, set] { device->freeDescriptorSet(pool, set); });
+}
+
+VulkanGraphicsPipeline::VulkanGraphicsPipeline(VulkanDevice& device, const GraphicsPipelineDesc& desc)
+    : device_(device), layout_(desc.vertexLayout), state_(desc.state) {
+    // Os módulos pertencem ao chamador (AssetManager) e devem sobreviver ao pipeline,
+    // pois as variantes são criadas sob demanda
+    if (auto* vs = static_cast<VulkanShaderModule*>(desc.vertexShader)) {
+        vertex_ = vs->module_;
+        vertexSpecialization_ = vs->specialization_;
+    }
+    if (auto* fs = static_cast<VulkanShaderModule*>(desc.fragmentShader)) {
+        fragment_ = fs->module_;
+        fragmentSpecialization_ = fs->specialization_;
+    }
+}
+
+VulkanGraphicsPipeline::~VulkanGraphicsPipeline() {
+    VkDevice dev = device_.vkDevice();
+    std::vector<VkPipeline> pipelines;
+    pipelines.reserve(variants_.size());
+    for (auto& kv : variants_) pipelines.push_back(kv.second);
+    device_.deferDestroy([dev, pipelines] {
+        for (VkPipeline p : pipelines) if (p) vkDestroyPipeline(dev, p, nullptr);
+    });
+}
+
+VkPipeline VulkanGraphicsPipeline::getOrCreate(VkRenderPass renderPass, uint32_t colorAttachmentCount, VkPipelineLayout layout, bool wireframe) {
+    using namespace VulkanConversions;
+    if (!device_.supportsWireframe()) wireframe = false;
+    VariantKey key{renderPass, layout, wireframe};
+    std::scoped_lock lock(mutex_);
+    auto it = variants_.find(key);
+    if (it != variants_.end()) return it->second;
+
+    std::array<VkPipelineShaderStageCreateInfo, 2> stages{};
+    uint32_t stageCount = 0;
+    const VkSpecializationInfo vertexSpec = vertexSpecialization_.info();
+    const VkSpecializationInfo fragmentSpec = fragmentSpecialization_.info();
+    if (vertex_) {
+        auto& s = stages[stageCount++];
+        s.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+        s.stage = VK_SHADER_STAGE_VERTEX_BIT;
+        s.module = vertex_;
+        s.pName = "main";
+        if (!vertexSpecialization_.empty()) s.pSpecializationInfo = &vertexSpec;
+    }
+    if (fragment_) {
+        auto& s = stages[stageCount++];
+        s.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+        s.stage = VK_SHADER_STAGE_FRAGMENT_BIT;
+        s.module = fragment_;
+        s.pName = "main";
+        if (!fragmentSpecialization_.empty()) s.pSpecializationInfo = &fragmentSpec;
+    }
+
+    // Binding 0: por vértice (setVertexBuffer); binding 1: por instância (setInstanceBuffer)
+    VkVertexInputBindingDescription bindings[2]{};
+    uint32_t bindingCount = 0;
+    std::vector<VkVertexInputAttributeDescription> attributes;
+    attributes.reserve(layout_.attributes.size() + layout_.instanceAttributes.size());
+    auto addBinding = [&](uint32_t binding, uint32_t stride, VkVertexInputRate rate, const std::vector<VertexAttribute>& attrs) {
+        if (attrs.empty()) return;
+        bindings[bindingCount].binding = binding;
+        bindings[bindingCount].stride = stride;
+        bindings[bindingCount].inputRate = rate;
+        ++bindingCount;
+        for (const auto& a : attrs) {
+            VkVertexInputAttributeDescription ad{};
+            ad.location = a.location;
+            ad.binding = binding;
+            ad.format = toVkVertexFormat(a.components);
+            ad.offset = a.offset;
+            attributes.push_back(ad);
+        }
+    };
+    addBinding(0, layout_.stride, VK_VERTEX_INPUT_RATE_VERTEX, layout_.attributes);
+    addBinding(1, layout_.instanceStride, VK_VERTEX_INPUT_RATE_INSTANCE, layout_.instanceAttributes);
+    VkPipelineVertexInputStateCreateInfo vertexInput{VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO};
+    if (!attributes.empty()) {
+        vertexInput.vertexBindingDescriptionCount = bindingCount;
+        vertexInput.pVertexBindingDescriptions = bindings;
+        vertexInput.vertexAttributeDescriptionCount = static_cast<uint32_t>(attributes.size());
+        vertexInput.pVertexAttributeDescriptions = attributes.data();
+    }
+
+    VkPipelineInputAssemblyStateCreateInfo inputAssembly{VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO};
+    inputAssembly.topology = state_.topology == PrimitiveTopology::LineList ? VK_PRIMITIVE_TOPOLOGY_LINE_LIST : VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+
+    VkPipelineViewportStateCreateInfo viewport{VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO};
+    viewport.viewportCount = 1;
+    viewport.scissorCount = 1;
+
+    // Viewport é invertido no Y (altura negativa) para manter a convenção do GL; por isso a
+    // orientação das faces também segue a convenção do GL
+    VkPipelineRasterizationStateCreateInfo raster{VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO};
+    raster.polygonMode = wireframe ? VK_POLYGON_MODE_LINE : VK_POLYGON_MODE_FILL;
+    raster.cullMode = toVkCullMode(state_.raster.cullMode);
+    raster.frontFace = state_.raster.frontFaceCCW ? VK_FRONT_FACE_COUNTER_CLOCKWISE : VK_FRONT_FACE_CLOCKWISE;
+    raster.lineWidth = 1.0f;
+
+    VkPipelineMultisampleStateCreateInfo multisample{VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO};
+    multisample.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+
+    const auto& ds = state_.depthStencil;
+    VkPipelineDepthStencilStateCreateInfo depth{VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO};
+    depth.depthTestEnable = ds.depthTestEnable ? VK_TRUE : VK_FALSE;
+    depth.depthWriteEnable = (ds.depthTestEnable && ds.depthWriteEnable) ? VK_TRUE : VK_FALSE;
+    depth.depthCompareOp = toVkCompareOp(ds.depthFunc);
+    depth.stencilTestEnable = ds.stencilEnable ? VK_TRUE : VK_FALSE;
+    depth.front.compareOp = VK_COMPARE_OP_ALWAYS;
+    depth.front.compareMask = ds.stencilReadMask;
+    depth.front.writeMask = ds.stencilWriteMask;
+    depth.back = depth.front;
+
+    const auto& bs = state_.blend;
+    VkPipelineColorBlendAttachmentState blendAttachment{};
+    blendAttachment.blendEnable = bs.enable ? VK_TRUE : VK_FALSE;
+    blendAttachment.srcColorBlendFactor = toVkBlendFactor(bs.srcColor);
+    blendAttachment.dstColorBlendFactor = toVkBlendFactor(bs.dstColor);
+    blendAttachment.colorBlendOp = toVkBlendOp(bs.colorOp);
+    blendAttachment.srcAlphaBlendFactor = toVkBlendFactor(bs.srcAlpha);
+    blendAttachment.dstAlphaBlendFactor = toVkBlendFactor(bs.dstAlpha);
+    blendAttachment.alphaBlendOp = toVkBlendOp(bs.alphaOp);
+    blendAttachment.colorWriteMask = toVkColorWriteMask(bs.colorWriteMask);
+    std::vector<VkPipelineColorBlendAttachmentState> blendAttachments(colorAttachmentCount, blendAttachment);
+    VkPipelineColorBlendStateCreateInfo blend{VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO};
+    blend.attachmentCount = colorAttachmentCount;
+    blend.pAttachments = blendAttachments.data();
+
+    const VkDynamicState dynamicStates[] = { VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR };
+    VkPipelineDynamicStateCreateInfo dynamic{VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO};
+    dynamic.dynamicStateCount = 2;
+    dynamic.pDynamicStates = dynamicStates;
+
+    VkGraphicsPipelineCreateInfo ci{VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO};
+    ci.stageCount = stageCount;
+    ci.pStages = stages.data();
+    ci.pVertexInputState = &vertexInput;
+    ci.pInputAssemblyState = &inputAssembly;
+    ci.pViewportState = &viewport;
+    ci.pRasterizationState = &raster;
+    ci.pMultisampleState = &multisample;
+    ci.pDepthStencilState = &depth;
+    ci.pColorBlendState = &blend;
+    ci.pDynamicState = &dynamic;
+    ci.layout = layout;
+    ci.renderPass = renderPass;
+    ci.subpass = 0;
+
+    VkPipeline pipeline = VK_NULL_HANDLE;
+    if (!vkCheck(vkCreateGraphicsPipelines(device_.vkDevice(), device_.pipelineCache(), 1, &ci, nullptr, &pipeline), "vkCreateGraphicsPipelines")) {
+        pipeline = VK_NULL_HANDLE;
+    }
+    variants_.emplace(key, pipeline);
+    return pipeline;
+}
+
+VulkanComputePipeline::VulkanComputePipeline(VulkanDevice& device, const ComputePipelineDesc& desc) : device_(device) {
+    if (auto* cs = static_cast<VulkanShaderModule*>(desc.computeShader)) {
+        compute_ = cs->module_;
+        computeSpecialization_ = cs->specialization_;
+    }
+}
+
+VulkanComputePipeline::~VulkanComputePipeline() {
+    VkDevice dev = device_.vkDevice();
+    std::vector<VkPipeline> pipelines;
+    pipelines.reserve(variants_.size());
+    for (auto& kv : variants_) pipelines.push_back(kv.second);
+    device_.deferDestroy([dev, pipelines] {
+        for (VkPipeline p : pipelines) if (p) vkDestroyPipeline(dev, p, nullptr);
+    });
+}
+
+VkPipeline VulkanComputePipeline::getOrCreate(VkPipelineLayout layout) {
+    std::scoped_lock lock(mutex_);
+    auto it = variants_.find(layout);
+    if (it != variants_.end()) return it->second;
+
+    VkComputePipelineCreateInfo ci{VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO};
+    ci.stage.sType = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+    ci.stage.stage = VK_SHADER_STAGE_COMPUTE_BIT;
+    ci.stage.module = compute_;
+    ci.stage.pName = "main";
+    const VkSpecializationInfo spec = computeSpecialization_.info();
+    if (!computeSpecialization_.empty()) ci.stage.pSpecializationInfo = &spec;
+    ci.layout = layout;
+
+    VkPipeline pipeline = VK_NULL_HANDLE;
+    if (!vkCheck(vkCreateComputePipelines(device_.vkDevice(), device_.pipelineCache(), 1, &ci, nullptr, &pipeline), "vkCreateComputePipelines")) {
+        pipeline = VK_NULL_HANDLE;
+    }
+    variants_.emplace(layout, pipeline);
+    return pipeline;
+}
+
+}
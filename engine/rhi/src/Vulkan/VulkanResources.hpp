@@ -0,0 +1,178 @@
+#pragma once
+
+#include "Aurora/RHI/RHI.hpp"
+#include "VulkanCommon.hpp"
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace Aurora::RHI {
+
+class VulkanDevice; // fwd
+
+class VulkanBuffer final : public IBuffer {
+public:
+    VulkanBuffer(VulkanDevice& device, size_t size, BufferUsage usage, VkBuffer buffer, VkDeviceMemory memory, void* mapped)
+        : buffer_(buffer), memory_(memory), mapped_(mapped), device_(device), size_(size), usage_(usage) {}
+    ~VulkanBuffer() override;
+    size_t getSize() const override { return size_; }
+    BufferUsage getUsage() const override { return usage_; }
+    VkBuffer buffer_{VK_NULL_HANDLE};
+    VkDeviceMemory memory_{VK_NULL_HANDLE};
+    void* mapped_{nullptr}; // persistentemente mapeado (host visible/coherent)
+private:
+    VulkanDevice& device_;
+    size_t size_{};
+    BufferUsage usage_{};
+};
+
+class VulkanTexture final : public ITexture {
+public:
+    VulkanTexture(VulkanDevice& device, const TextureDesc& desc, VkFormat format, VkImage image, VkDeviceMemory memory, VkImageView view)
+        : image_(image), memory_(memory), view_(view), format_(format), device_(device), desc_(desc) {}
+    ~VulkanTexture() override;
+    TextureDesc getDesc() const override { return desc_; }
+    VkImage image_{VK_NULL_HANDLE};
+    VkDeviceMemory memory_{VK_NULL_HANDLE};
+    VkImageView view_{VK_NULL_HANDLE};
+    VkFormat format_{VK_FORMAT_UNDEFINED};
+    // Layout em que a textura fica entre passes (render passes restauram este layout)
+    VkImageLayout restingLayout_{VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL};
+    // TextureUsage::Storage: uma view por mip (imagens de storage exigem levelCount == 1)
+    std::vector<VkImageView> storageViews_{};
+private:
+    VulkanDevice& device_;
+    TextureDesc desc_{};
+};
+
+class VulkanSampler final : public ISampler {
+public:
+    VulkanSampler(VulkanDevice& device, VkSampler sampler) : sampler_(sampler), device_(device) {}
+    ~VulkanSampler() override;
+    VkSampler sampler_{VK_NULL_HANDLE};
+private:
+    VulkanDevice& device_;
+};
+
+// Constantes de especialização de um módulo, aplicadas na criação de cada VkPipeline
+struct VulkanSpecialization {
+    std::vector<VkSpecializationMapEntry> entries;
+    std::vector<uint32_t> data;
+    bool empty() const { return entries.empty(); }
+    // Aponta para os vetores: válido enquanto este objeto não mudar
+    VkSpecializationInfo info() const {
+        return {static_cast<uint32_t>(entries.size()), entries.data(), data.size() * sizeof(uint32_t), data.data()};
+    }
+};
+
+class VulkanShaderModule final : public IShaderModule {
+public:
+    VulkanShaderModule(VulkanDevice& device, ShaderStage stage, VkShaderModule module, VulkanSpecialization specialization)
+        : module_(module), specialization_(std::move(specialization)), device_(device), stage_(stage) {}
+    ~VulkanShaderModule() override;
+    ShaderStage getStage() const override { return stage_; }
+    VkShaderModule module_{VK_NULL_HANDLE};
+    VulkanSpecialization specialization_{};
+private:
+    VulkanDevice& device_;
+    ShaderStage stage_;
+};
+
+class VulkanDescriptorSet final : public IDescriptorSet {
+public:
+    VulkanDescriptorSet(VulkanDevice& device, VkDescriptorSet set, VkDescriptorPool pool, VkDescriptorSetLayout layout, uint32_t dynamicCount)
+        : set_(set), pool_(pool), layout_(layout), dynamicCount_(dynamicCount), device_(device) {}
+    ~VulkanDescriptorSet() override;
+    VkDescriptorSet set_{VK_NULL_HANDLE};
+    VkDescriptorPool pool_{VK_NULL_HANDLE};
+    VkDescriptorSetLayout layout_{VK_NULL_HANDLE}; // pertence ao cache do device
+    uint32_t dynamicCount_{0}; // bindings UNIFORM_BUFFER_DYNAMIC (offsets exigidos no bind)
+private:
+    VulkanDevice& device_;
+};
+
+// Chave de VkRenderPass: formatos, operações de load/store por attachment e layouts finais.
+// Os VkRenderPass vivem num cache do device até a destruição dele, então handles nunca são reaproveitados
+// enquanto pipelines criados contra eles ainda existem.
+struct VulkanRenderPassKey {
+    std::vector<VkFormat> colorFormats;
+    std::vector<VkAttachmentLoadOp> colorLoads;   // um por formato de cor
+    std::vector<VkAttachmentStoreOp> colorStores;
+    VkFormat depthFormat{VK_FORMAT_UNDEFINED};
+    VkAttachmentLoadOp depthLoad{VK_ATTACHMENT_LOAD_OP_CLEAR};
+    VkAttachmentStoreOp depthStore{VK_ATTACHMENT_STORE_OP_STORE};
+    VkImageLayout colorFinalLayout{VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL};
+    VkImageLayout depthFinalLayout{VK_IMAGE_LAYOUT_DEPTH_STENCIL_READ_ONLY_OPTIMAL};
+    bool operator==(const VulkanRenderPassKey& o) const {
+        return colorFormats == o.colorFormats && colorLoads == o.colorLoads && colorStores == o.colorStores
+            && depthFormat == o.depthFormat && depthLoad == o.depthLoad && depthStore == o.depthStore
+            && colorFinalLayout == o.colorFinalLayout && depthFinalLayout == o.depthFinalLayout;
+    }
+};
+
+struct VulkanRenderPassKeyHash {
+    size_t operator()(const VulkanRenderPassKey& k) const {
+        size_t h = static_cast<size_t>(k.depthFormat) * 1315423911u ^ static_cast<size_t>(k.colorFinalLayout);
+        h ^= static_cast<size_t>(k.depthFinalLayout) << 4;
+        h ^= (static_cast<size_t>(k.depthLoad) << 8) ^ (static_cast<size_t>(k.depthStore) << 12);
+        for (VkFormat f : k.colorFormats) h = (h * 31u) ^ static_cast<size_t>(f);
+        for (VkAttachmentLoadOp op : k.colorLoads) h = (h * 31u) ^ static_cast<size_t>(op);
+        for (VkAttachmentStoreOp op : k.colorStores) h = (h * 31u) ^ static_cast<size_t>(op);
+        return h;
+    }
+};
+
+// RenderPassDesc é independente de formato; o VkRenderPass é resolvido no begin a partir do destino
+class VulkanRenderPass final : public IRenderPass {
+public:
+    explicit VulkanRenderPass(const RenderPassDesc& desc) : desc_(desc) {}
+    RenderPassDesc desc_{};
+};
+
+// O VkPipeline depende do render pass e do layout do descriptor set em uso; criado sob demanda
+// no primeiro draw de cada combinação (thread-safe, alimenta o VkPipelineCache do device).
+class VulkanGraphicsPipeline final : public IGraphicsPipeline {
+public:
+    VulkanGraphicsPipeline(VulkanDevice& device, const GraphicsPipelineDesc& desc);
+    ~VulkanGraphicsPipeline() override;
+    VkPipeline getOrCreate(VkRenderPass renderPass, uint32_t colorAttachmentCount, VkPipelineLayout layout, bool wireframe);
+private:
+    struct VariantKey {
+        VkRenderPass renderPass;
+        VkPipelineLayout layout;
+        bool wireframe;
+        bool operator==(const VariantKey& o) const { return renderPass == o.renderPass && layout == o.layout && wireframe == o.wireframe; }
+    };
+    struct VariantKeyHash {
+        size_t operator()(const VariantKey& k) const {
+            return std::hash<VkRenderPass>()(k.renderPass) * 31u ^ std::hash<VkPipelineLayout>()(k.layout) ^ static_cast<size_t>(k.wireframe);
+        }
+    };
+
+    VulkanDevice& device_;
+    VkShaderModule vertex_{VK_NULL_HANDLE};
+    VkShaderModule fragment_{VK_NULL_HANDLE};
+    VulkanSpecialization vertexSpecialization_{};
+    VulkanSpecialization fragmentSpecialization_{};
+    VertexLayoutDesc layout_{};
+    PipelineStateDesc state_{};
+    std::mutex mutex_{};
+    std::unordered_map<VariantKey, VkPipeline, VariantKeyHash> variants_{};
+};
+
+// Compute: o VkPipeline depende só do layout de descriptors bindado no dispatch; criado sob demanda
+class VulkanComputePipeline final : public IComputePipeline {
+public:
+    VulkanComputePipeline(VulkanDevice& device, const ComputePipelineDesc& desc);
+    ~VulkanComputePipeline() override;
+    VkPipeline getOrCreate(VkPipelineLayout layout);
+private:
+    VulkanDevice& device_;
+    VkShaderModule compute_{VK_NULL_HANDLE};
+    VulkanSpecialization computeSpecialization_{};
+    std::mutex mutex_{};
+    std::unordered_map<VkPipelineLayout, VkPipeline> variants_{};
+};
+
+}
@@ -0,0 +1,323 @@
+#include "VulkanSwapchain.hpp"
+#include "VulkanDevice.hpp"
+#include "Aurora/Core/Log.hpp"
+
+#include <algorithm>
+
+namespace Aurora::RHI {
+
+VulkanSwapchain::VulkanSwapchain(VulkanDevice& device, const SwapchainDesc& desc)
+    : device_(device), windowHandle_(desc.windowHandle), width_(desc.width), height_(desc.height), vsync_(desc.vsync) {}
+
+VulkanSwapchain::~VulkanSwapchain() {
+    VkDevice dev = device_.vkDevice();
+    vkDeviceWaitIdle(dev);
+    device_.releaseSwapchainUse(this);
+    destroyResources(false);
+    for (auto s : imageAvailable_) if (s) vkDestroySemaphore(dev, s, nullptr);
+    for (auto s : renderFinished_) if (s) vkDestroySemaphore(dev, s, nullptr);
+    if (surface_) vkDestroySurfaceKHR(device_.vkInstance(), surface_, nullptr);
+}
+
+bool VulkanSwapchain::initialize() {
+    VkDevice dev = device_.vkDevice();
+#ifdef _WIN32
+    if (windowHandle_) {
+        VkWin32SurfaceCreateInfoKHR si{VK_STRUCTURE_TYPE_WIN32_SURFACE_CREATE_INFO_KHR};
+        si.hinstance = GetModuleHandleW(nullptr);
+        si.hwnd = static_cast<HWND>(windowHandle_);
+        if (!vkCheck(vkCreateWin32SurfaceKHR(device_.vkInstance(), &si, nullptr, &surface_), "vkCreateWin32SurfaceKHR")) return false;
+        VkBool32 supported = VK_FALSE;
+        vkGetPhysicalDeviceSurfaceSupportKHR(device_.vkPhysicalDevice(), device_.queueFamily(), surface_, &supported);
+        if (!supported) {
+            Core::log(Core::LogLevel::Error, "Vulkan: fila gráfica não suporta apresentação nesta surface");
+            return false;
+        }
+    }
+#endif
+    if (!surface_) {
+        Core::log(Core::LogLevel::Info, "Vulkan: swapchain offscreen (sem surface de janela)");
+    }
+    VkSemaphoreCreateInfo sci{VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO};
+    for (uint32_t i = 0; i < kVkMaxFramesInFlight; ++i) {
+        if (!vkCheck(vkCreateSemaphore(dev, &sci, nullptr, &imageAvailable_[i]), "vkCreateSemaphore")) return false;
+        if (!vkCheck(vkCreateSemaphore(dev, &sci, nullptr, &renderFinished_[i]), "vkCreateSemaphore")) return false;
+    }
+    depthFormat_ = device_.swapchainDepthFormat();
+    return createResources();
+}
+
+bool VulkanSwapchain::createResources() {
+    if (width_ == 0 || height_ == 0) return true; // minimizada: recria no próximo acquire válido
+    bool ok = surface_ ? createSurfaceSwapchain() : createOffscreenImages();
+    if (!ok) return false;
+    initialized_.assign(images_.size(), false);
+    return createDepth();
+}
+
+bool VulkanSwapchain::createSurfaceSwapchain() {
+    VkPhysicalDevice phys = device_.vkPhysicalDevice();
+    VkDevice dev = device_.vkDevice();
+
+    VkSurfaceCapabilitiesKHR caps{};
+    vkGetPhysicalDeviceSurfaceCapabilitiesKHR(phys, surface_, &caps);
+
+    uint32_t formatCount = 0;
+    vkGetPhysicalDeviceSurfaceFormatsKHR(phys, surface_, &formatCount, nullptr);
+    std::vector<VkSurfaceFormatKHR> formats(formatCount);
+    vkGetPhysicalDeviceSurfaceFormatsKHR(phys, surface_, &formatCount, formats.data());
+    VkSurfaceFormatKHR chosen = formats.empty() ? VkSurfaceFormatKHR{VK_FORMAT_B8G8R8A8_UNORM, VK_COLOR_SPACE_SRGB_NONLINEAR_KHR} : formats[0];
+    for (const auto& f : formats) {
+        if ((f.format == VK_FORMAT_B8G8R8A8_UNORM || f.format == VK_FORMAT_R8G8B8A8_UNORM) && f.colorSpace == VK_COLOR_SPACE_SRGB_NONLINEAR_KHR) {
+            chosen = f;
+            break;
+        }
+    }
+    colorFormat_ = chosen.format;
+
+    uint32_t modeCount = 0;
+    vkGetPhysicalDeviceSurfacePresentModesKHR(phys, surface_, &modeCount, nullptr);
+    std::vector<VkPresentModeKHR> modes(modeCount);
+    vkGetPhysicalDeviceSurfacePresentModesKHR(phys, surface_, &modeCount, modes.data());
+    VkPresentModeKHR presentMode = VK_PRESENT_MODE_FIFO_KHR; // sempre disponível
+    if (!vsync_) {
+        for (auto m : modes) if (m == VK_PRESENT_MODE_MAILBOX_KHR) presentMode = m;
+        for (auto m : modes) if (m == VK_PRESENT_MODE_IMMEDIATE_KHR) presentMode = m;
+    }
+
+    if (caps.currentExtent.width != 0xFFFFFFFFu) {
+        extent_ = caps.currentExtent;
+    } else {
+        extent_.width = std::clamp(width_, caps.minImageExtent.width, caps.maxImageExtent.width);
+        extent_.height = std::clamp(height_, caps.minImageExtent.height, caps.maxImageExtent.height);
+    }
+    if (extent_.width == 0 || extent_.height == 0) return true;
+
+    uint32_t imageCount = caps.minImageCount + 1;
+    if (caps.maxImageCount > 0 && imageCount > caps.maxImageCount) imageCount = caps.maxImageCount;
+
+    VkSwapchainCreateInfoKHR ci{VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR};
+    ci.surface = surface_;
+    ci.minImageCount = imageCount;
+    ci.imageFormat = chosen.format;
+    ci.imageColorSpace = chosen.colorSpace;
+    ci.imageExtent = extent_;
+    ci.imageArrayLayers = 1;
+    ci.imageUsage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT;
+    if (caps.supportedUsageFlags & VK_IMAGE_USAGE_TRANSFER_SRC_BIT) ci.imageUsage |= VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+    ci.imageSharingMode = VK_SHARING_MODE_EXCLUSIVE;
+    ci.preTransform = caps.currentTransform;
+    ci.compositeAlpha = VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR;
+    ci.presentMode = presentMode;
+    ci.clipped = VK_TRUE;
+    ci.oldSwapchain = swapchain_;
+
+    VkSwapchainKHR newSwapchain = VK_NULL_HANDLE;
+    VkResult r = vkCreateSwapchainKHR(dev, &ci, nullptr, &newSwapchain);
+    if (swapchain_) vkDestroySwapchainKHR(dev, swapchain_, nullptr);
+    swapchain_ = VK_NULL_HANDLE;
+    if (!vkCheck(r, "vkCreateSwapchainKHR")) return false;
+    swapchain_ = newSwapchain;
+
+    uint32_t count = 0;
+    vkGetSwapchainImagesKHR(dev, swapchain_, &count, nullptr);
+    images_.resize(count);
+    vkGetSwapchainImagesKHR(dev, swapchain_, &count, images_.data());
+    views_.resize(count, VK_NULL_HANDLE);
+    for (uint32_t i = 0; i < count; ++i) {
+        VkImageViewCreateInfo vi{VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO};
+        vi.image = images_[i];
+        vi.viewType = VK_IMAGE_VIEW_TYPE_2D;
+        vi.format = colorFormat_;
+        vi.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1};
+        if (!vkCheck(vkCreateImageView(dev, &vi, nullptr, &views_[i]), "vkCreateImageView(swapchain)")) return false;
+    }
+    return true;
+}
+
+bool VulkanSwapchain::createOffscreenImages() {
+    VkDevice dev = device_.vkDevice();
+    colorFormat_ = VK_FORMAT_R8G8B8A8_UNORM;
+    extent_ = {width_, height_};
+    const uint32_t count = 2;
+    images_.assign(count, VK_NULL_HANDLE);
+    offscreenMemory_.assign(count, VK_NULL_HANDLE);
+    views_.assign(count, VK_NULL_HANDLE);
+    for (uint32_t i = 0; i < count; ++i) {
+        VkImageCreateInfo ici{VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO};
+        ici.imageType = VK_IMAGE_TYPE_2D;
+        ici.format = colorFormat_;
+        ici.extent = {extent_.width, extent_.height, 1};
+        ici.mipLevels = 1;
+        ici.arrayLayers = 1;
+        ici.samples = VK_SAMPLE_COUNT_1_BIT;
+        ici.tiling = VK_IMAGE_TILING_OPTIMAL;
+        ici.usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
+        ici.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        if (!device_.createRawImage(ici, images_[i], offscreenMemory_[i])) return false;
+        VkImageViewCreateInfo vi{VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO};
+        vi.image = images_[i];
+        vi.viewType = VK_IMAGE_VIEW_TYPE_2D;
+        vi.format = colorFormat_;
+        vi.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1};
+        if (!vkCheck(vkCreateImageView(dev, &vi, nullptr, &views_[i]), "vkCreateImageView(offscreen)")) return false;
+    }
+    return true;
+}
+
+bool VulkanSwapchain::createDepth() {
+    if (extent_.width == 0 || extent_.height == 0) return true;
+    VkImageCreateInfo ici{VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO};
+    ici.imageType = VK_IMAGE_TYPE_2D;
+    ici.format = depthFormat_;
+    ici.extent = {extent_.width, extent_.height, 1};
+    ici.mipLevels = 1;
+    ici.arrayLayers = 1;
+    ici.samples = VK_SAMPLE_COUNT_1_BIT;
+    ici.tiling = VK_IMAGE_TILING_OPTIMAL;
+    ici.usage = VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT;
+    ici.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    if (!device_.createRawImage(ici, depthImage_, depthMemory_)) return false;
+
+    VkImageAspectFlags aspect = VK_IMAGE_ASPECT_DEPTH_BIT;
+    if (depthFormat_ == VK_FORMAT_D24_UNORM_S8_UINT || depthFormat_ == VK_FORMAT_D32_SFLOAT_S8_UINT) aspect |= VK_IMAGE_ASPECT_STENCIL_BIT;
+    VkImageViewCreateInfo vi{VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO};
+    vi.image = depthImage_;
+    vi.viewType = VK_IMAGE_VIEW_TYPE_2D;
+    vi.format = depthFormat_;
+    vi.subresourceRange = {aspect, 0, 1, 0, 1};
+    if (!vkCheck(vkCreateImageView(device_.vkDevice(), &vi, nullptr, &depthView_), "vkCreateImageView(depth)")) return false;
+
+    // Depth fica sempre em DEPTH_STENCIL_ATTACHMENT_OPTIMAL entre passes (permite LOAD)
+    VkImage image = depthImage_;
+    device_.immediateSubmit([image, aspect](VkCommandBuffer cmd) {
+        VkImageMemoryBarrier b{VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER};
+        b.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+        b.newLayout = VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL;
+        b.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        b.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+        b.image = image;
+        b.subresourceRange = {aspect, 0, 1, 0, 1};
+        b.dstAccessMask = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+        vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT,
+                             0, 0, nullptr, 0, nullptr, 1, &b);
+    });
+    return true;
+}
+
+void VulkanSwapchain::destroyResources(bool keepSwapchainForReuse) {
+    VkDevice dev = device_.vkDevice();
+    for (auto v : views_) if (v) vkDestroyImageView(dev, v, nullptr);
+    views_.clear();
+    if (!surface_) {
+        for (auto img : images_) if (img) vkDestroyImage(dev, img, nullptr);
+        for (auto mem : offscreenMemory_) if (mem) vkFreeMemory(dev, mem, nullptr);
+        offscreenMemory_.clear();
+    }
+    images_.clear();
+    initialized_.clear();
+    if (depthView_) { vkDestroyImageView(dev, depthView_, nullptr); depthView_ = VK_NULL_HANDLE; }
+    if (depthImage_) { vkDestroyImage(dev, depthImage_, nullptr); depthImage_ = VK_NULL_HANDLE; }
+    if (depthMemory_) { vkFreeMemory(dev, depthMemory_, nullptr); depthMemory_ = VK_NULL_HANDLE; }
+    if (!keepSwapchainForReuse && swapchain_) {
+        vkDestroySwapchainKHR(dev, swapchain_, nullptr);
+        swapchain_ = VK_NULL_HANDLE;
+    }
+    extent_ = {0, 0};
+}
+
+bool VulkanSwapchain::acquire() {
+    std::scoped_lock lock(mutex_);
+    if (acquired_) return true;
+    if (dirty_) {
+        vkDeviceWaitIdle(device_.vkDevice());
+        destroyResources(true);
+        if (!createResources()) return false;
+        dirty_ = false;
+    }
+    if (images_.empty() || extent_.width == 0 || extent_.height == 0) return false;
+
+    const uint32_t slot = device_.frameSlot();
+    if (!surface_) {
+        imageIndex_ = (imageIndex_ + 1) % static_cast<uint32_t>(images_.size());
+        acquired_ = true;
+        acquiredSlot_ = slot;
+        return true;
+    }
+    VkResult r = vkAcquireNextImageKHR(device_.vkDevice(), swapchain_, UINT64_MAX, imageAvailable_[slot], VK_NULL_HANDLE, &imageIndex_);
+    if (r == VK_ERROR_OUT_OF_DATE_KHR) {
+        vkDeviceWaitIdle(device_.vkDevice());
+        destroyResources(true);
+        if (!createResources() || images_.empty()) return false;
+        r = vkAcquireNextImageKHR(device_.vkDevice(), swapchain_, UINT64_MAX, imageAvailable_[slot], VK_NULL_HANDLE, &imageIndex_);
+    }
+    if (r == VK_SUBOPTIMAL_KHR) dirty_ = true;
+    else if (!vkCheck(r, "vkAcquireNextImageKHR")) return false;
+    acquired_ = true;
+    acquiredSlot_ = slot;
+    return true;
+}
+
+void VulkanSwapchain::prepareColorForLoad(VkCommandBuffer cmd) {
+    std::scoped_lock lock(mutex_);
+    if (!acquired_ || initialized_.empty() || initialized_[imageIndex_]) return;
+    // Primeira utilização com LOAD: sai de UNDEFINED para o layout esperado pelo render pass
+    VkImageMemoryBarrier b{VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER};
+    b.oldLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+    b.newLayout = finalLayout();
+    b.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    b.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    b.image = images_[imageIndex_];
+    b.subresourceRange = {VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1};
+    vkCmdPipelineBarrier(cmd, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT,
+                         0, 0, nullptr, 0, nullptr, 1, &b);
+    initialized_[imageIndex_] = true;
+}
+
+void VulkanSwapchain::present() {
+    std::scoped_lock lock(mutex_);
+    if (!acquired_) return; // nada foi renderizado neste frame
+    if (!initialized_.empty()) initialized_[imageIndex_] = true;
+
+    const uint32_t slot = device_.frameSlot();
+    if (!surface_) {
+        device_.flushSubmissions(VK_NULL_HANDLE, VK_NULL_HANDLE);
+        device_.releaseSwapchainUse(this);
+        acquired_ = false;
+        return;
+    }
+    device_.flushSubmissions(imageAvailable_[acquiredSlot_], renderFinished_[slot]);
+    device_.releaseSwapchainUse(this);
+
+    VkPresentInfoKHR pi{VK_STRUCTURE_TYPE_PRESENT_INFO_KHR};
+    pi.waitSemaphoreCount = 1;
+    pi.pWaitSemaphores = &renderFinished_[slot];
+    pi.swapchainCount = 1;
+    pi.pSwapchains = &swapchain_;
+    pi.pImageIndices = &imageIndex_;
+    VkResult r;
+    {
+        std::scoped_lock qlock(device_.queueMutex());
+        r = vkQueuePresentKHR(device_.vkQueue(), &pi);
+    }
+    if (r == VK_ERROR_OUT_OF_DATE_KHR || r == VK_SUBOPTIMAL_KHR) dirty_ = true;
+    else vkCheck(r, "vkQueuePresentKHR");
+    acquired_ = false;
+}
+
+void VulkanSwapchain::resize(uint32_t width, uint32_t height) {
+    std::scoped_lock lock(mutex_);
+    if (width == width_ && height == height_) return;
+    width_ = width;
+    height_ = height;
+    dirty_ = true;
+}
+
+void VulkanSwapchain::setVsync(bool enabled) {
+    std::scoped_lock lock(mutex_);
+    if (vsync_ == enabled) return;
+    vsync_ = enabled;
+    dirty_ = surface_ != VK_NULL_HANDLE;
+}
+
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "Aurora/RHI/RHI.hpp"
+#include "VulkanCommon.hpp"
+
+#include <array>
+#include <mutex>
+#include <vector>
+
+namespace Aurora::RHI {
+
+class VulkanDevice; // fwd
+
+// Swapchain Vulkan. Sem janela nativa (ex.: Linux headless) usa imagens offscreen próprias:
+// acquire apenas rotaciona as imagens e present só envia o trabalho do frame.
+class VulkanSwapchain final : public ISwapchain {
+public:
+    VulkanSwapchain(VulkanDevice& device, const SwapchainDesc& desc);
+    ~VulkanSwapchain() override;
+
+    bool initialize();
+
+    void present() override;
+    void resize(uint32_t width, uint32_t height) override;
+    uint32_t getWidth() const override { return width_; }
+    uint32_t getHeight() const override { return height_; }
+    void setVsync(bool enabled) override;
+
+    // ---- Interno ao backend ----
+    // Adquire a imagem do frame corrente (idempotente até o present)
+    bool acquire();
+    bool isAcquired() const { return acquired_; }
+    // Garante layout conhecido antes de um render pass que carrega (LOAD) a cor
+    void prepareColorForLoad(VkCommandBuffer cmd);
+    VkImageView currentView() const { return views_[imageIndex_]; }
+    VkImageView depthView() const { return depthView_; }
+    VkFormat colorFormat() const { return colorFormat_; }
+    VkFormat depthFormat() const { return depthFormat_; }
+    VkExtent2D extent() const { return extent_; }
+    VkImageLayout finalLayout() const {
+        return surface_ != VK_NULL_HANDLE ? VK_IMAGE_LAYOUT_PRESENT_SRC_KHR : VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+    }
+
+private:
+    bool createResources();
+    void destroyResources(bool keepSwapchainForReuse);
+    bool createSurfaceSwapchain();
+    bool createOffscreenImages();
+    bool createDepth();
+
+    VulkanDevice& device_;
+    void* windowHandle_{nullptr};
+    uint32_t width_{0};
+    uint32_t height_{0};
+    bool vsync_{true};
+
+    VkSurfaceKHR surface_{VK_NULL_HANDLE};
+    VkSwapchainKHR swapchain_{VK_NULL_HANDLE};
+    VkFormat colorFormat_{VK_FORMAT_R8G8B8A8_UNORM};
+    VkExtent2D extent_{0, 0};
+    std::vector<VkImage> images_{};
+    std::vector<VkDeviceMemory> offscreenMemory_{}; // apenas no modo offscreen
+    std::vector<VkImageView> views_{};
+    std::vector<bool> initialized_{};
+
+    VkFormat depthFormat_{VK_FORMAT_D32_SFLOAT};
+    VkImage depthImage_{VK_NULL_HANDLE};
+    VkDeviceMemory depthMemory_{VK_NULL_HANDLE};
+    VkImageView depthView_{VK_NULL_HANDLE};
+
+    std::array<VkSemaphore, kVkMaxFramesInFlight> imageAvailable_{};
+    std::array<VkSemaphore, kVkMaxFramesInFlight> renderFinished_{};
+    std::mutex mutex_{};
+    uint32_t imageIndex_{0};
+    uint32_t acquiredSlot_{0};
+    bool acquired_{false};
+    bool dirty_{false};
+};
+
+}